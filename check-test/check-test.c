@@ -0,0 +1,3476 @@
+/*
+ * Copyright (c) 2025 Jeff Boody
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included
+ * in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define LOG_TAG "lanczos"
+#include "libcc/rng/cc_rngUniform.h"
+#include "libcc/cc_log.h"
+#include "libcc/cc_memory.h"
+#include "liblanczos/lanczos_gridder1D.h"
+#include "liblanczos/lanczos_gridder2D.h"
+#include "liblanczos/lanczos_pyramid2D.h"
+#include "liblanczos/lanczos_resample.h"
+#include "liblanczos/lanczos_simd.h"
+#include "liblanczos/lanczos_stream1D.h"
+#include "liblanczos/lanczos_stream2D.h"
+#include "liblanczos/lanczos_workspace.h"
+
+// maximum error of the SIMD kernels relative to the scalar
+// kernels for samples in [0, 1) since the order of the
+// floating point additions differs
+#define CHECK_SIMD_EPSILON 1e-5f
+
+// maximum error of the irregular resampling relative to
+// the double precision reference
+#define CHECK_IRREGULAR_EPSILON 1e-5f
+
+// maximum error of the sample formats relative to the
+// float path in units of the format (e.g. 1 LSB)
+#define CHECK_FORMAT_CODES 1
+
+/***********************************************************
+* private                                                  *
+***********************************************************/
+
+// heap allocations counted by the --wrap linker flags of
+// the Makefile
+static int check_allocs = 0;
+
+// geometries which select the polyphase, single phase
+// and contribution table paths for upsampling and
+// downsampling where 1003->1500 exceeds the phases of
+// the polyphase path
+static const int32_t check_geom1D[][2] =
+{
+	{ 100,   37 }, {   37, 100 }, { 64, 16 },
+	{  50,   50 }, { 1003, 1500 }, { 17, 256 },
+};
+
+static const int32_t check_geom2D[][4] =
+{
+	{ 61, 47, 23, 90 }, { 64, 64, 16, 16 },
+	{ 40, 30, 77, 51 }, { 33, 33, 33, 33 },
+};
+
+// base sizes of the pyramids (a power of two and a size
+// whose levels are odd, e.g. 45x30->22x15->11x7)
+static const int32_t check_base2D[][2] =
+{
+	{ 64, 64 }, { 45, 30 },
+};
+
+static const uint32_t check_flags[] =
+{
+	0,
+	LANCZOS_FLAG_EDGE_ZERO_PADDING,
+	LANCZOS_FLAG_KERNEL_LUT,
+};
+
+static const int32_t check_channels[] = { 1, 2, 3, 4 };
+
+static const int32_t check_formats[] =
+{
+	LANCZOS_FORMAT_UINT8,
+	LANCZOS_FORMAT_UINT16,
+	LANCZOS_FORMAT_FLOAT16,
+	LANCZOS_FORMAT_BFLOAT16,
+};
+
+// irregular outputs and hole modes where 0 selects the
+// default (LINEAR)
+static const int32_t check_dst1D[] = { 16, 37, 100 };
+
+static const uint32_t check_nodata[] =
+{
+	0,
+	LANCZOS_FLAG_NODATA_ZERO,
+	LANCZOS_FLAG_NODATA_NEAREST,
+	LANCZOS_FLAG_NODATA_LINEAR,
+};
+
+static const int32_t check_dst2D[][2] =
+{
+	{ 16, 12 }, { 23, 9 }, { 9, 20 },
+};
+
+static const uint32_t check_multidim[] =
+{
+	0,
+	LANCZOS_FLAG_MULTIDIM_2D_ISOTROPIC,
+};
+
+#define CHECK_COUNT(x) ((int32_t) (sizeof(x)/sizeof(x[0])))
+
+typedef int (*check_regular1D_fn)(cc_rngUniform_t* rng,
+                                  uint32_t flags, int32_t a,
+                                  int32_t channels,
+                                  int32_t src_w, int32_t dst_w);
+
+typedef int (*check_regular2D_fn)(cc_rngUniform_t* rng,
+                                  uint32_t flags, int32_t a,
+                                  int32_t channels,
+                                  int32_t src_w, int32_t src_h,
+                                  int32_t dst_w, int32_t dst_h);
+
+typedef int (*check_irregular1D_fn)(cc_rngUniform_t* rng,
+                                    uint32_t flags, int32_t a,
+                                    int32_t channels,
+                                    int32_t dst_w);
+
+typedef int (*check_irregular2D_fn)(cc_rngUniform_t* rng,
+                                    uint32_t flags, int32_t a,
+                                    int32_t channels,
+                                    int32_t dst_w, int32_t dst_h);
+
+static void
+check_random(cc_rngUniform_t* rng, int32_t n, float* dst)
+{
+	int32_t i;
+	for(i = 0; i < n; ++i)
+	{
+		dst[i] = cc_rngUniform_rand1F(rng);
+	}
+}
+
+static float
+check_maxError(int32_t n, const float* a, const float* b)
+{
+	float   e;
+	float   emax = 0.0f;
+	int32_t i;
+	for(i = 0; i < n; ++i)
+	{
+		e = fabsf(a[i] - b[i]);
+		if((e > emax) || isnan(e))
+		{
+			emax = e;
+		}
+	}
+	return emax;
+}
+
+// generate the samples {x,val} of the irregular 1D bins
+// (n=dst_w + 2a) in [x0, x1) = [-1, 3) where a bin is
+// empty with the probability holes (and the 2a + 1 bins
+// following the center when holes is non-zero) or has
+// [n0, n1] samples
+// returns the sample count where src must hold
+// (dst_w + 2a)*n1 samples
+static int32_t
+check_irregular1DSrc(cc_rngUniform_t* rng, int32_t a,
+                     int32_t channels, int32_t dst_w,
+                     int32_t n0, int32_t n1, float holes,
+                     float* src)
+{
+	int32_t stride    = 1 + channels;
+	int32_t bin_count = dst_w + 2*a;
+	int32_t center    = bin_count/2;
+	int32_t count     = 0;
+	int32_t b;
+	int32_t i;
+	int32_t n;
+	float   jf;
+	float*  s;
+	for(b = 0; b < bin_count; ++b)
+	{
+		if((cc_rngUniform_rand1F(rng) < holes) ||
+		   ((holes > 0.0f) && (b > center) &&
+		    (b <= center + 2*a + 1)))
+		{
+			continue;
+		}
+
+		n = n0 + (int32_t) ((n1 - n0 + 1)*
+		                    cc_rngUniform_rand1F(rng));
+		if(n > n1)
+		{
+			n = n1;
+		}
+
+		// stratify the samples such that the density
+		// compensation is well conditioned and keep the
+		// samples away from the bin boundaries
+		for(i = 0; i < n; ++i)
+		{
+			jf   = ((float) (b - a)) + (((float) i) + 0.05f +
+			       0.9f*cc_rngUniform_rand1F(rng))/((float) n);
+			s    = &src[stride*count];
+			s[0] = -1.0f + 4.0f*jf/((float) dst_w);
+			check_random(rng, channels, &s[1]);
+			++count;
+		}
+	}
+	return count;
+}
+
+// shuffle the samples (Fisher-Yates)
+static void
+check_shuffle(cc_rngUniform_t* rng, int32_t count,
+              int32_t stride, float* src)
+{
+	float   tmp[8];
+	int32_t i;
+	int32_t j;
+	for(i = count - 1; i > 0; --i)
+	{
+		j = (int32_t) ((i + 1)*cc_rngUniform_rand1F(rng));
+		if(j > i)
+		{
+			j = i;
+		}
+		memcpy(tmp, &src[stride*i], stride*sizeof(float));
+		memcpy(&src[stride*i], &src[stride*j],
+		       stride*sizeof(float));
+		memcpy(&src[stride*j], tmp, stride*sizeof(float));
+	}
+}
+
+// generate the samples {x,y,val} of the irregular 2D cells
+// (n=(dst_w + 2a)*(dst_h + 2a)) in [x0, x1) = [0, 2) and
+// [y0, y1) = [-1, 1) where a cell is empty with the
+// probability holes (and the (2a + 1)^2 cells following
+// the center when holes is non-zero) or has a jittered
+// grid of n*n samples otherwise where n is n1 for the
+// cluster of (2a + 1)^2 cells preceding the center and n0
+// for the remaining cells
+// returns the sample count where src must hold
+// (dst_w + 2a)*(dst_h + 2a)*n1*n1 samples
+static int32_t
+check_irregular2DSrc(cc_rngUniform_t* rng, int32_t a,
+                     int32_t channels, int32_t dst_w,
+                     int32_t dst_h, int32_t n0, int32_t n1,
+                     float holes, float* src)
+{
+	int32_t stride = 2 + channels;
+	int32_t w      = dst_w + 2*a;
+	int32_t h      = dst_h + 2*a;
+	int32_t count  = 0;
+	int32_t cx;
+	int32_t cy;
+	int32_t dx;
+	int32_t dy;
+	int32_t i;
+	int32_t j;
+	int32_t n;
+	float   jfx;
+	float   jfy;
+	float*  s;
+	for(cy = 0; cy < h; ++cy)
+	{
+		for(cx = 0; cx < w; ++cx)
+		{
+			dx = cx - w/2;
+			dy = cy - h/2;
+			if((cc_rngUniform_rand1F(rng) < holes) ||
+			   ((holes > 0.0f) &&
+			    (dx > 0) && (dx <= 2*a + 1) &&
+			    (dy > 0) && (dy <= 2*a + 1)))
+			{
+				continue;
+			}
+
+			n = n0;
+			if((dx <= 0) && (dx > -2*a - 1) &&
+			   (dy <= 0) && (dy > -2*a - 1))
+			{
+				n = n1;
+			}
+
+			// the jittered grid keeps the density
+			// compensation well conditioned
+			for(i = 0; i < n; ++i)
+			{
+				for(j = 0; j < n; ++j)
+				{
+					jfx  = ((float) (cx - a)) +
+					       (((float) j) + 0.4f +
+					        0.2f*cc_rngUniform_rand1F(rng))/n;
+					jfy  = ((float) (cy - a)) +
+					       (((float) i) + 0.4f +
+					        0.2f*cc_rngUniform_rand1F(rng))/n;
+					s    = &src[stride*count];
+					s[0] = 2.0f*jfx/((float) dst_w);
+					s[1] = -1.0f + 2.0f*jfy/((float) dst_h);
+					check_random(rng, channels, &s[2]);
+					++count;
+				}
+			}
+		}
+	}
+	return count;
+}
+
+// remove up to n random samples from the count samples of
+// set (preserving the order of the remaining samples) and
+// copy them to rem
+// returns the number of removed samples
+static int32_t
+check_remove(cc_rngUniform_t* rng, int32_t n, int32_t stride,
+             int32_t* _count, float* set, float* rem)
+{
+	int32_t count = *_count;
+	int32_t i;
+	int32_t j;
+	for(i = 0; (i < n) && (count > 0); ++i)
+	{
+		j = (int32_t) (count*cc_rngUniform_rand1F(rng));
+		if(j >= count)
+		{
+			j = count - 1;
+		}
+		memcpy(&rem[stride*i], &set[stride*j],
+		       stride*sizeof(float));
+		memmove(&set[stride*j], &set[stride*(j + 1)],
+		        stride*(count - j - 1)*sizeof(float));
+		--count;
+	}
+	*_count = count;
+	return i;
+}
+
+static int
+check_result(const char* name, float err, float tol)
+{
+	if(err <= tol)
+	{
+		LOGI("%s: err=%g", name, err);
+		return 1;
+	}
+
+	LOGE("%s: err=%g, tol=%g", name, err, tol);
+	return 0;
+}
+
+// check that no heap allocations were counted since the
+// counter was reset
+static int
+check_heap(const char* name)
+{
+	if(check_allocs == 0)
+	{
+		return 1;
+	}
+
+	LOGE("%s: allocs=%i", name, check_allocs);
+	return 0;
+}
+
+// run a regular check for each flags, a, channels and
+// geometry
+static int
+check_regular1D(cc_rngUniform_t* rng, check_regular1D_fn fn)
+{
+	const int32_t* g;
+	int32_t        a;
+	int32_t        c;
+	int32_t        f;
+	int32_t        i;
+	int            ret = 1;
+	for(f = 0; f < CHECK_COUNT(check_flags); ++f)
+	{
+		for(a = 2; a <= 3; ++a)
+		{
+			for(c = 0; c < CHECK_COUNT(check_channels); ++c)
+			{
+				for(i = 0; i < CHECK_COUNT(check_geom1D); ++i)
+				{
+					g    = check_geom1D[i];
+					ret &= fn(rng, check_flags[f], a,
+					          check_channels[c], g[0], g[1]);
+				}
+			}
+		}
+	}
+	return ret;
+}
+
+static int
+check_regular2D(cc_rngUniform_t* rng, check_regular2D_fn fn)
+{
+	const int32_t* g;
+	int32_t        a;
+	int32_t        c;
+	int32_t        f;
+	int32_t        i;
+	int            ret = 1;
+	for(f = 0; f < CHECK_COUNT(check_flags); ++f)
+	{
+		for(a = 2; a <= 3; ++a)
+		{
+			for(c = 0; c < CHECK_COUNT(check_channels); ++c)
+			{
+				for(i = 0; i < CHECK_COUNT(check_geom2D); ++i)
+				{
+					g    = check_geom2D[i];
+					ret &= fn(rng, check_flags[f], a,
+					          check_channels[c], g[0], g[1],
+					          g[2], g[3]);
+				}
+			}
+		}
+	}
+	return ret;
+}
+
+// reference Lanczos kernel
+static double
+check_L(int32_t a, double x)
+{
+	if(x == 0.0)
+	{
+		return 1.0;
+	}
+	else if(fabs(x) >= (double) a)
+	{
+		return 0.0;
+	}
+	return a*sin(M_PI*x)*sin(M_PI*x/a)/(M_PI*M_PI*x*x);
+}
+
+// find the sample of bin b with the min or max position
+static const float*
+check_extreme1D(int32_t stride, int32_t count,
+                const float* rec, const int32_t* bin,
+                int32_t b, int max)
+{
+	int32_t      i;
+	const float* xp;
+	const float* xe = NULL;
+	for(i = 0; i < count; ++i)
+	{
+		xp = &rec[stride*i];
+		if((bin[i] == b) &&
+		   ((xe == NULL) ||
+		    (max && (xp[0] > xe[0])) ||
+		    ((max == 0) && (xp[0] < xe[0]))))
+		{
+			xe = xp;
+		}
+	}
+	return xe;
+}
+
+// reference irregular 1D resampling which evaluates the
+// hole filling, density compensation and outputs of the
+// readme in double precision from the list of samples
+static int
+check_irregular1DRef(lanczos_paramIrregular1D_t* param,
+                     float* ref)
+{
+	int32_t a         = param->a;
+	int32_t channels  = param->channels;
+	int32_t stride    = 1 + channels;
+	int32_t bin_count = param->dst_w + 2*a;
+	int32_t n         = param->src_count + bin_count;
+	float   x0        = param->src_x0;
+	float   x1        = param->src_x1;
+	float   n2        = (float) param->dst_w;
+
+	// samples {x,val} followed by the holes and the bin
+	// and mapped position of each sample
+	float* rec = (float*) CALLOC(n*stride, sizeof(float));
+	if(rec == NULL)
+	{
+		LOGE("CALLOC failed");
+		return 0;
+	}
+
+	int32_t* bin = (int32_t*) CALLOC(n, sizeof(int32_t));
+	if(bin == NULL)
+	{
+		LOGE("CALLOC failed");
+		goto fail_bin;
+	}
+
+	float* jf = (float*) CALLOC(n, sizeof(float));
+	if(jf == NULL)
+	{
+		LOGE("CALLOC failed");
+		goto fail_jf;
+	}
+
+	double* vk = (double*) CALLOC(bin_count, sizeof(double));
+	if(vk == NULL)
+	{
+		LOGE("CALLOC failed");
+		goto fail_vk;
+	}
+
+	// map the samples to the bins
+	int32_t      count = 0;
+	int32_t      i;
+	int32_t      b;
+	const float* s1;
+	for(i = 0; i < param->src_count; ++i)
+	{
+		s1        = &param->src[stride*i];
+		jf[count] = n2*(s1[0] - x0)/(x1 - x0);
+		b         = ((int32_t) floorf(jf[count])) + a;
+		if((b < 0) || (b >= bin_count))
+		{
+			continue;
+		}
+
+		bin[count] = b;
+		memcpy(&rec[stride*count], s1, stride*sizeof(float));
+		++count;
+	}
+
+	// fill the holes of the empty bins in order where the
+	// left neighbor is the max sample of the previous bin
+	// (or the previous hole) and the right neighbor is the
+	// min sample of the next populated bin within the
+	// support radius
+	uint32_t     mode    = param->flags & LANCZOS_FLAG_NODATA_MASK;
+	int32_t      samples = count;
+	int32_t      ch;
+	int32_t      next;
+	float        s;
+	float*       dat;
+	const float* xe;
+	const float* x0p = NULL;
+	const float* x1p;
+	for(b = 0; b < bin_count; ++b)
+	{
+		xe = check_extreme1D(stride, samples, rec, bin, b, 1);
+		if(xe)
+		{
+			x0p = xe;
+			continue;
+		}
+
+		dat        = &rec[stride*count];
+		jf[count]  = ((float) (b - a)) + 0.5f;
+		bin[count] = b;
+		dat[0]     = x0 + (x1 - x0)*jf[count]/n2;
+		++count;
+
+		x1p = NULL;
+		for(next = b + 1; next < bin_count; ++next)
+		{
+			x1p = check_extreme1D(stride, samples, rec, bin,
+			                      next, 0);
+			if(x1p)
+			{
+				break;
+			}
+		}
+		if(next - b > a)
+		{
+			x1p = NULL;
+		}
+
+		if(mode == LANCZOS_FLAG_NODATA_ZERO)
+		{
+			x0p = dat;
+			continue;
+		}
+
+		// LINEAR (default) or NEAREST which is also the
+		// fallback of LINEAR with a single neighbor
+		if(x0p && x1p &&
+		   ((mode == LANCZOS_FLAG_NODATA_LINEAR) || (mode == 0)))
+		{
+			s = (dat[0] - x0p[0])/(x1p[0] - x0p[0]);
+			for(ch = 1; ch <= channels; ++ch)
+			{
+				dat[ch] = x0p[ch] + s*(x1p[ch] - x0p[ch]);
+			}
+		}
+		else
+		{
+			xe = x0p ? x0p : x1p;
+			if(x0p && x1p &&
+			   (fabsf(x1p[0] - dat[0]) < fabsf(x0p[0] - dat[0])))
+			{
+				xe = x1p;
+			}
+
+			if(xe)
+			{
+				memcpy(&dat[1], &xe[1], channels*sizeof(float));
+			}
+		}
+		x0p = dat;
+	}
+
+	// density compensation of the bins
+	double sum;
+	for(b = 0; b < bin_count; ++b)
+	{
+		sum = 0.0;
+		for(i = 0; i < count; ++i)
+		{
+			sum += check_L(a, jf[i] - (b - a + 0.5));
+		}
+		vk[b] = (fabs(sum) > 1e-6) ? 1.0/sum : 0.0;
+	}
+
+	// outputs j are supported by the bins [j, j + 2a]
+	int32_t j;
+	double  w;
+	double  wj;
+	double  s2[4];
+	for(j = 0; j < param->dst_w; ++j)
+	{
+		wj = 0.0;
+		for(ch = 0; ch < channels; ++ch)
+		{
+			s2[ch] = 0.0;
+		}
+
+		for(i = 0; i < count; ++i)
+		{
+			if((bin[i] < j) || (bin[i] > j + 2*a))
+			{
+				continue;
+			}
+
+			w   = vk[bin[i]]*check_L(a, jf[i] - (j + 0.5));
+			wj += w;
+			for(ch = 0; ch < channels; ++ch)
+			{
+				s2[ch] += w*rec[stride*i + ch + 1];
+			}
+		}
+
+		for(ch = 0; ch < channels; ++ch)
+		{
+			ref[channels*j + ch] = (fabs(wj) > 1e-6) ?
+			                       (float) (s2[ch]/wj) : 0.0f;
+		}
+	}
+
+	FREE(vk);
+	FREE(jf);
+	FREE(bin);
+	FREE(rec);
+
+	// success
+	return 1;
+
+	// failure
+	fail_vk:
+		FREE(jf);
+	fail_jf:
+		FREE(bin);
+	fail_bin:
+		FREE(rec);
+	return 0;
+}
+
+// run an irregular 1D check for each hole mode, a,
+// channels and output width
+static int
+check_irregular1D(cc_rngUniform_t* rng, check_irregular1D_fn fn)
+{
+	int32_t a;
+	int32_t c;
+	int32_t f;
+	int32_t i;
+	int     ret = 1;
+	for(f = 0; f < CHECK_COUNT(check_nodata); ++f)
+	{
+		for(a = 2; a <= 3; ++a)
+		{
+			for(c = 0; c < CHECK_COUNT(check_channels); ++c)
+			{
+				for(i = 0; i < CHECK_COUNT(check_dst1D); ++i)
+				{
+					ret &= fn(rng, check_nodata[f], a,
+					          check_channels[c],
+					          check_dst1D[i]);
+				}
+			}
+		}
+	}
+	return ret;
+}
+
+// reference 2D kernel
+static double
+check_L2D(int32_t a, int isotropic, double dx, double dy)
+{
+	if(isotropic)
+	{
+		return check_L(a, sqrt(dx*dx + dy*dy));
+	}
+	return check_L(a, dx)*check_L(a, dy);
+}
+
+// reference irregular 2D resampling which evaluates the
+// hole filling (see lanczos_grid2D_fillHole), density
+// compensation and outputs in double precision from the
+// list of samples
+static int
+check_irregular2DRef(lanczos_paramIrregular2D_t* param,
+                     float* ref)
+{
+	int32_t a         = param->a;
+	int32_t channels  = param->channels;
+	int32_t stride    = 2 + channels;
+	int32_t w         = param->dst_w + 2*a;
+	int32_t h         = param->dst_h + 2*a;
+	int32_t n         = param->src_count + w*h;
+	int     isotropic = (param->flags &
+	                     LANCZOS_FLAG_MULTIDIM_2D_ISOTROPIC) ? 1 : 0;
+	float   sx        = ((float) param->dst_w)/
+	                    (param->src_x1 - param->src_x0);
+	float   sy        = ((float) param->dst_h)/
+	                    (param->src_y1 - param->src_y0);
+
+	// samples {x,y,val} followed by the holes and the cell
+	// and mapped position {jfx,jfy} of each sample
+	float* rec = (float*) CALLOC(n*stride, sizeof(float));
+	if(rec == NULL)
+	{
+		LOGE("CALLOC failed");
+		return 0;
+	}
+
+	int32_t* cell = (int32_t*) CALLOC(n, sizeof(int32_t));
+	if(cell == NULL)
+	{
+		LOGE("CALLOC failed");
+		goto fail_cell;
+	}
+
+	float* jf = (float*) CALLOC(2*n, sizeof(float));
+	if(jf == NULL)
+	{
+		LOGE("CALLOC failed");
+		goto fail_jf;
+	}
+
+	double* vk = (double*) CALLOC(w*h, sizeof(double));
+	if(vk == NULL)
+	{
+		LOGE("CALLOC failed");
+		goto fail_vk;
+	}
+
+	// map the samples to the cells
+	int32_t      count = 0;
+	int32_t      i;
+	int32_t      cx;
+	int32_t      cy;
+	float        jfx;
+	float        jfy;
+	const float* s1;
+	for(i = 0; i < param->src_count; ++i)
+	{
+		s1  = &param->src[stride*i];
+		jfx = sx*(s1[0] - param->src_x0);
+		jfy = sy*(s1[1] - param->src_y0);
+		cx  = ((int32_t) floorf(jfx)) + a;
+		cy  = ((int32_t) floorf(jfy)) + a;
+		if((cx < 0) || (cx >= w) || (cy < 0) || (cy >= h))
+		{
+			continue;
+		}
+
+		cell[count]       = cy*w + cx;
+		jf[2*count]       = jfx;
+		jf[2*count + 1]   = jfy;
+		memcpy(&rec[stride*count], s1, stride*sizeof(float));
+		++count;
+	}
+
+	// fill the holes of the empty cells from the nearest
+	// sample of each populated cell of the support window
+	uint32_t     mode    = param->flags & LANCZOS_FLAG_NODATA_MASK;
+	int32_t      samples = count;
+	int32_t      c;
+	int32_t      ch;
+	int32_t      k;
+	int32_t      m;
+	float        d2;
+	float        d2min;
+	float        best;
+	float        wf;
+	float        wsum;
+	float*       dat;
+	const float* xmin;
+	const float* xbest;
+	for(c = 0; c < w*h; ++c)
+	{
+		for(i = 0; i < samples; ++i)
+		{
+			if(cell[i] == c)
+			{
+				break;
+			}
+		}
+		if(i < samples)
+		{
+			continue;
+		}
+
+		cx              = c%w;
+		cy              = c/w;
+		jfx             = ((float) (cx - a)) + 0.5f;
+		jfy             = ((float) (cy - a)) + 0.5f;
+		dat             = &rec[stride*count];
+		dat[0]          = param->src_x0 + jfx/sx;
+		dat[1]          = param->src_y0 + jfy/sy;
+		cell[count]     = c;
+		jf[2*count]     = jfx;
+		jf[2*count + 1] = jfy;
+		++count;
+
+		if(mode == LANCZOS_FLAG_NODATA_ZERO)
+		{
+			continue;
+		}
+
+		wsum  = 0.0f;
+		best  = 0.0f;
+		xbest = NULL;
+		for(m = 0; m < w*h; ++m)
+		{
+			if((abs(m%w - cx) > a) || (abs(m/w - cy) > a))
+			{
+				continue;
+			}
+
+			// nearest sample of the cell m
+			xmin  = NULL;
+			d2min = 0.0f;
+			for(k = 0; k < samples; ++k)
+			{
+				if(cell[k] != m)
+				{
+					continue;
+				}
+
+				d2 = (jf[2*k] - jfx)*(jf[2*k] - jfx) +
+				     (jf[2*k + 1] - jfy)*(jf[2*k + 1] - jfy);
+				if((xmin == NULL) || (d2 < d2min))
+				{
+					xmin  = &rec[stride*k];
+					d2min = d2;
+				}
+			}
+			if(xmin == NULL)
+			{
+				continue;
+			}
+
+			if((xbest == NULL) || (d2min < best))
+			{
+				xbest = xmin;
+				best  = d2min;
+			}
+
+			// LINEAR (default) weights the nearest sample
+			// of each cell by inverse distance
+			if((mode == LANCZOS_FLAG_NODATA_NEAREST) ||
+			   (d2min == 0.0f))
+			{
+				continue;
+			}
+
+			wf    = 1.0f/sqrtf(d2min);
+			wsum += wf;
+			for(ch = 0; ch < channels; ++ch)
+			{
+				dat[ch + 2] += wf*xmin[ch + 2];
+			}
+		}
+
+		if(xbest == NULL)
+		{
+			continue;
+		}
+		else if((mode == LANCZOS_FLAG_NODATA_NEAREST) ||
+		        (best == 0.0f))
+		{
+			memcpy(&dat[2], &xbest[2], channels*sizeof(float));
+			continue;
+		}
+
+		for(ch = 0; ch < channels; ++ch)
+		{
+			dat[ch + 2] /= wsum;
+		}
+	}
+
+	// density compensation of the cells
+	double sum;
+	for(c = 0; c < w*h; ++c)
+	{
+		jfx = ((float) (c%w - a)) + 0.5f;
+		jfy = ((float) (c/w - a)) + 0.5f;
+		sum = 0.0;
+		for(i = 0; i < count; ++i)
+		{
+			if((fabsf(jf[2*i] - jfx) >= a) ||
+			   (fabsf(jf[2*i + 1] - jfy) >= a))
+			{
+				continue;
+			}
+			sum += check_L2D(a, isotropic, jf[2*i] - jfx,
+			                 jf[2*i + 1] - jfy);
+		}
+		vk[c] = (fabs(sum) > 1e-6) ? 1.0/sum : 0.0;
+	}
+
+	// outputs (x, y) are supported by the cells
+	// [x, x + 2a]x[y, y + 2a]
+	int32_t x;
+	int32_t y;
+	double  wc;
+	double  wj;
+	double  s2[4];
+	for(y = 0; y < param->dst_h; ++y)
+	{
+		for(x = 0; x < param->dst_w; ++x)
+		{
+			wj = 0.0;
+			for(ch = 0; ch < channels; ++ch)
+			{
+				s2[ch] = 0.0;
+			}
+
+			jfx = ((float) x) + 0.5f;
+			jfy = ((float) y) + 0.5f;
+			for(i = 0; i < count; ++i)
+			{
+				cx = cell[i]%w;
+				cy = cell[i]/w;
+				if((cx < x) || (cx > x + 2*a) ||
+				   (cy < y) || (cy > y + 2*a))
+				{
+					continue;
+				}
+
+				wc  = vk[cell[i]]*
+				      check_L2D(a, isotropic, jf[2*i] - jfx,
+				                jf[2*i + 1] - jfy);
+				wj += wc;
+				for(ch = 0; ch < channels; ++ch)
+				{
+					s2[ch] += wc*rec[stride*i + ch + 2];
+				}
+			}
+
+			for(ch = 0; ch < channels; ++ch)
+			{
+				ref[channels*(y*param->dst_w + x) + ch] =
+					(fabs(wj) > 1e-6) ? (float) (s2[ch]/wj) : 0.0f;
+			}
+		}
+	}
+
+	FREE(vk);
+	FREE(jf);
+	FREE(cell);
+	FREE(rec);
+
+	// success
+	return 1;
+
+	// failure
+	fail_vk:
+		FREE(jf);
+	fail_jf:
+		FREE(cell);
+	fail_cell:
+		FREE(rec);
+	return 0;
+}
+
+// run an irregular 2D check for each kernel, hole mode, a,
+// channels and output geometry
+static int
+check_irregular2D(cc_rngUniform_t* rng, check_irregular2D_fn fn)
+{
+	const int32_t* g;
+	int32_t        a;
+	int32_t        c;
+	int32_t        f;
+	int32_t        i;
+	int32_t        m;
+	int            ret = 1;
+	for(m = 0; m < CHECK_COUNT(check_multidim); ++m)
+	{
+		for(f = 0; f < CHECK_COUNT(check_nodata); ++f)
+		{
+			for(a = 2; a <= 3; ++a)
+			{
+				for(c = 0; c < CHECK_COUNT(check_channels); ++c)
+				{
+					for(i = 0; i < CHECK_COUNT(check_dst2D); ++i)
+					{
+						g    = check_dst2D[i];
+						ret &= fn(rng,
+						          check_multidim[m] | check_nodata[f],
+						          a, check_channels[c], g[0], g[1]);
+					}
+				}
+			}
+		}
+	}
+	return ret;
+}
+
+// compare the SIMD kernels with the scalar reference
+// kernels (LANCZOS_FLAG_SCALAR)
+static int
+check_scalar1D(cc_rngUniform_t* rng, uint32_t flags,
+               int32_t a, int32_t channels, int32_t src_w,
+               int32_t dst_w)
+{
+	int32_t n1 = src_w*channels;
+	int32_t n2 = dst_w*channels;
+
+	float* buf = (float*) CALLOC(n1 + 2*n2, sizeof(float));
+	if(buf == NULL)
+	{
+		LOGE("CALLOC failed");
+		return 0;
+	}
+
+	float* src = buf;
+	float* dst = &buf[n1];
+	float* ref = &buf[n1 + n2];
+	check_random(rng, n1, src);
+
+	lanczos_paramRegular1D_t param =
+	{
+		.flags    = flags,
+		.a        = a,
+		.channels = channels,
+		.src_w    = src_w,
+		.dst_w    = dst_w,
+		.src      = src,
+		.dst      = dst,
+	};
+
+	if(lanczos_resample_regular1D(&param) == 0)
+	{
+		goto fail_resample;
+	}
+
+	param.flags = flags | LANCZOS_FLAG_SCALAR;
+	param.dst   = ref;
+	if(lanczos_resample_regular1D(&param) == 0)
+	{
+		goto fail_resample;
+	}
+
+	char name[256];
+	snprintf(name, 256, "scalar1D flags=0x%X, a=%i, channels=%i, "
+	         "%i->%i", flags, a, channels, src_w, dst_w);
+	int ret = check_result(name, check_maxError(n2, dst, ref),
+	                       CHECK_SIMD_EPSILON);
+
+	FREE(buf);
+
+	// success
+	return ret;
+
+	// failure
+	fail_resample:
+		FREE(buf);
+	return 0;
+}
+
+static int
+check_scalar2D(cc_rngUniform_t* rng, uint32_t flags,
+               int32_t a, int32_t channels, int32_t src_w,
+               int32_t src_h, int32_t dst_w, int32_t dst_h)
+{
+	int32_t n1 = src_w*src_h*channels;
+	int32_t n2 = dst_w*dst_h*channels;
+
+	float* buf = (float*) CALLOC(n1 + 2*n2, sizeof(float));
+	if(buf == NULL)
+	{
+		LOGE("CALLOC failed");
+		return 0;
+	}
+
+	float* src = buf;
+	float* dst = &buf[n1];
+	float* ref = &buf[n1 + n2];
+	check_random(rng, n1, src);
+
+	lanczos_paramRegular2D_t param =
+	{
+		.flags    = flags,
+		.a        = a,
+		.channels = channels,
+		.src_w    = src_w,
+		.src_h    = src_h,
+		.dst_w    = dst_w,
+		.dst_h    = dst_h,
+		.src      = src,
+		.dst      = dst,
+	};
+
+	if(lanczos_resample_regular2D(&param) == 0)
+	{
+		goto fail_resample;
+	}
+
+	param.flags = flags | LANCZOS_FLAG_SCALAR;
+	param.dst   = ref;
+	if(lanczos_resample_regular2D(&param) == 0)
+	{
+		goto fail_resample;
+	}
+
+	char name[256];
+	snprintf(name, 256, "scalar2D flags=0x%X, a=%i, channels=%i, "
+	         "%ix%i->%ix%i", flags, a, channels,
+	         src_w, src_h, dst_w, dst_h);
+	int ret = check_result(name, check_maxError(n2, dst, ref),
+	                       CHECK_SIMD_EPSILON);
+
+	FREE(buf);
+
+	// success
+	return ret;
+
+	// failure
+	fail_resample:
+		FREE(buf);
+	return 0;
+}
+
+static int
+check_scalarIsotropic2D(cc_rngUniform_t* rng, uint32_t flags,
+                        int32_t a, int32_t channels,
+                        int32_t src_w, int32_t src_h,
+                        int32_t dst_w, int32_t dst_h)
+{
+	return check_scalar2D(rng,
+	                      flags | LANCZOS_FLAG_MULTIDIM_2D_ISOTROPIC,
+	                      a, channels, src_w, src_h, dst_w, dst_h);
+}
+
+// compare the plans of a plan cache with new plans where
+// the cache is repeated to acquire the cached plans and has
+// fewer entries than a 2D plan requires to evict the plans
+static int
+check_cache1D(cc_rngUniform_t* rng, uint32_t flags,
+              int32_t a, int32_t channels, int32_t src_w,
+              int32_t dst_w)
+{
+	int32_t n1 = src_w*channels;
+	int32_t n2 = dst_w*channels;
+
+	lanczos_planCache_t* cache = lanczos_planCache_new(1);
+	if(cache == NULL)
+	{
+		return 0;
+	}
+
+	float* buf = (float*) CALLOC(n1 + 2*n2, sizeof(float));
+	if(buf == NULL)
+	{
+		LOGE("CALLOC failed");
+		goto fail_buf;
+	}
+
+	float* src = buf;
+	float* dst = &buf[n1];
+	float* ref = &buf[n1 + n2];
+	check_random(rng, n1, src);
+
+	lanczos_paramRegular1D_t param =
+	{
+		.flags    = flags,
+		.a        = a,
+		.channels = channels,
+		.src_w    = src_w,
+		.dst_w    = dst_w,
+		.src      = src,
+		.dst      = ref,
+	};
+
+	if(lanczos_resample_regular1D(&param) == 0)
+	{
+		goto fail_resample;
+	}
+
+	char name[256];
+	snprintf(name, 256, "cache1D flags=0x%X, a=%i, channels=%i, "
+	         "%i->%i", flags, a, channels, src_w, dst_w);
+
+	int i;
+	int ret = 1;
+	param.cache = cache;
+	param.dst   = dst;
+	for(i = 0; i < 2; ++i)
+	{
+		if(lanczos_resample_regular1D(&param) == 0)
+		{
+			goto fail_resample;
+		}
+
+		ret &= check_result(name, check_maxError(n2, dst, ref),
+		                    0.0f);
+	}
+
+	FREE(buf);
+	lanczos_planCache_delete(&cache);
+
+	// success
+	return ret;
+
+	// failure
+	fail_resample:
+		FREE(buf);
+	fail_buf:
+		lanczos_planCache_delete(&cache);
+	return 0;
+}
+
+static int
+check_cache2D(cc_rngUniform_t* rng, uint32_t flags,
+              int32_t a, int32_t channels, int32_t src_w,
+              int32_t src_h, int32_t dst_w, int32_t dst_h)
+{
+	int32_t n1 = src_w*src_h*channels;
+	int32_t n2 = dst_w*dst_h*channels;
+
+	lanczos_planCache_t* cache = lanczos_planCache_new(1);
+	if(cache == NULL)
+	{
+		return 0;
+	}
+
+	float* buf = (float*) CALLOC(n1 + 2*n2, sizeof(float));
+	if(buf == NULL)
+	{
+		LOGE("CALLOC failed");
+		goto fail_buf;
+	}
+
+	float* src = buf;
+	float* dst = &buf[n1];
+	float* ref = &buf[n1 + n2];
+	check_random(rng, n1, src);
+
+	lanczos_paramRegular2D_t param =
+	{
+		.flags    = flags,
+		.a        = a,
+		.channels = channels,
+		.src_w    = src_w,
+		.src_h    = src_h,
+		.dst_w    = dst_w,
+		.dst_h    = dst_h,
+		.src      = src,
+		.dst      = ref,
+	};
+
+	if(lanczos_resample_regular2D(&param) == 0)
+	{
+		goto fail_resample;
+	}
+
+	char name[256];
+	snprintf(name, 256, "cache2D flags=0x%X, a=%i, channels=%i, "
+	         "%ix%i->%ix%i", flags, a, channels,
+	         src_w, src_h, dst_w, dst_h);
+
+	int i;
+	int ret = 1;
+	param.cache = cache;
+	param.dst   = dst;
+	for(i = 0; i < 2; ++i)
+	{
+		if(lanczos_resample_regular2D(&param) == 0)
+		{
+			goto fail_resample;
+		}
+
+		ret &= check_result(name, check_maxError(n2, dst, ref),
+		                    0.0f);
+	}
+
+	FREE(buf);
+	lanczos_planCache_delete(&cache);
+
+	// success
+	return ret;
+
+	// failure
+	fail_resample:
+		FREE(buf);
+	fail_buf:
+		lanczos_planCache_delete(&cache);
+	return 0;
+}
+
+// compare the 2D resampling of a thread pool with the
+// serial resampling
+static int
+check_pool2D(cc_rngUniform_t* rng, uint32_t flags,
+             int32_t a, int32_t channels, int32_t src_w,
+             int32_t src_h, int32_t dst_w, int32_t dst_h)
+{
+	int32_t n1 = src_w*src_h*channels;
+	int32_t n2 = dst_w*dst_h*channels;
+
+	lanczos_pool_t* pool = lanczos_pool_new(4);
+	if(pool == NULL)
+	{
+		return 0;
+	}
+
+	float* buf = (float*) CALLOC(n1 + 2*n2, sizeof(float));
+	if(buf == NULL)
+	{
+		LOGE("CALLOC failed");
+		goto fail_buf;
+	}
+
+	float* src = buf;
+	float* dst = &buf[n1];
+	float* ref = &buf[n1 + n2];
+	check_random(rng, n1, src);
+
+	lanczos_paramRegular2D_t param =
+	{
+		.flags    = flags,
+		.a        = a,
+		.channels = channels,
+		.src_w    = src_w,
+		.src_h    = src_h,
+		.dst_w    = dst_w,
+		.dst_h    = dst_h,
+		.src      = src,
+		.dst      = ref,
+	};
+
+	if(lanczos_resample_regular2D(&param) == 0)
+	{
+		goto fail_resample;
+	}
+
+	param.pool = pool;
+	param.dst  = dst;
+	if(lanczos_resample_regular2D(&param) == 0)
+	{
+		goto fail_resample;
+	}
+
+	char name[256];
+	snprintf(name, 256, "pool2D flags=0x%X, a=%i, channels=%i, "
+	         "%ix%i->%ix%i", flags, a, channels,
+	         src_w, src_h, dst_w, dst_h);
+	int ret = check_result(name, check_maxError(n2, dst, ref),
+	                       0.0f);
+
+	FREE(buf);
+	lanczos_pool_delete(&pool);
+
+	// success
+	return ret;
+
+	// failure
+	fail_resample:
+		FREE(buf);
+	fail_buf:
+		lanczos_pool_delete(&pool);
+	return 0;
+}
+
+static int
+check_poolIsotropic2D(cc_rngUniform_t* rng, uint32_t flags,
+                      int32_t a, int32_t channels,
+                      int32_t src_w, int32_t src_h,
+                      int32_t dst_w, int32_t dst_h)
+{
+	return check_pool2D(rng,
+	                    flags | LANCZOS_FLAG_MULTIDIM_2D_ISOTROPIC,
+	                    a, channels, src_w, src_h, dst_w, dst_h);
+}
+
+// compare the 1D resampling with a workspace with the
+// heap resampling where the steady-state call must not
+// allocate from the heap
+static int
+check_workspace1D(cc_rngUniform_t* rng, uint32_t flags,
+                  int32_t a, int32_t channels, int32_t src_w,
+                  int32_t dst_w)
+{
+	int32_t n1 = src_w*channels;
+	int32_t n2 = dst_w*channels;
+
+	float* buf = (float*) CALLOC(n1 + 2*n2, sizeof(float));
+	if(buf == NULL)
+	{
+		LOGE("CALLOC failed");
+		return 0;
+	}
+
+	float* src = buf;
+	float* dst = &buf[n1];
+	float* ref = &buf[n1 + n2];
+	check_random(rng, n1, src);
+
+	lanczos_paramRegular1D_t param =
+	{
+		.flags    = flags,
+		.a        = a,
+		.channels = channels,
+		.src_w    = src_w,
+		.dst_w    = dst_w,
+		.src      = src,
+		.dst      = ref,
+	};
+
+	if(lanczos_resample_regular1D(&param) == 0)
+	{
+		goto fail_resample;
+	}
+
+	size_t size = lanczos_resample_regular1DWorkspace(&param);
+	void*  base = CALLOC(1, size);
+	if(base == NULL)
+	{
+		LOGE("CALLOC failed");
+		goto fail_base;
+	}
+
+	// the first call also performs the one-time
+	// initialization (e.g. the SIMD level)
+	lanczos_workspace_t ws;
+	lanczos_workspace_init(&ws, base, size);
+	param.ws  = &ws;
+	param.dst = dst;
+	if(lanczos_resample_regular1D(&param) == 0)
+	{
+		goto fail_workspace;
+	}
+
+	check_allocs = 0;
+	if(lanczos_resample_regular1D(&param) == 0)
+	{
+		goto fail_workspace;
+	}
+
+	char name[256];
+	snprintf(name, 256, "workspace1D flags=0x%X, a=%i, "
+	         "channels=%i, %i->%i", flags, a, channels,
+	         src_w, dst_w);
+	int ret = check_heap(name);
+	ret &= check_result(name, check_maxError(n2, dst, ref),
+	                    0.0f);
+
+	FREE(base);
+	FREE(buf);
+
+	// success
+	return ret;
+
+	// failure
+	fail_workspace:
+		FREE(base);
+	fail_base:
+	fail_resample:
+		FREE(buf);
+	return 0;
+}
+
+// compare the 2D resampling with a workspace with the
+// heap resampling where the steady-state call must not
+// allocate from the heap
+static int
+check_workspace2D(cc_rngUniform_t* rng, uint32_t flags,
+                  int32_t a, int32_t channels, int32_t src_w,
+                  int32_t src_h, int32_t dst_w, int32_t dst_h)
+{
+	int32_t n1 = src_w*src_h*channels;
+	int32_t n2 = dst_w*dst_h*channels;
+
+	float* buf = (float*) CALLOC(n1 + 2*n2, sizeof(float));
+	if(buf == NULL)
+	{
+		LOGE("CALLOC failed");
+		return 0;
+	}
+
+	float* src = buf;
+	float* dst = &buf[n1];
+	float* ref = &buf[n1 + n2];
+	check_random(rng, n1, src);
+
+	lanczos_paramRegular2D_t param =
+	{
+		.flags    = flags,
+		.a        = a,
+		.channels = channels,
+		.src_w    = src_w,
+		.src_h    = src_h,
+		.dst_w    = dst_w,
+		.dst_h    = dst_h,
+		.src      = src,
+		.dst      = ref,
+	};
+
+	if(lanczos_resample_regular2D(&param) == 0)
+	{
+		goto fail_resample;
+	}
+
+	size_t size = lanczos_resample_regular2DWorkspace(&param);
+	void*  base = CALLOC(1, size);
+	if(base == NULL)
+	{
+		LOGE("CALLOC failed");
+		goto fail_base;
+	}
+
+	lanczos_workspace_t ws;
+	lanczos_workspace_init(&ws, base, size);
+	param.ws  = &ws;
+	param.dst = dst;
+	if(lanczos_resample_regular2D(&param) == 0)
+	{
+		goto fail_workspace;
+	}
+
+	check_allocs = 0;
+	if(lanczos_resample_regular2D(&param) == 0)
+	{
+		goto fail_workspace;
+	}
+
+	char name[256];
+	snprintf(name, 256, "workspace2D flags=0x%X, a=%i, "
+	         "channels=%i, %ix%i->%ix%i", flags, a, channels,
+	         src_w, src_h, dst_w, dst_h);
+	int ret = check_heap(name);
+	ret &= check_result(name, check_maxError(n2, dst, ref),
+	                    0.0f);
+
+	FREE(base);
+	FREE(buf);
+
+	// success
+	return ret;
+
+	// failure
+	fail_workspace:
+		FREE(base);
+	fail_base:
+	fail_resample:
+		FREE(buf);
+	return 0;
+}
+
+static int
+check_workspaceIsotropic2D(cc_rngUniform_t* rng, uint32_t flags,
+                           int32_t a, int32_t channels,
+                           int32_t src_w, int32_t src_h,
+                           int32_t dst_w, int32_t dst_h)
+{
+	return check_workspace2D(rng,
+	                         flags | LANCZOS_FLAG_MULTIDIM_2D_ISOTROPIC,
+	                         a, channels, src_w, src_h, dst_w, dst_h);
+}
+
+// append samples outside of the bins to the samples of
+// the binning pass which must be discarded
+static int
+check_bins1D(cc_rngUniform_t* rng, uint32_t flags,
+             int32_t a, int32_t channels, int32_t dst_w)
+{
+	int32_t stride = 1 + channels;
+	int32_t n1     = (dst_w + 2*a)*3 + 8;
+	int32_t n2     = dst_w*channels;
+
+	float* buf = (float*) CALLOC(stride*n1 + 2*n2,
+	                             sizeof(float));
+	if(buf == NULL)
+	{
+		LOGE("CALLOC failed");
+		return 0;
+	}
+
+	float*  src   = buf;
+	float*  dst   = &buf[stride*n1];
+	float*  ref   = &buf[stride*n1 + n2];
+	int32_t count = check_irregular1DSrc(rng, a, channels, dst_w,
+	                                     1, 3, 0.0f, src);
+	check_shuffle(rng, count, stride, src);
+
+	lanczos_paramIrregular1D_t param =
+	{
+		.flags     = flags,
+		.a         = a,
+		.channels  = channels,
+		.src_count = count,
+		.src_x0    = -1.0f,
+		.src_x1    = 3.0f,
+		.dst_w     = dst_w,
+		.src       = src,
+		.dst       = ref,
+	};
+
+	if(lanczos_resample_irregular1D(&param) == 0)
+	{
+		goto fail_resample;
+	}
+
+	// the bins cover [-a, dst_w + a) in output units
+	int32_t i;
+	float   jf;
+	float*  s;
+	for(i = 0; i < 8; ++i)
+	{
+		jf   = 0.5f + 4.0f*cc_rngUniform_rand1F(rng);
+		jf   = (i%2) ? ((float) (dst_w + a)) + jf :
+		               ((float) -a) - jf;
+		s    = &src[stride*(count + i)];
+		s[0] = -1.0f + 4.0f*jf/((float) dst_w);
+		check_random(rng, channels, &s[1]);
+	}
+	param.src_count = count + 8;
+	param.dst       = dst;
+	if(lanczos_resample_irregular1D(&param) == 0)
+	{
+		goto fail_resample;
+	}
+
+	char name[256];
+	snprintf(name, 256, "bins1D flags=0x%X, a=%i, channels=%i, "
+	         "count=%i, dst_w=%i", flags, a, channels, count,
+	         dst_w);
+	int ret = check_result(name, check_maxError(n2, dst, ref),
+	                       0.0f);
+
+	FREE(buf);
+
+	// success
+	return ret;
+
+	// failure
+	fail_resample:
+		FREE(buf);
+	return 0;
+}
+
+// compare the binning pass of unsorted sparse samples
+// without holes with the reference
+static int
+check_binning1D(cc_rngUniform_t* rng, uint32_t flags,
+                int32_t a, int32_t channels, int32_t dst_w)
+{
+	int32_t stride = 1 + channels;
+	int32_t n1     = (dst_w + 2*a)*3;
+	int32_t n2     = dst_w*channels;
+
+	float* buf = (float*) CALLOC(stride*n1 + 2*n2,
+	                             sizeof(float));
+	if(buf == NULL)
+	{
+		LOGE("CALLOC failed");
+		return 0;
+	}
+
+	float*  src   = buf;
+	float*  dst   = &buf[stride*n1];
+	float*  ref   = &buf[stride*n1 + n2];
+	int32_t count = check_irregular1DSrc(rng, a, channels, dst_w,
+	                                     1, 3, 0.0f, src);
+	check_shuffle(rng, count, stride, src);
+
+	lanczos_paramIrregular1D_t param =
+	{
+		.flags     = flags,
+		.a         = a,
+		.channels  = channels,
+		.src_count = count,
+		.src_x0    = -1.0f,
+		.src_x1    = 3.0f,
+		.dst_w     = dst_w,
+		.src       = src,
+		.dst       = dst,
+	};
+
+	if((lanczos_resample_irregular1D(&param) == 0) ||
+	   (check_irregular1DRef(&param, ref) == 0))
+	{
+		goto fail_resample;
+	}
+
+	char name[256];
+	snprintf(name, 256, "binning1D flags=0x%X, a=%i, "
+	         "channels=%i, count=%i, dst_w=%i", flags, a,
+	         channels, count, dst_w);
+	int ret = check_result(name, check_maxError(n2, dst, ref),
+	                       CHECK_IRREGULAR_EPSILON);
+
+	FREE(buf);
+
+	// success
+	return ret;
+
+	// failure
+	fail_resample:
+		FREE(buf);
+	return 0;
+}
+
+// compare the hole filling of the binning pass for
+// unsorted sparse samples with the reference
+static int
+check_holes1D(cc_rngUniform_t* rng, uint32_t flags,
+              int32_t a, int32_t channels, int32_t dst_w)
+{
+	int32_t stride = 1 + channels;
+	int32_t n1     = (dst_w + 2*a)*3;
+	int32_t n2     = dst_w*channels;
+
+	float* buf = (float*) CALLOC(stride*n1 + 2*n2,
+	                             sizeof(float));
+	if(buf == NULL)
+	{
+		LOGE("CALLOC failed");
+		return 0;
+	}
+
+	float*  src   = buf;
+	float*  dst   = &buf[stride*n1];
+	float*  ref   = &buf[stride*n1 + n2];
+	int32_t count = check_irregular1DSrc(rng, a, channels, dst_w,
+	                                     1, 3, 0.25f, src);
+	check_shuffle(rng, count, stride, src);
+
+	lanczos_paramIrregular1D_t param =
+	{
+		.flags     = flags,
+		.a         = a,
+		.channels  = channels,
+		.src_count = count,
+		.src_x0    = -1.0f,
+		.src_x1    = 3.0f,
+		.dst_w     = dst_w,
+		.src       = src,
+		.dst       = dst,
+	};
+
+	if((lanczos_resample_irregular1D(&param) == 0) ||
+	   (check_irregular1DRef(&param, ref) == 0))
+	{
+		goto fail_resample;
+	}
+
+	char name[256];
+	snprintf(name, 256, "holes1D flags=0x%X, a=%i, "
+	         "channels=%i, count=%i, dst_w=%i", flags, a,
+	         channels, count, dst_w);
+	int ret = check_result(name, check_maxError(n2, dst, ref),
+	                       CHECK_IRREGULAR_EPSILON);
+
+	FREE(buf);
+
+	// success
+	return ret;
+
+	// failure
+	fail_resample:
+		FREE(buf);
+	return 0;
+}
+
+// compare the scatter engine of unsorted dense samples
+// (serial and pooled) with the reference where the pooled
+// outputs must not depend on the thread scheduling
+static int
+check_scatter1D(cc_rngUniform_t* rng, uint32_t flags,
+                int32_t a, int32_t channels, int32_t dst_w)
+{
+	int32_t stride = 1 + channels;
+	int32_t n1     = (dst_w + 2*a)*16;
+	int32_t n2     = dst_w*channels;
+
+	lanczos_pool_t* pool = lanczos_pool_new(4);
+	if(pool == NULL)
+	{
+		return 0;
+	}
+
+	float* buf = (float*) CALLOC(stride*n1 + 3*n2,
+	                             sizeof(float));
+	if(buf == NULL)
+	{
+		LOGE("CALLOC failed");
+		goto fail_buf;
+	}
+
+	float*  src   = buf;
+	float*  dst   = &buf[stride*n1];
+	float*  ref   = &buf[stride*n1 + n2];
+	float*  det   = &buf[stride*n1 + 2*n2];
+	int32_t count = check_irregular1DSrc(rng, a, channels, dst_w,
+	                                     10, 16, 0.1f, src);
+	check_shuffle(rng, count, stride, src);
+
+	lanczos_paramIrregular1D_t param =
+	{
+		.flags     = flags,
+		.a         = a,
+		.channels  = channels,
+		.src_count = count,
+		.src_x0    = -1.0f,
+		.src_x1    = 3.0f,
+		.dst_w     = dst_w,
+		.src       = src,
+		.dst       = dst,
+	};
+
+	if((lanczos_resample_irregular1D(&param) == 0) ||
+	   (check_irregular1DRef(&param, ref) == 0))
+	{
+		goto fail_resample;
+	}
+
+	char name[256];
+	snprintf(name, 256, "scatter1D flags=0x%X, a=%i, "
+	         "channels=%i, count=%i, dst_w=%i", flags, a,
+	         channels, count, dst_w);
+	int ret = check_result(name, check_maxError(n2, dst, ref),
+	                       CHECK_IRREGULAR_EPSILON);
+
+	param.pool = pool;
+	if(lanczos_resample_irregular1D(&param) == 0)
+	{
+		goto fail_resample;
+	}
+
+	strncat(name, " pool", 256 - strlen(name) - 1);
+	ret &= check_result(name, check_maxError(n2, dst, ref),
+	                    CHECK_IRREGULAR_EPSILON);
+
+	int i;
+	param.dst = det;
+	for(i = 0; i < 4; ++i)
+	{
+		if(lanczos_resample_irregular1D(&param) == 0)
+		{
+			goto fail_resample;
+		}
+
+		if(memcmp(det, dst, n2*sizeof(float)) != 0)
+		{
+			LOGE("%s: not deterministic", name);
+			ret = 0;
+			break;
+		}
+	}
+
+	FREE(buf);
+	lanczos_pool_delete(&pool);
+
+	// success
+	return ret;
+
+	// failure
+	fail_resample:
+		FREE(buf);
+	fail_buf:
+		lanczos_pool_delete(&pool);
+	return 0;
+}
+
+// compare the sorted path of sparse and dense samples with
+// holes (detected and asserted by SRC_SORTED) with the
+// reference and with the engines of the shuffled samples
+static int
+check_sorted1D(cc_rngUniform_t* rng, uint32_t flags,
+               int32_t a, int32_t channels, int32_t dst_w)
+{
+	int32_t stride = 1 + channels;
+	int32_t n1     = (dst_w + 2*a)*16;
+	int32_t n2     = dst_w*channels;
+
+	float* buf = (float*) CALLOC(2*stride*n1 + 3*n2,
+	                             sizeof(float));
+	if(buf == NULL)
+	{
+		LOGE("CALLOC failed");
+		return 0;
+	}
+
+	float* src = buf;
+	float* shf = &buf[stride*n1];
+	float* dst = &buf[2*stride*n1];
+	float* ref = &buf[2*stride*n1 + n2];
+	float* uns = &buf[2*stride*n1 + 2*n2];
+
+	// sparse samples select the binning engine and dense
+	// samples select the scatter engine when unsorted
+	char    name[256];
+	int32_t count;
+	int32_t dense;
+	int     ret = 1;
+	for(dense = 0; dense <= 1; ++dense)
+	{
+		count = check_irregular1DSrc(rng, a, channels, dst_w,
+		                             dense ? 10 : 1,
+		                             dense ? 16 : 3,
+		                             dense ? 0.1f : 0.25f, src);
+		memcpy(shf, src, stride*count*sizeof(float));
+		check_shuffle(rng, count, stride, shf);
+
+		lanczos_paramIrregular1D_t param =
+		{
+			.flags     = flags,
+			.a         = a,
+			.channels  = channels,
+			.src_count = count,
+			.src_x0    = -1.0f,
+			.src_x1    = 3.0f,
+			.dst_w     = dst_w,
+			.src       = src,
+			.dst       = dst,
+		};
+
+		if((lanczos_resample_irregular1D(&param) == 0) ||
+		   (check_irregular1DRef(&param, ref) == 0))
+		{
+			goto fail_resample;
+		}
+
+		snprintf(name, 256, "sorted1D flags=0x%X, a=%i, "
+		         "channels=%i, count=%i, dst_w=%i", flags, a,
+		         channels, count, dst_w);
+		ret &= check_result(name, check_maxError(n2, dst, ref),
+		                    CHECK_IRREGULAR_EPSILON);
+
+		param.src = shf;
+		param.dst = uns;
+		if(lanczos_resample_irregular1D(&param) == 0)
+		{
+			goto fail_resample;
+		}
+
+		strncat(name, " unsorted", 256 - strlen(name) - 1);
+		ret &= check_result(name, check_maxError(n2, uns, dst),
+		                    CHECK_IRREGULAR_EPSILON);
+
+		param.flags = flags | LANCZOS_FLAG_SRC_SORTED;
+		param.src   = src;
+		if(lanczos_resample_irregular1D(&param) == 0)
+		{
+			goto fail_resample;
+		}
+
+		snprintf(name, 256, "sorted1D flags=0x%X, a=%i, "
+		         "channels=%i, count=%i, dst_w=%i", param.flags,
+		         a, channels, count, dst_w);
+		ret &= check_result(name, check_maxError(n2, uns, dst),
+		                    0.0f);
+	}
+
+	FREE(buf);
+
+	// success
+	return ret;
+
+	// failure
+	fail_resample:
+		FREE(buf);
+	return 0;
+}
+
+// insert and remove batches of samples with holes into the
+// gridder and compare each flush with the resampling of the
+// remaining samples (in insertion order)
+static int
+check_gridder1D(cc_rngUniform_t* rng, uint32_t flags,
+                int32_t a, int32_t channels, int32_t dst_w)
+{
+	int32_t stride = 1 + channels;
+	int32_t n1     = dst_w + 2*a;
+	int32_t n2     = dst_w*channels;
+
+	float* buf = (float*) CALLOC(3*stride*n1 + 2*n2,
+	                             sizeof(float));
+	if(buf == NULL)
+	{
+		LOGE("CALLOC failed");
+		return 0;
+	}
+
+	// a single sample per bin such that the removals leave
+	// holes rather than ill conditioned bins
+	float*  src   = buf;
+	float*  set   = &buf[stride*n1];
+	float*  rem   = &buf[2*stride*n1];
+	float*  dst   = &buf[3*stride*n1];
+	float*  ref   = &buf[3*stride*n1 + n2];
+	int32_t count = check_irregular1DSrc(rng, a, channels, dst_w,
+	                                     1, 1, 0.25f, src);
+	check_shuffle(rng, count, stride, src);
+
+	lanczos_gridder1D_t* gridder;
+	gridder = lanczos_gridder1D_new(flags, a, channels, -1.0f,
+	                                3.0f, dst_w);
+	if(gridder == NULL)
+	{
+		goto fail_gridder;
+	}
+
+	lanczos_paramIrregular1D_t param =
+	{
+		.flags     = flags,
+		.a         = a,
+		.channels  = channels,
+		.src_x0    = -1.0f,
+		.src_x1    = 3.0f,
+		.dst_w     = dst_w,
+		.src       = set,
+		.dst       = ref,
+	};
+
+	// insert a quarter of the samples and remove an eighth
+	// of the remaining samples per update
+	char    name[256];
+	int32_t next = 0;
+	int32_t live = 0;
+	int32_t n;
+	int32_t update;
+	int     ret = 1;
+	for(update = 0; update < 6; ++update)
+	{
+		n = count/4 + 1;
+		if(n > count - next)
+		{
+			n = count - next;
+		}
+		memcpy(&set[stride*live], &src[stride*next],
+		       stride*n*sizeof(float));
+		if(lanczos_gridder1D_insert(gridder, n,
+		                            &set[stride*live]) == 0)
+		{
+			goto fail_update;
+		}
+		next += n;
+		live += n;
+
+		n = check_remove(rng, live/8, stride, &live, set, rem);
+		if(lanczos_gridder1D_remove(gridder, n, rem) == 0)
+		{
+			goto fail_update;
+		}
+
+		param.src_count = live;
+		if((lanczos_gridder1D_flush(gridder, dst) == 0) ||
+		   (lanczos_resample_irregular1D(&param) == 0))
+		{
+			goto fail_update;
+		}
+
+		snprintf(name, 256, "gridder1D flags=0x%X, a=%i, "
+		         "channels=%i, count=%i, dst_w=%i", flags, a,
+		         channels, live, dst_w);
+		ret &= check_result(name, check_maxError(n2, dst, ref),
+		                    CHECK_IRREGULAR_EPSILON);
+	}
+
+	lanczos_gridder1D_delete(&gridder);
+	FREE(buf);
+
+	// success
+	return ret;
+
+	// failure
+	fail_update:
+		lanczos_gridder1D_delete(&gridder);
+	fail_gridder:
+		FREE(buf);
+	return 0;
+}
+
+// compare the irregular 1D engines (binning, sorted and
+// scatter) with a workspace with the heap resampling where
+// the steady-state call must not allocate from the heap
+static int
+check_workspaceIrregular1D(cc_rngUniform_t* rng,
+                           uint32_t flags, int32_t a,
+                           int32_t channels, int32_t dst_w)
+{
+	int32_t stride = 1 + channels;
+	int32_t n1     = (dst_w + 2*a)*16;
+	int32_t n2     = dst_w*channels;
+
+	float* buf = (float*) CALLOC(stride*n1 + 2*n2,
+	                             sizeof(float));
+	if(buf == NULL)
+	{
+		LOGE("CALLOC failed");
+		return 0;
+	}
+
+	float* src = buf;
+	float* dst = &buf[stride*n1];
+	float* ref = &buf[stride*n1 + n2];
+
+	// engines in the order binning, sorted and scatter
+	char                name[256];
+	int32_t             count;
+	int32_t             engine;
+	size_t              size;
+	void*               base;
+	lanczos_workspace_t ws;
+	int                 ret = 1;
+	for(engine = 0; engine < 3; ++engine)
+	{
+		count = check_irregular1DSrc(rng, a, channels, dst_w,
+		                             (engine == 2) ? 10 : 1,
+		                             (engine == 2) ? 16 : 3,
+		                             0.1f, src);
+		if(engine != 1)
+		{
+			check_shuffle(rng, count, stride, src);
+		}
+
+		lanczos_paramIrregular1D_t param =
+		{
+			.flags     = flags,
+			.a         = a,
+			.channels  = channels,
+			.src_count = count,
+			.src_x0    = -1.0f,
+			.src_x1    = 3.0f,
+			.dst_w     = dst_w,
+			.src       = src,
+			.dst       = ref,
+		};
+
+		if(lanczos_resample_irregular1D(&param) == 0)
+		{
+			goto fail_resample;
+		}
+
+		size = lanczos_resample_irregular1DWorkspace(&param);
+		base = CALLOC(1, size);
+		if(base == NULL)
+		{
+			LOGE("CALLOC failed");
+			goto fail_resample;
+		}
+
+		lanczos_workspace_init(&ws, base, size);
+		param.ws  = &ws;
+		param.dst = dst;
+		if(lanczos_resample_irregular1D(&param) == 0)
+		{
+			goto fail_workspace;
+		}
+
+		check_allocs = 0;
+		if(lanczos_resample_irregular1D(&param) == 0)
+		{
+			goto fail_workspace;
+		}
+
+		snprintf(name, 256, "workspaceIrregular1D flags=0x%X, "
+		         "a=%i, channels=%i, count=%i, dst_w=%i", flags,
+		         a, channels, count, dst_w);
+		ret &= check_heap(name);
+		ret &= check_result(name, check_maxError(n2, dst, ref),
+		                    0.0f);
+
+		FREE(base);
+	}
+
+	FREE(buf);
+
+	// success
+	return ret;
+
+	// failure
+	fail_workspace:
+		FREE(base);
+	fail_resample:
+		FREE(buf);
+	return 0;
+}
+
+// compare the uniform grid resampling of samples with
+// holes with the reference where the pooled resampling
+// must be identical to the serial resampling
+static int
+check_grid2D(cc_rngUniform_t* rng, uint32_t flags,
+             int32_t a, int32_t channels, int32_t dst_w,
+             int32_t dst_h)
+{
+	int32_t stride = 2 + channels;
+	int32_t n1     = (dst_w + 2*a)*(dst_h + 2*a);
+	int32_t n2     = dst_w*dst_h*channels;
+
+	lanczos_pool_t* pool = lanczos_pool_new(4);
+	if(pool == NULL)
+	{
+		return 0;
+	}
+
+	float* buf = (float*) CALLOC(stride*n1 + 3*n2,
+	                             sizeof(float));
+	if(buf == NULL)
+	{
+		LOGE("CALLOC failed");
+		goto fail_buf;
+	}
+
+	float*  src   = buf;
+	float*  dst   = &buf[stride*n1];
+	float*  ref   = &buf[stride*n1 + n2];
+	float*  par   = &buf[stride*n1 + 2*n2];
+	int32_t count = check_irregular2DSrc(rng, a, channels, dst_w,
+	                                     dst_h, 1, 1, 0.25f, src);
+	check_shuffle(rng, count, stride, src);
+
+	lanczos_paramIrregular2D_t param =
+	{
+		.flags     = flags,
+		.a         = a,
+		.channels  = channels,
+		.src_count = count,
+		.src_x0    = 0.0f,
+		.src_y0    = -1.0f,
+		.src_x1    = 2.0f,
+		.src_y1    = 1.0f,
+		.dst_w     = dst_w,
+		.dst_h     = dst_h,
+		.src       = src,
+		.dst       = dst,
+	};
+
+	if((lanczos_resample_irregular2D(&param) == 0) ||
+	   (check_irregular2DRef(&param, ref) == 0))
+	{
+		goto fail_resample;
+	}
+
+	param.pool = pool;
+	param.dst  = par;
+	if(lanczos_resample_irregular2D(&param) == 0)
+	{
+		goto fail_resample;
+	}
+
+	char name[256];
+	snprintf(name, 256, "grid2D flags=0x%X, a=%i, channels=%i, "
+	         "count=%i, dst=%ix%i", flags, a, channels, count,
+	         dst_w, dst_h);
+	int ret = check_result(name, check_maxError(n2, dst, ref),
+	                       CHECK_IRREGULAR_EPSILON);
+
+	strncat(name, " pool", 256 - strlen(name) - 1);
+	ret &= check_result(name, check_maxError(n2, par, dst),
+	                    0.0f);
+
+	FREE(buf);
+	lanczos_pool_delete(&pool);
+
+	// success
+	return ret;
+
+	// failure
+	fail_resample:
+		FREE(buf);
+	fail_buf:
+		lanczos_pool_delete(&pool);
+	return 0;
+}
+
+// compare the adaptive index (k-d tree) resampling of
+// clustered samples with holes with the uniform grid and
+// the reference where the pooled resampling must be
+// identical to the serial resampling
+static int
+check_adaptive2D(cc_rngUniform_t* rng, uint32_t flags,
+                 int32_t a, int32_t channels, int32_t dst_w,
+                 int32_t dst_h)
+{
+	int32_t stride = 2 + channels;
+	int32_t n1     = (dst_w + 2*a)*(dst_h + 2*a)*16;
+	int32_t n2     = dst_w*dst_h*channels;
+
+	lanczos_pool_t* pool = lanczos_pool_new(4);
+	if(pool == NULL)
+	{
+		return 0;
+	}
+
+	float* buf = (float*) CALLOC(stride*n1 + 4*n2,
+	                             sizeof(float));
+	if(buf == NULL)
+	{
+		LOGE("CALLOC failed");
+		goto fail_buf;
+	}
+
+	// the density compensation of the isotropic kernel is
+	// ill conditioned at the boundary of the cluster
+	int32_t cluster = 4;
+	if(flags & LANCZOS_FLAG_MULTIDIM_2D_ISOTROPIC)
+	{
+		cluster = 1;
+	}
+
+	float*  src   = buf;
+	float*  dst   = &buf[stride*n1];
+	float*  ref   = &buf[stride*n1 + n2];
+	float*  uni   = &buf[stride*n1 + 2*n2];
+	float*  par   = &buf[stride*n1 + 3*n2];
+	int32_t count = check_irregular2DSrc(rng, a, channels, dst_w,
+	                                     dst_h, 1, cluster, 0.25f,
+	                                     src);
+	check_shuffle(rng, count, stride, src);
+
+	lanczos_paramIrregular2D_t param =
+	{
+		.flags     = flags,
+		.a         = a,
+		.channels  = channels,
+		.src_count = count,
+		.src_x0    = 0.0f,
+		.src_y0    = -1.0f,
+		.src_x1    = 2.0f,
+		.src_y1    = 1.0f,
+		.dst_w     = dst_w,
+		.dst_h     = dst_h,
+		.src       = src,
+		.dst       = uni,
+	};
+
+	if((lanczos_resample_irregular2D(&param) == 0) ||
+	   (check_irregular2DRef(&param, ref) == 0))
+	{
+		goto fail_resample;
+	}
+
+	param.flags = flags | LANCZOS_FLAG_INDEX_ADAPTIVE;
+	param.dst   = dst;
+	if(lanczos_resample_irregular2D(&param) == 0)
+	{
+		goto fail_resample;
+	}
+
+	param.pool = pool;
+	param.dst  = par;
+	if(lanczos_resample_irregular2D(&param) == 0)
+	{
+		goto fail_resample;
+	}
+
+	char base[192];
+	char name[256];
+	snprintf(base, 192, "adaptive2D flags=0x%X, a=%i, "
+	         "channels=%i, count=%i, dst=%ix%i", flags, a,
+	         channels, count, dst_w, dst_h);
+	snprintf(name, 256, "%s", base);
+	int ret = check_result(name, check_maxError(n2, dst, ref),
+	                       CHECK_IRREGULAR_EPSILON);
+
+	snprintf(name, 256, "%s uniform", base);
+	ret &= check_result(name, check_maxError(n2, uni, dst),
+	                    CHECK_IRREGULAR_EPSILON);
+
+	snprintf(name, 256, "%s pool", base);
+	ret &= check_result(name, check_maxError(n2, par, dst),
+	                    0.0f);
+
+	FREE(buf);
+	lanczos_pool_delete(&pool);
+
+	// success
+	return ret;
+
+	// failure
+	fail_resample:
+		FREE(buf);
+	fail_buf:
+		lanczos_pool_delete(&pool);
+	return 0;
+}
+
+// insert and remove batches of samples with holes into the
+// gridder and compare each flush with the resampling of the
+// remaining samples (in insertion order)
+static int
+check_gridder2D(cc_rngUniform_t* rng, uint32_t flags,
+                int32_t a, int32_t channels, int32_t dst_w,
+                int32_t dst_h)
+{
+	int32_t stride = 2 + channels;
+	int32_t n1     = (dst_w + 2*a)*(dst_h + 2*a);
+	int32_t n2     = dst_w*dst_h*channels;
+
+	float* buf = (float*) CALLOC(3*stride*n1 + 2*n2,
+	                             sizeof(float));
+	if(buf == NULL)
+	{
+		LOGE("CALLOC failed");
+		return 0;
+	}
+
+	float*  src   = buf;
+	float*  set   = &buf[stride*n1];
+	float*  rem   = &buf[2*stride*n1];
+	float*  dst   = &buf[3*stride*n1];
+	float*  ref   = &buf[3*stride*n1 + n2];
+	int32_t count = check_irregular2DSrc(rng, a, channels, dst_w,
+	                                     dst_h, 1, 1, 0.25f, src);
+	check_shuffle(rng, count, stride, src);
+
+	lanczos_gridder2D_t* gridder;
+	gridder = lanczos_gridder2D_new(flags, a, channels, 0.0f,
+	                                -1.0f, 2.0f, 1.0f, dst_w,
+	                                dst_h);
+	if(gridder == NULL)
+	{
+		goto fail_gridder;
+	}
+
+	lanczos_paramIrregular2D_t param =
+	{
+		.flags     = flags,
+		.a         = a,
+		.channels  = channels,
+		.src_x0    = 0.0f,
+		.src_y0    = -1.0f,
+		.src_x1    = 2.0f,
+		.src_y1    = 1.0f,
+		.dst_w     = dst_w,
+		.dst_h     = dst_h,
+		.src       = set,
+		.dst       = ref,
+	};
+
+	// insert a quarter of the samples and remove an eighth
+	// of the remaining samples per update
+	char    name[256];
+	int32_t next = 0;
+	int32_t live = 0;
+	int32_t n;
+	int32_t update;
+	int     ret = 1;
+	for(update = 0; update < 6; ++update)
+	{
+		n = count/4 + 1;
+		if(n > count - next)
+		{
+			n = count - next;
+		}
+		memcpy(&set[stride*live], &src[stride*next],
+		       stride*n*sizeof(float));
+		if(lanczos_gridder2D_insert(gridder, n,
+		                            &set[stride*live]) == 0)
+		{
+			goto fail_update;
+		}
+		next += n;
+		live += n;
+
+		n = check_remove(rng, live/8, stride, &live, set, rem);
+		if(lanczos_gridder2D_remove(gridder, n, rem) == 0)
+		{
+			goto fail_update;
+		}
+
+		param.src_count = live;
+		if((lanczos_gridder2D_flush(gridder, dst) == 0) ||
+		   (lanczos_resample_irregular2D(&param) == 0))
+		{
+			goto fail_update;
+		}
+
+		snprintf(name, 256, "gridder2D flags=0x%X, a=%i, "
+		         "channels=%i, count=%i, dst=%ix%i", flags, a,
+		         channels, live, dst_w, dst_h);
+		ret &= check_result(name, check_maxError(n2, dst, ref),
+		                    CHECK_IRREGULAR_EPSILON);
+	}
+
+	lanczos_gridder2D_delete(&gridder);
+	FREE(buf);
+
+	// success
+	return ret;
+
+	// failure
+	fail_update:
+		lanczos_gridder2D_delete(&gridder);
+	fail_gridder:
+		FREE(buf);
+	return 0;
+}
+
+// compare the irregular 2D indices (uniform grid and
+// k-d tree) with a workspace with the heap resampling where
+// the steady-state call must not allocate from the heap
+static int
+check_workspaceIrregular2D(cc_rngUniform_t* rng,
+                           uint32_t flags, int32_t a,
+                           int32_t channels, int32_t dst_w,
+                           int32_t dst_h)
+{
+	int32_t stride = 2 + channels;
+	int32_t n1     = (dst_w + 2*a)*(dst_h + 2*a);
+	int32_t n2     = dst_w*dst_h*channels;
+
+	float* buf = (float*) CALLOC(stride*n1 + 2*n2,
+	                             sizeof(float));
+	if(buf == NULL)
+	{
+		LOGE("CALLOC failed");
+		return 0;
+	}
+
+	float*  src   = buf;
+	float*  dst   = &buf[stride*n1];
+	float*  ref   = &buf[stride*n1 + n2];
+	int32_t count = check_irregular2DSrc(rng, a, channels, dst_w,
+	                                     dst_h, 1, 1, 0.25f, src);
+	check_shuffle(rng, count, stride, src);
+
+	char                name[256];
+	int32_t             adaptive;
+	size_t              size;
+	void*               base;
+	lanczos_workspace_t ws;
+	int                 ret = 1;
+	for(adaptive = 0; adaptive <= 1; ++adaptive)
+	{
+		lanczos_paramIrregular2D_t param =
+		{
+			.flags     = adaptive ?
+			             (flags | LANCZOS_FLAG_INDEX_ADAPTIVE) :
+			             flags,
+			.a         = a,
+			.channels  = channels,
+			.src_count = count,
+			.src_x0    = 0.0f,
+			.src_y0    = -1.0f,
+			.src_x1    = 2.0f,
+			.src_y1    = 1.0f,
+			.dst_w     = dst_w,
+			.dst_h     = dst_h,
+			.src       = src,
+			.dst       = ref,
+		};
+
+		if(lanczos_resample_irregular2D(&param) == 0)
+		{
+			goto fail_resample;
+		}
+
+		size = lanczos_resample_irregular2DWorkspace(&param);
+		base = CALLOC(1, size);
+		if(base == NULL)
+		{
+			LOGE("CALLOC failed");
+			goto fail_resample;
+		}
+
+		lanczos_workspace_init(&ws, base, size);
+		param.ws  = &ws;
+		param.dst = dst;
+		if(lanczos_resample_irregular2D(&param) == 0)
+		{
+			goto fail_workspace;
+		}
+
+		check_allocs = 0;
+		if(lanczos_resample_irregular2D(&param) == 0)
+		{
+			goto fail_workspace;
+		}
+
+		snprintf(name, 256, "workspaceIrregular2D flags=0x%X, "
+		         "a=%i, channels=%i, count=%i, dst=%ix%i",
+		         param.flags, a, channels, count, dst_w, dst_h);
+		ret &= check_heap(name);
+		ret &= check_result(name, check_maxError(n2, dst, ref),
+		                    0.0f);
+
+		FREE(base);
+	}
+
+	FREE(buf);
+
+	// success
+	return ret;
+
+	// failure
+	fail_workspace:
+		FREE(base);
+	fail_resample:
+		FREE(buf);
+	return 0;
+}
+
+// compare lanczos_stream1D_t with lanczos_resample_regular1D
+// where the samples are pushed in chunks of random size
+static int
+check_stream1D(cc_rngUniform_t* rng, uint32_t flags,
+               int32_t a, int32_t channels, int32_t src_w,
+               int32_t dst_w)
+{
+	lanczos_stream1D_t* stream;
+	stream = lanczos_stream1D_new(flags, a, channels, src_w,
+	                              dst_w);
+	if(stream == NULL)
+	{
+		return 0;
+	}
+
+	int32_t n1 = src_w*channels;
+	int32_t n2 = dst_w*channels;
+	int32_t n3 = lanczos_stream1D_maxOutputs(stream, src_w)*
+	             channels;
+
+	float* buf = (float*) CALLOC(n1 + n2 + n3, sizeof(float));
+	if(buf == NULL)
+	{
+		LOGE("CALLOC failed");
+		goto fail_buf;
+	}
+
+	float* src = buf;
+	float* ref = &buf[n1];
+	float* dst = &buf[n1 + n2];
+	check_random(rng, n1, src);
+
+	lanczos_paramRegular1D_t param =
+	{
+		.flags    = flags,
+		.a        = a,
+		.channels = channels,
+		.src_w    = src_w,
+		.dst_w    = dst_w,
+		.src      = src,
+		.dst      = ref,
+	};
+
+	if(lanczos_resample_regular1D(&param) == 0)
+	{
+		goto fail_resample;
+	}
+
+	int32_t i = 0;
+	int32_t count;
+	int32_t outputs = 0;
+	while(i < src_w)
+	{
+		count = 1 + (int32_t) (64.0f*cc_rngUniform_rand1F(rng));
+		if(count > src_w - i)
+		{
+			count = src_w - i;
+		}
+
+		outputs += lanczos_stream1D_push(stream, count,
+		                                 &src[i*channels],
+		                                 &dst[outputs*channels]);
+		i += count;
+	}
+	outputs += lanczos_stream1D_flush(stream,
+	                                  &dst[outputs*channels]);
+
+	char name[256];
+	snprintf(name, 256, "stream1D flags=0x%X, a=%i, channels=%i, "
+	         "%i->%i", flags, a, channels, src_w, dst_w);
+	int ret = 0;
+	if(outputs != dst_w)
+	{
+		LOGE("%s: outputs=%i", name, outputs);
+	}
+	else
+	{
+		ret = check_result(name, check_maxError(n2, dst, ref),
+		                   0.0f);
+	}
+
+	FREE(buf);
+	lanczos_stream1D_delete(&stream);
+
+	// success
+	return ret;
+
+	// failure
+	fail_resample:
+		FREE(buf);
+	fail_buf:
+		lanczos_stream1D_delete(&stream);
+	return 0;
+}
+
+// compare lanczos_stream2D_t with lanczos_resample_regular2D
+// where the rows are pushed in strips of random size
+static int
+check_stream2D(cc_rngUniform_t* rng, uint32_t flags,
+               int32_t a, int32_t channels, int32_t src_w,
+               int32_t src_h, int32_t dst_w, int32_t dst_h)
+{
+	lanczos_stream2D_t* stream;
+	stream = lanczos_stream2D_new(NULL, flags, a, channels,
+	                              src_w, src_h, dst_w, dst_h);
+	if(stream == NULL)
+	{
+		return 0;
+	}
+
+	int32_t n1 = src_w*src_h*channels;
+	int32_t n2 = dst_w*dst_h*channels;
+
+	float* buf = (float*) CALLOC(n1 + 2*n2, sizeof(float));
+	if(buf == NULL)
+	{
+		LOGE("CALLOC failed");
+		goto fail_buf;
+	}
+
+	float* src = buf;
+	float* ref = &buf[n1];
+	float* dst = &buf[n1 + n2];
+	check_random(rng, n1, src);
+
+	lanczos_paramRegular2D_t param =
+	{
+		.flags    = flags,
+		.a        = a,
+		.channels = channels,
+		.src_w    = src_w,
+		.src_h    = src_h,
+		.dst_w    = dst_w,
+		.dst_h    = dst_h,
+		.src      = src,
+		.dst      = ref,
+	};
+
+	if(lanczos_resample_regular2D(&param) == 0)
+	{
+		goto fail_resample;
+	}
+
+	int32_t y    = 0;
+	int32_t rows = 0;
+	int32_t count;
+	while(y < src_h)
+	{
+		count = 1 + (int32_t) (16.0f*cc_rngUniform_rand1F(rng));
+		if(count > src_h - y)
+		{
+			count = src_h - y;
+		}
+
+		rows += lanczos_stream2D_push(stream, count,
+		                              &src[y*src_w*channels],
+		                              &dst[rows*dst_w*channels]);
+		y += count;
+	}
+
+	char name[256];
+	snprintf(name, 256, "stream2D flags=0x%X, a=%i, channels=%i, "
+	         "%ix%i->%ix%i", flags, a, channels,
+	         src_w, src_h, dst_w, dst_h);
+	int ret = 0;
+	if(rows != dst_h)
+	{
+		LOGE("%s: rows=%i", name, rows);
+	}
+	else
+	{
+		ret = check_result(name, check_maxError(n2, dst, ref),
+		                   0.0f);
+	}
+
+	FREE(buf);
+	lanczos_stream2D_delete(&stream);
+
+	// success
+	return ret;
+
+	// failure
+	fail_resample:
+		FREE(buf);
+	fail_buf:
+		lanczos_stream2D_delete(&stream);
+	return 0;
+}
+
+// compare lanczos_resample_raster2D (serial and pooled)
+// with lanczos_resample_regular2D where the small tiles
+// exercise the tile boundaries
+static int
+check_raster2D(cc_rngUniform_t* rng, uint32_t flags,
+               int32_t a, int32_t channels, int32_t src_w,
+               int32_t src_h, int32_t dst_w, int32_t dst_h)
+{
+	const char* src_fname = "check-src.raw";
+	const char* dst_fname = "check-dst.raw";
+
+	int32_t n1 = src_w*src_h*channels;
+	int32_t n2 = dst_w*dst_h*channels;
+
+	lanczos_pool_t* pool = lanczos_pool_new(4);
+	if(pool == NULL)
+	{
+		return 0;
+	}
+
+	float* buf = (float*) CALLOC(n1 + 2*n2, sizeof(float));
+	if(buf == NULL)
+	{
+		LOGE("CALLOC failed");
+		goto fail_buf;
+	}
+
+	float* src = buf;
+	float* ref = &buf[n1];
+	float* dst = &buf[n1 + n2];
+	check_random(rng, n1, src);
+
+	lanczos_paramRegular2D_t param =
+	{
+		.flags    = flags,
+		.a        = a,
+		.channels = channels,
+		.src_w    = src_w,
+		.src_h    = src_h,
+		.dst_w    = dst_w,
+		.dst_h    = dst_h,
+		.src      = src,
+		.dst      = ref,
+	};
+
+	if(lanczos_resample_regular2D(&param) == 0)
+	{
+		goto fail_resample;
+	}
+
+	FILE* f = fopen(src_fname, "w");
+	if(f == NULL)
+	{
+		LOGE("fopen %s failed", src_fname);
+		goto fail_resample;
+	}
+
+	if(fwrite(src, sizeof(float), n1, f) != n1)
+	{
+		LOGE("fwrite %s failed", src_fname);
+		fclose(f);
+		goto fail_raster;
+	}
+	fclose(f);
+
+	lanczos_paramRaster2D_t raster =
+	{
+		.flags     = flags,
+		.a         = a,
+		.channels  = channels,
+		.src_w     = src_w,
+		.src_h     = src_h,
+		.dst_w     = dst_w,
+		.dst_h     = dst_h,
+		.src_fname = src_fname,
+		.dst_fname = dst_fname,
+		.tile_w    = 16,
+		.tile_h    = 16,
+	};
+
+	// the serial and pooled resampling
+	char name[256];
+	int  ret = 1;
+	int  pass;
+	for(pass = 0; pass < 2; ++pass)
+	{
+		raster.pool = pass ? pool : NULL;
+		if(lanczos_resample_raster2D(&raster) == 0)
+		{
+			goto fail_raster;
+		}
+
+		f = fopen(dst_fname, "r");
+		if(f == NULL)
+		{
+			LOGE("fopen %s failed", dst_fname);
+			goto fail_raster;
+		}
+
+		if(fread(dst, sizeof(float), n2, f) != n2)
+		{
+			LOGE("fread %s failed", dst_fname);
+			fclose(f);
+			goto fail_raster;
+		}
+		fclose(f);
+
+		snprintf(name, 256, "raster2D flags=0x%X, a=%i, "
+		         "channels=%i, %ix%i->%ix%i%s", flags, a,
+		         channels, src_w, src_h, dst_w, dst_h,
+		         pass ? " pool" : "");
+		ret &= check_result(name, check_maxError(n2, dst, ref),
+		                    0.0f);
+	}
+
+	remove(dst_fname);
+	remove(src_fname);
+	FREE(buf);
+	lanczos_pool_delete(&pool);
+
+	// success
+	return ret;
+
+	// failure
+	fail_raster:
+		remove(dst_fname);
+		remove(src_fname);
+	fail_resample:
+		FREE(buf);
+	fail_buf:
+		lanczos_pool_delete(&pool);
+	return 0;
+}
+
+static int32_t
+check_bytes(int32_t format)
+{
+	if(format == LANCZOS_FORMAT_UINT8)
+	{
+		return 1;
+	}
+	return 2;
+}
+
+// convert samples of the format to float
+static void
+check_toFloat(int32_t format, int32_t n, const void* src,
+              float* dst)
+{
+	int32_t i;
+	if(format == LANCZOS_FORMAT_UINT8)
+	{
+		const uint8_t* s = (const uint8_t*) src;
+		for(i = 0; i < n; ++i)
+		{
+			dst[i] = (float) s[i];
+		}
+	}
+	else if(format == LANCZOS_FORMAT_UINT16)
+	{
+		const uint16_t* s = (const uint16_t*) src;
+		for(i = 0; i < n; ++i)
+		{
+			dst[i] = (float) s[i];
+		}
+	}
+	else
+	{
+		lanczos_simd_loadHalf(LANCZOS_FLAG_SCALAR, format, n,
+		                      (const uint16_t*) src, dst);
+	}
+}
+
+// convert float samples to the format where the integer
+// formats are rounded and clamped to their range
+static void
+check_fromFloat(int32_t format, int32_t n, const float* src,
+                void* dst)
+{
+	int32_t i;
+	float   v;
+	float   vmax = 65535.0f;
+	if(format == LANCZOS_FORMAT_UINT8)
+	{
+		vmax = 255.0f;
+	}
+
+	if((format == LANCZOS_FORMAT_FLOAT16) ||
+	   (format == LANCZOS_FORMAT_BFLOAT16))
+	{
+		lanczos_simd_storeHalf(LANCZOS_FLAG_SCALAR, format, n,
+		                       src, (uint16_t*) dst);
+		return;
+	}
+
+	for(i = 0; i < n; ++i)
+	{
+		v = floorf(src[i] + 0.5f);
+		if(v < 0.0f)
+		{
+			v = 0.0f;
+		}
+		else if(v > vmax)
+		{
+			v = vmax;
+		}
+
+		if(format == LANCZOS_FORMAT_UINT8)
+		{
+			((uint8_t*) dst)[i] = (uint8_t) v;
+		}
+		else
+		{
+			((uint16_t*) dst)[i] = (uint16_t) v;
+		}
+	}
+}
+
+// maximum difference of the samples in units of the format
+// where the half formats are compared by their encoding
+// (the samples are positive such that adjacent values
+// differ by one)
+static float
+check_maxCodes(int32_t format, int32_t n, const void* a,
+               const void* b)
+{
+	int32_t i;
+	int32_t e;
+	int32_t emax = 0;
+	for(i = 0; i < n; ++i)
+	{
+		if(format == LANCZOS_FORMAT_UINT8)
+		{
+			e = abs(((const uint8_t*) a)[i] -
+			        ((const uint8_t*) b)[i]);
+		}
+		else
+		{
+			e = abs(((const uint16_t*) a)[i] -
+			        ((const uint16_t*) b)[i]);
+		}
+
+		if(e > emax)
+		{
+			emax = e;
+		}
+	}
+	return (float) emax;
+}
+
+// compare a sample format with the float path of the
+// converted samples followed by the conversion of the
+// outputs where src_h=0 selects the 1D path
+static int
+check_format(cc_rngUniform_t* rng, uint32_t flags,
+             int32_t format, int32_t a, int32_t channels,
+             int32_t src_w, int32_t src_h, int32_t dst_w,
+             int32_t dst_h)
+{
+	int32_t n1 = src_w*channels;
+	int32_t n2 = dst_w*channels;
+	if(src_h)
+	{
+		n1 *= src_h;
+		n2 *= dst_h;
+	}
+
+	// float samples are followed by the format samples
+	int32_t bytes = check_bytes(format);
+	size_t  size  = (n1 + n2)*sizeof(float) +
+	                (n1 + 3*n2)*bytes;
+
+	float* buf = (float*) CALLOC(1, size);
+	if(buf == NULL)
+	{
+		LOGE("CALLOC failed");
+		return 0;
+	}
+
+	float* fsrc = buf;
+	float* fref = &buf[n1];
+	char*  src  = (char*) &buf[n1 + n2];
+	char*  dst  = &src[n1*bytes];
+	char*  ref  = &dst[n2*bytes];
+	char*  simd = &ref[n2*bytes];
+
+	// the samples are in [0.25, 1) of the format range
+	// such that the outputs of the half formats are positive
+	float   scale = 1.0f;
+	int32_t i;
+	if(format == LANCZOS_FORMAT_UINT8)
+	{
+		scale = 255.0f;
+	}
+	else if(format == LANCZOS_FORMAT_UINT16)
+	{
+		scale = 65535.0f;
+	}
+	check_random(rng, n1, fsrc);
+	for(i = 0; i < n1; ++i)
+	{
+		fsrc[i] = scale*(0.25f + 0.75f*fsrc[i]);
+	}
+	check_fromFloat(format, n1, fsrc, src);
+	check_toFloat(format, n1, src, fsrc);
+
+	lanczos_paramRegular1D_t param1 =
+	{
+		.flags    = flags | LANCZOS_FLAG_SCALAR,
+		.a        = a,
+		.channels = channels,
+		.src_w    = src_w,
+		.dst_w    = dst_w,
+	};
+
+	lanczos_paramRegular2D_t param2 =
+	{
+		.flags    = flags | LANCZOS_FLAG_SCALAR,
+		.a        = a,
+		.channels = channels,
+		.src_w    = src_w,
+		.src_h    = src_h,
+		.dst_w    = dst_w,
+		.dst_h    = dst_h,
+	};
+
+	// the float and format paths with the scalar and SIMD
+	// kernels where the format is compared with the scalar
+	// float path
+	int     ret;
+	int32_t pass;
+	for(pass = 0; pass < 3; ++pass)
+	{
+		if(pass == 0)
+		{
+			param1.src    = fsrc;
+			param1.dst    = fref;
+			param1.format = LANCZOS_FORMAT_FLOAT32;
+		}
+		else
+		{
+			param1.src    = src;
+			param1.dst    = (pass == 1) ? dst : simd;
+			param1.format = format;
+		}
+
+		if(pass == 2)
+		{
+			param1.flags = flags;
+		}
+
+		param2.src    = param1.src;
+		param2.dst    = param1.dst;
+		param2.format = param1.format;
+		param2.flags  = param1.flags;
+
+		if(src_h)
+		{
+			ret = lanczos_resample_regular2D(&param2);
+		}
+		else
+		{
+			ret = lanczos_resample_regular1D(&param1);
+		}
+
+		if(ret == 0)
+		{
+			goto fail_resample;
+		}
+	}
+	check_fromFloat(format, n2, fref, ref);
+
+	const char* names[] =
+	{
+		"float32", "uint8", "uint16", "float16", "bfloat16"
+	};
+
+	char name[256];
+	if(src_h)
+	{
+		snprintf(name, 256, "format2D %s flags=0x%X, a=%i, "
+		         "channels=%i, %ix%i->%ix%i", names[format],
+		         flags, a, channels, src_w, src_h, dst_w, dst_h);
+	}
+	else
+	{
+		snprintf(name, 256, "format1D %s flags=0x%X, a=%i, "
+		         "channels=%i, %i->%i", names[format],
+		         flags, a, channels, src_w, dst_w);
+	}
+	ret = check_result(name, check_maxCodes(format, n2, dst, ref),
+	                   CHECK_FORMAT_CODES);
+
+	// the SIMD kernels of the format must also be within
+	// the precision of the format
+	strncat(name, " simd", 256 - strlen(name) - 1);
+	ret &= check_result(name, check_maxCodes(format, n2, simd, ref),
+	                    CHECK_FORMAT_CODES);
+
+	FREE(buf);
+
+	// success
+	return ret;
+
+	// failure
+	fail_resample:
+		FREE(buf);
+	return 0;
+}
+
+static int
+check_format1D(cc_rngUniform_t* rng, uint32_t flags,
+               int32_t a, int32_t channels, int32_t src_w,
+               int32_t dst_w)
+{
+	int32_t i;
+	int     ret = 1;
+	for(i = 0; i < CHECK_COUNT(check_formats); ++i)
+	{
+		ret &= check_format(rng, flags, check_formats[i], a,
+		                    channels, src_w, 0, dst_w, 0);
+	}
+	return ret;
+}
+
+static int
+check_format2D(cc_rngUniform_t* rng, uint32_t flags,
+               int32_t a, int32_t channels, int32_t src_w,
+               int32_t src_h, int32_t dst_w, int32_t dst_h)
+{
+	int32_t i;
+	int     ret = 1;
+	for(i = 0; i < CHECK_COUNT(check_formats); ++i)
+	{
+		ret &= check_format(rng, flags, check_formats[i], a,
+		                    channels, src_w, src_h, dst_w, dst_h);
+	}
+	return ret;
+}
+
+// compare each level of lanczos_pyramid2D_t (serial and
+// pooled) with lanczos_resample_regular2D of the base image
+static int
+check_pyramid2D(cc_rngUniform_t* rng, uint32_t flags,
+                int32_t a, int32_t channels, int32_t src_w,
+                int32_t src_h)
+{
+	lanczos_pool_t* pool = lanczos_pool_new(4);
+	if(pool == NULL)
+	{
+		return 0;
+	}
+
+	lanczos_pyramid2D_t* pyramid;
+	pyramid = lanczos_pyramid2D_new(NULL, flags, a, channels,
+	                                src_w, src_h, 0);
+	if(pyramid == NULL)
+	{
+		goto fail_pyramid;
+	}
+
+	// the first level is the largest
+	int32_t n1 = src_w*src_h*channels;
+	int32_t n2 = pyramid->levels[0].w*pyramid->levels[0].h*
+	             channels;
+
+	float* buf = (float*) CALLOC(n1 + n2, sizeof(float));
+	if(buf == NULL)
+	{
+		LOGE("CALLOC failed");
+		goto fail_buf;
+	}
+
+	float* src = buf;
+	float* ref = &buf[n1];
+	check_random(rng, n1, src);
+
+	lanczos_paramRegular2D_t param =
+	{
+		.flags    = flags,
+		.a        = a,
+		.channels = channels,
+		.src_w    = src_w,
+		.src_h    = src_h,
+		.src      = src,
+		.dst      = ref,
+	};
+
+	int     ret = 1;
+	int     pass;
+	int32_t l;
+	float*  dst;
+	char    name[256];
+	for(pass = 0; pass < 2; ++pass)
+	{
+		if(lanczos_pyramid2D_execute(pyramid,
+		                             pass ? pool : NULL, src,
+		                             NULL) == 0)
+		{
+			goto fail_execute;
+		}
+
+		for(l = 1; l <= pyramid->level_count; ++l)
+		{
+			dst = lanczos_pyramid2D_level(pyramid, l,
+			                              &param.dst_w,
+			                              &param.dst_h);
+			if((dst == NULL) ||
+			   (lanczos_resample_regular2D(&param) == 0))
+			{
+				goto fail_execute;
+			}
+
+			snprintf(name, 256, "pyramid2D flags=0x%X, a=%i, "
+			         "channels=%i, %ix%i->%ix%i%s", flags, a,
+			         channels, src_w, src_h, param.dst_w,
+			         param.dst_h, pass ? " pool" : "");
+			ret &= check_result(name,
+			                    check_maxError(param.dst_w*
+			                                   param.dst_h*
+			                                   channels,
+			                                   dst, ref),
+			                    0.0f);
+		}
+	}
+
+	FREE(buf);
+	lanczos_pyramid2D_delete(&pyramid);
+	lanczos_pool_delete(&pool);
+
+	// success
+	return ret;
+
+	// failure
+	fail_execute:
+		FREE(buf);
+	fail_buf:
+		lanczos_pyramid2D_delete(&pyramid);
+	fail_pyramid:
+		lanczos_pool_delete(&pool);
+	return 0;
+}
+
+// run a pyramid check for each flags, a, channels and
+// base size
+static int
+check_pyramids2D(cc_rngUniform_t* rng)
+{
+	const int32_t* g;
+	int32_t        a;
+	int32_t        c;
+	int32_t        f;
+	int32_t        i;
+	int            ret = 1;
+	for(f = 0; f < CHECK_COUNT(check_flags); ++f)
+	{
+		for(a = 2; a <= 3; ++a)
+		{
+			for(c = 0; c < CHECK_COUNT(check_channels); ++c)
+			{
+				for(i = 0; i < CHECK_COUNT(check_base2D); ++i)
+				{
+					g    = check_base2D[i];
+					ret &= check_pyramid2D(rng, check_flags[f],
+					                       a, check_channels[c],
+					                       g[0], g[1]);
+				}
+			}
+		}
+	}
+	return ret;
+}
+
+/***********************************************************
+* public                                                   *
+***********************************************************/
+
+void* __real_malloc(size_t size);
+void* __real_calloc(size_t count, size_t size);
+void* __real_realloc(void* ptr, size_t size);
+
+void* __wrap_malloc(size_t size)
+{
+	++check_allocs;
+	return __real_malloc(size);
+}
+
+void* __wrap_calloc(size_t count, size_t size)
+{
+	++check_allocs;
+	return __real_calloc(count, size);
+}
+
+void* __wrap_realloc(void* ptr, size_t size)
+{
+	++check_allocs;
+	return __real_realloc(ptr, size);
+}
+
+int main(int argc, const char** argv)
+{
+	if(argc != 1)
+	{
+		LOGI("usage: %s", argv[0]);
+		return EXIT_FAILURE;
+	}
+
+	cc_rngUniform_t rng;
+	cc_rngUniform_init(&rng);
+
+	int ret = 1;
+	ret &= check_regular1D(&rng, check_scalar1D);
+	ret &= check_regular2D(&rng, check_scalar2D);
+	ret &= check_regular2D(&rng, check_scalarIsotropic2D);
+	ret &= check_regular1D(&rng, check_cache1D);
+	ret &= check_regular2D(&rng, check_cache2D);
+	ret &= check_regular2D(&rng, check_pool2D);
+	ret &= check_regular2D(&rng, check_poolIsotropic2D);
+	ret &= check_regular1D(&rng, check_workspace1D);
+	ret &= check_regular2D(&rng, check_workspace2D);
+	ret &= check_regular2D(&rng, check_workspaceIsotropic2D);
+	ret &= check_irregular1D(&rng, check_bins1D);
+	ret &= check_irregular1D(&rng, check_binning1D);
+	ret &= check_irregular1D(&rng, check_holes1D);
+	ret &= check_irregular1D(&rng, check_scatter1D);
+	ret &= check_irregular1D(&rng, check_sorted1D);
+	ret &= check_irregular1D(&rng, check_gridder1D);
+	ret &= check_irregular1D(&rng, check_workspaceIrregular1D);
+	ret &= check_irregular2D(&rng, check_grid2D);
+	ret &= check_irregular2D(&rng, check_adaptive2D);
+	ret &= check_irregular2D(&rng, check_gridder2D);
+	ret &= check_irregular2D(&rng, check_workspaceIrregular2D);
+	ret &= check_regular1D(&rng, check_stream1D);
+	ret &= check_regular2D(&rng, check_stream2D);
+	ret &= check_regular2D(&rng, check_raster2D);
+	ret &= check_regular1D(&rng, check_format1D);
+	ret &= check_regular2D(&rng, check_format2D);
+	ret &= check_pyramids2D(&rng);
+
+	if(ret == 0)
+	{
+		LOGE("FAILED");
+		return EXIT_FAILURE;
+	}
+
+	LOGI("PASSED");
+	return EXIT_SUCCESS;
+}
@@ -0,0 +1,3 @@
+#!/bin/bash
+
+./check-test
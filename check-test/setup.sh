@@ -0,0 +1,2 @@
+ln -s ../../libcc
+ln -s ../liblanczos
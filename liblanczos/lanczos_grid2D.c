@@ -0,0 +1,1117 @@
+/*
+ * Copyright (c) 2025 Jeff Boody
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included
+ * in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define LOG_TAG "lanczos"
+#include "../../libcc/cc_log.h"
+#include "../../libcc/cc_memory.h"
+#include "lanczos_grid2D.h"
+
+// density compensation threshold
+#define LANCZOS_GRID2D_EPSILON 1e-6f
+
+typedef struct
+{
+	lanczos_grid2D_t*           self;
+	lanczos_paramIrregular2D_t* param;
+	lanczos_kernel_t            kernel;
+	int                         isotropic;
+	int32_t                     rows;
+} lanczos_grid2DTask_t;
+
+typedef struct
+{
+	lanczos_grid2DTask_t* task;
+	float                 ccx;
+	float                 ccy;
+	float                 wj;
+	float*                s2;
+} lanczos_grid2DQuery_t;
+
+/*
+ * private
+ */
+
+static int32_t
+lanczos_grid2D_cell(lanczos_grid2D_t* self, const float* xy,
+                    float* _jfx, float* _jfy)
+{
+	ASSERT(self);
+	ASSERT(xy);
+	ASSERT(_jfx);
+	ASSERT(_jfy);
+
+	// compute xi2jf
+	float jfx = self->sx*(xy[0] - self->x0);
+	float jfy = self->sy*(xy[1] - self->y0);
+	*_jfx = jfx;
+	*_jfy = jfy;
+
+	// discard samples outside cell range
+	// shift j to allow for support samples outside (x0..x1)
+	int32_t jx = ((int32_t) floorf(jfx)) + self->a;
+	int32_t jy = ((int32_t) floorf(jfy)) + self->a;
+	if((jx < 0) || (jx >= self->w) || (jy < 0) || (jy >= self->h))
+	{
+		return -1;
+	}
+
+	return jy*self->w + jx;
+}
+
+static const float*
+lanczos_grid2D_sample(lanczos_grid2D_t* self,
+                      const float* src, int32_t k)
+{
+	ASSERT(self);
+	ASSERT(src);
+
+	int32_t stride = 2 + self->channels;
+	int32_t i      = self->index[k];
+	if(i >= 0)
+	{
+		return &src[((size_t) stride)*i];
+	}
+	return &self->holes[((size_t) stride)*(-1 - i)];
+}
+
+static float
+lanczos_grid2D_L(lanczos_grid2DTask_t* task, float dx, float dy)
+{
+	ASSERT(task);
+
+	if(task->isotropic)
+	{
+		return lanczos_kernel_eval(&task->kernel,
+		                           sqrtf(dx*dx + dy*dy));
+	}
+
+	return lanczos_kernel_eval(&task->kernel, dx)*
+	       lanczos_kernel_eval(&task->kernel, dy);
+}
+
+static const float*
+lanczos_grid2D_nearest(lanczos_grid2D_t* self,
+                       const float* src, int32_t c,
+                       float jfx, float jfy, float* _d2)
+{
+	ASSERT(self);
+	ASSERT(src);
+	ASSERT(_d2);
+
+	int32_t stride = 2 + self->channels;
+
+	// find the nearest sample of the cell
+	if(self->tree)
+	{
+		if(self->cell_hole[c] >= 0)
+		{
+			return NULL;
+		}
+
+		float box[4] =
+		{
+			(float) (c%self->w - self->a),
+			(float) (c/self->w - self->a),
+			(float) (c%self->w - self->a + 1),
+			(float) (c/self->w - self->a + 1),
+		};
+
+		int32_t k = lanczos_kdtree2D_nearest(self->tree, jfx, jfy,
+		                                     box, _d2);
+		if(k < 0)
+		{
+			return NULL;
+		}
+		return &src[((size_t) stride)*self->index[k]];
+	}
+
+	if(self->index[self->start[c]] < 0)
+	{
+		return NULL;
+	}
+
+	int32_t      k;
+	float        sjfx;
+	float        sjfy;
+	float        d2;
+	const float* xmin  = NULL;
+	float        d2min = 0.0f;
+	for(k = self->start[c]; k < self->start[c + 1]; ++k)
+	{
+		sjfx = self->jf[2*((size_t) k)];
+		sjfy = self->jf[2*((size_t) k) + 1];
+		d2   = (sjfx - jfx)*(sjfx - jfx) +
+		       (sjfy - jfy)*(sjfy - jfy);
+		if((xmin == NULL) || (d2 < d2min))
+		{
+			xmin  = &src[((size_t) stride)*self->index[k]];
+			d2min = d2;
+		}
+	}
+
+	*_d2 = d2min;
+	return xmin;
+}
+
+static void
+lanczos_grid2D_fillHole(lanczos_grid2D_t* self,
+                        lanczos_paramIrregular2D_t* param,
+                        int32_t cx, int32_t cy, float* dat)
+{
+	ASSERT(self);
+	ASSERT(param);
+	ASSERT(dat);
+
+	int32_t a        = self->a;
+	int32_t channels = self->channels;
+	int32_t stride   = 2 + channels;
+
+	// compute jf2xi
+	float jfx = ((float) (cx - a)) + 0.5f;
+	float jfy = ((float) (cy - a)) + 0.5f;
+	dat[0] = self->x0 + jfx/self->sx;
+	dat[1] = self->y0 + jfy/self->sy;
+	memset(&dat[2], 0, channels*sizeof(float));
+
+	if(param->flags & LANCZOS_FLAG_NODATA_ZERO)
+	{
+		return;
+	}
+
+	int nearest = param->flags & LANCZOS_FLAG_NODATA_NEAREST;
+
+	// NEAREST selects the nearest sample within the support
+	// radius while LINEAR (default) weights the nearest
+	// sample of each populated cell by inverse distance
+	// which reduces to linear interpolation between two
+	// samples on opposite sides of the hole
+	int32_t      ch;
+	int32_t      i;
+	int32_t      j;
+	float        d2min;
+	float        w;
+	float        wsum = 0.0f;
+	float        best = 0.0f;
+	const float* xmin;
+	const float* xbest = NULL;
+	int32_t      i0 = (cy - a < 0) ? 0 : cy - a;
+	int32_t      i1 = (cy + a >= self->h) ? self->h - 1 : cy + a;
+	int32_t      j0 = (cx - a < 0) ? 0 : cx - a;
+	int32_t      j1 = (cx + a >= self->w) ? self->w - 1 : cx + a;
+	if(nearest && self->tree)
+	{
+		// a single query of the support window
+		float box[4] =
+		{
+			(float) (j0 - a),
+			(float) (i0 - a),
+			(float) (j1 - a + 1),
+			(float) (i1 - a + 1),
+		};
+
+		int32_t k = lanczos_kdtree2D_nearest(self->tree, jfx, jfy,
+		                                     box, &best);
+		if(k >= 0)
+		{
+			memcpy(&dat[2],
+			       &param->src[((size_t) stride)*self->index[k] + 2],
+			       channels*sizeof(float));
+		}
+		return;
+	}
+
+	for(i = i0; i <= i1; ++i)
+	{
+		for(j = j0; j <= j1; ++j)
+		{
+			xmin = lanczos_grid2D_nearest(self, param->src,
+			                              i*self->w + j,
+			                              jfx, jfy, &d2min);
+			if(xmin == NULL)
+			{
+				continue;
+			}
+
+			if((xbest == NULL) || (d2min < best))
+			{
+				xbest = xmin;
+				best  = d2min;
+			}
+
+			if(nearest || (d2min == 0.0f))
+			{
+				continue;
+			}
+
+			w     = 1.0f/sqrtf(d2min);
+			wsum += w;
+			for(ch = 0; ch < channels; ++ch)
+			{
+				dat[ch + 2] += w*xmin[ch + 2];
+			}
+		}
+	}
+
+	// fallback to ZERO when no samples are found
+	if(xbest == NULL)
+	{
+		return;
+	}
+
+	// copy NEAREST or coincident samples
+	if(nearest || (best == 0.0f))
+	{
+		memcpy(&dat[2], &xbest[2], channels*sizeof(float));
+		return;
+	}
+
+	for(ch = 0; ch < channels; ++ch)
+	{
+		dat[ch + 2] /= wsum;
+	}
+}
+
+static void
+lanczos_grid2D_holeTask(void* arg, int32_t task, int32_t thread)
+{
+	ASSERT(arg);
+
+	lanczos_grid2DTask_t* t    = (lanczos_grid2DTask_t*) arg;
+	lanczos_grid2D_t*     self = t->self;
+
+	int32_t stride = 2 + self->channels;
+	int32_t cy0    = task*t->rows;
+	int32_t cy1    = cy0 + t->rows;
+	if(cy1 > self->h)
+	{
+		cy1 = self->h;
+	}
+
+	// holes only reference the source samples so the rows
+	// are filled independently
+	int32_t c;
+	int32_t cx;
+	int32_t cy;
+	int32_t h;
+	for(cy = cy0; cy < cy1; ++cy)
+	{
+		for(cx = 0; cx < self->w; ++cx)
+		{
+			c = cy*self->w + cx;
+			if(self->tree)
+			{
+				h = self->cell_hole[c];
+			}
+			else
+			{
+				h = -1 - self->index[self->start[c]];
+			}
+
+			if(h >= 0)
+			{
+				lanczos_grid2D_fillHole(self, t->param, cx, cy,
+				                        &self->holes[((size_t) stride)*h]);
+			}
+		}
+	}
+}
+
+static void
+lanczos_grid2D_densityTask(void* arg, int32_t task,
+                           int32_t thread)
+{
+	ASSERT(arg);
+
+	lanczos_grid2DTask_t* t    = (lanczos_grid2DTask_t*) arg;
+	lanczos_grid2D_t*     self = t->self;
+
+	int32_t a   = self->a;
+	int32_t cy0 = task*t->rows;
+	int32_t cy1 = cy0 + t->rows;
+	if(cy1 > self->h)
+	{
+		cy1 = self->h;
+	}
+
+	// sum the kernel for the samples within the support
+	// radius of each cell center
+	int32_t      c;
+	int32_t      cx;
+	int32_t      cy;
+	int32_t      i;
+	int32_t      k;
+	int32_t      i0;
+	int32_t      i1;
+	int32_t      j0;
+	int32_t      j1;
+	float        ccx;
+	float        ccy;
+	float        sum;
+	const float* jf;
+	for(cy = cy0; cy < cy1; ++cy)
+	{
+		ccy = ((float) (cy - a)) + 0.5f;
+		i0  = (cy - a < 0) ? 0 : cy - a;
+		i1  = (cy + a >= self->h) ? self->h - 1 : cy + a;
+		for(cx = 0; cx < self->w; ++cx)
+		{
+			ccx = ((float) (cx - a)) + 0.5f;
+			j0  = (cx - a < 0) ? 0 : cx - a;
+			j1  = (cx + a >= self->w) ? self->w - 1 : cx + a;
+			sum = 0.0f;
+			for(i = i0; i <= i1; ++i)
+			{
+				// the cells [j0, j1] of row i are contiguous
+				k  = self->start[i*self->w + j0];
+				jf = &self->jf[2*((size_t) k)];
+				for(; k < self->start[i*self->w + j1 + 1]; ++k)
+				{
+					sum += lanczos_grid2D_L(t, jf[0] - ccx,
+					                        jf[1] - ccy);
+					jf  += 2;
+				}
+			}
+
+			c = cy*self->w + cx;
+			self->vk[c] = 0.0f;
+			if(fabsf(sum) > LANCZOS_GRID2D_EPSILON)
+			{
+				self->vk[c] = 1.0f/sum;
+			}
+		}
+	}
+}
+
+static void
+lanczos_grid2D_resampleTask(void* arg, int32_t task,
+                            int32_t thread)
+{
+	ASSERT(arg);
+
+	lanczos_grid2DTask_t*       t     = (lanczos_grid2DTask_t*) arg;
+	lanczos_grid2D_t*           self  = t->self;
+	lanczos_paramIrregular2D_t* param = t->param;
+
+	int32_t a        = self->a;
+	int32_t channels = self->channels;
+	int32_t y0       = task*t->rows;
+	int32_t y1       = y0 + t->rows;
+	if(y1 > self->dst_h)
+	{
+		y1 = self->dst_h;
+	}
+
+	// output (x, y) is the center of cell (x + a, y + a) and
+	// each sample is applied to all channels
+	int32_t      ch;
+	int32_t      i;
+	int32_t      j;
+	int32_t      k;
+	int32_t      m;
+	int32_t      x;
+	int32_t      y;
+	float        ccx;
+	float        ccy;
+	float        w;
+	float        wj;
+	float*       s2;
+	const float* s1;
+	const float* jf;
+	for(y = y0; y < y1; ++y)
+	{
+		ccy = ((float) y) + 0.5f;
+		for(x = 0; x < self->dst_w; ++x)
+		{
+			ccx = ((float) x) + 0.5f;
+			s2  = &param->dst[(((size_t) y)*self->dst_w + x)*channels];
+			for(ch = 0; ch < channels; ++ch)
+			{
+				s2[ch] = 0.0f;
+			}
+
+			wj = 0.0f;
+			for(i = y; i <= y + 2*a; ++i)
+			{
+				for(j = x; j <= x + 2*a; ++j)
+				{
+					m  = i*self->w + j;
+					k  = self->start[m];
+					jf = &self->jf[2*((size_t) k)];
+					for(; k < self->start[m + 1]; ++k)
+					{
+						s1  = lanczos_grid2D_sample(self, param->src, k);
+						w   = self->vk[m]*
+						      lanczos_grid2D_L(t, jf[0] - ccx,
+						                       jf[1] - ccy);
+						jf += 2;
+						wj += w;
+						for(ch = 0; ch < channels; ++ch)
+						{
+							s2[ch] += w*s1[ch + 2];
+						}
+					}
+				}
+			}
+
+			w = 0.0f;
+			if(fabsf(wj) > LANCZOS_GRID2D_EPSILON)
+			{
+				w = 1.0f/wj;
+			}
+
+			for(ch = 0; ch < channels; ++ch)
+			{
+				s2[ch] *= w;
+			}
+		}
+	}
+}
+
+static void
+lanczos_grid2D_densityFn(void* arg, int32_t k0, int32_t k1)
+{
+	ASSERT(arg);
+
+	lanczos_grid2DQuery_t* q = (lanczos_grid2DQuery_t*) arg;
+
+	int32_t      k;
+	const float* jf = &q->task->self->jf[2*((size_t) k0)];
+	for(k = k0; k < k1; ++k)
+	{
+		q->wj += lanczos_grid2D_L(q->task, jf[0] - q->ccx,
+		                          jf[1] - q->ccy);
+		jf    += 2;
+	}
+}
+
+static void
+lanczos_grid2D_densityTreeTask(void* arg, int32_t task,
+                               int32_t thread)
+{
+	ASSERT(arg);
+
+	lanczos_grid2DTask_t* t    = (lanczos_grid2DTask_t*) arg;
+	lanczos_grid2D_t*     self = t->self;
+
+	int32_t a   = self->a;
+	int32_t cy0 = task*t->rows;
+	int32_t cy1 = cy0 + t->rows;
+	if(cy1 > self->h)
+	{
+		cy1 = self->h;
+	}
+
+	lanczos_grid2DQuery_t q =
+	{
+		.task = t,
+	};
+
+	// the support radius of each cell center is a box query
+	// of the tree (the kernel is zero for the samples outside
+	// of the support) followed by the holes of the window
+	int32_t c;
+	int32_t cx;
+	int32_t cy;
+	int32_t i;
+	int32_t j;
+	int32_t i0;
+	int32_t i1;
+	int32_t j0;
+	int32_t j1;
+	float   box[4];
+	for(cy = cy0; cy < cy1; ++cy)
+	{
+		q.ccy  = ((float) (cy - a)) + 0.5f;
+		box[1] = q.ccy - (float) a;
+		box[3] = q.ccy + (float) a;
+		i0     = (cy - a < 0) ? 0 : cy - a;
+		i1     = (cy + a >= self->h) ? self->h - 1 : cy + a;
+		for(cx = 0; cx < self->w; ++cx)
+		{
+			q.ccx  = ((float) (cx - a)) + 0.5f;
+			q.wj   = 0.0f;
+			box[0] = q.ccx - (float) a;
+			box[2] = q.ccx + (float) a;
+			lanczos_kdtree2D_range(self->tree, box,
+			                       lanczos_grid2D_densityFn, &q);
+
+			j0 = (cx - a < 0) ? 0 : cx - a;
+			j1 = (cx + a >= self->w) ? self->w - 1 : cx + a;
+			for(i = i0; i <= i1; ++i)
+			{
+				for(j = j0; j <= j1; ++j)
+				{
+					if(self->cell_hole[i*self->w + j] >= 0)
+					{
+						q.wj += lanczos_grid2D_L(t, (float) (j - cx),
+						                         (float) (i - cy));
+					}
+				}
+			}
+
+			c = cy*self->w + cx;
+			self->vk[c] = 0.0f;
+			if(fabsf(q.wj) > LANCZOS_GRID2D_EPSILON)
+			{
+				self->vk[c] = 1.0f/q.wj;
+			}
+		}
+	}
+}
+
+static void
+lanczos_grid2D_resampleFn(void* arg, int32_t k0, int32_t k1)
+{
+	ASSERT(arg);
+
+	lanczos_grid2DQuery_t* q    = (lanczos_grid2DQuery_t*) arg;
+	lanczos_grid2D_t*      self = q->task->self;
+
+	int32_t      channels = self->channels;
+	int32_t      stride   = 2 + channels;
+	const float* src      = q->task->param->src;
+
+	// the cell of each sample selects the density
+	// compensation
+	int32_t      ch;
+	int32_t      k;
+	float        w;
+	const float* s1;
+	const float* jf = &self->jf[2*((size_t) k0)];
+	for(k = k0; k < k1; ++k)
+	{
+		w = lanczos_grid2D_L(q->task, jf[0] - q->ccx,
+		                     jf[1] - q->ccy);
+		if(w != 0.0f)
+		{
+			s1     = &src[((size_t) stride)*self->index[k]];
+			w     *= self->vk[self->cell[k]];
+			q->wj += w;
+			for(ch = 0; ch < channels; ++ch)
+			{
+				q->s2[ch] += w*s1[ch + 2];
+			}
+		}
+		jf += 2;
+	}
+}
+
+static void
+lanczos_grid2D_resampleTreeTask(void* arg, int32_t task,
+                                int32_t thread)
+{
+	ASSERT(arg);
+
+	lanczos_grid2DTask_t*       t     = (lanczos_grid2DTask_t*) arg;
+	lanczos_grid2D_t*           self  = t->self;
+	lanczos_paramIrregular2D_t* param = t->param;
+
+	int32_t a        = self->a;
+	int32_t channels = self->channels;
+	int32_t stride   = 2 + channels;
+	int32_t y0       = task*t->rows;
+	int32_t y1       = y0 + t->rows;
+	if(y1 > self->dst_h)
+	{
+		y1 = self->dst_h;
+	}
+
+	lanczos_grid2DQuery_t q =
+	{
+		.task = t,
+	};
+
+	// output (x, y) is the center of cell (x + a, y + a)
+	int32_t      ch;
+	int32_t      h;
+	int32_t      i;
+	int32_t      j;
+	int32_t      m;
+	int32_t      x;
+	int32_t      y;
+	float        w;
+	float        box[4];
+	const float* s1;
+	for(y = y0; y < y1; ++y)
+	{
+		q.ccy  = ((float) y) + 0.5f;
+		box[1] = q.ccy - (float) a;
+		box[3] = q.ccy + (float) a;
+		for(x = 0; x < self->dst_w; ++x)
+		{
+			q.ccx  = ((float) x) + 0.5f;
+			q.wj   = 0.0f;
+			q.s2   = &param->dst[(((size_t) y)*self->dst_w + x)*channels];
+			box[0] = q.ccx - (float) a;
+			box[2] = q.ccx + (float) a;
+			for(ch = 0; ch < channels; ++ch)
+			{
+				q.s2[ch] = 0.0f;
+			}
+
+			lanczos_kdtree2D_range(self->tree, box,
+			                       lanczos_grid2D_resampleFn, &q);
+
+			for(i = y; i <= y + 2*a; ++i)
+			{
+				for(j = x; j <= x + 2*a; ++j)
+				{
+					m = i*self->w + j;
+					h = self->cell_hole[m];
+					if(h < 0)
+					{
+						continue;
+					}
+
+					s1    = &self->holes[((size_t) stride)*h];
+					w     = self->vk[m]*
+					        lanczos_grid2D_L(t, (float) (j - x - a),
+					                         (float) (i - y - a));
+					q.wj += w;
+					for(ch = 0; ch < channels; ++ch)
+					{
+						q.s2[ch] += w*s1[ch + 2];
+					}
+				}
+			}
+
+			w = 0.0f;
+			if(fabsf(q.wj) > LANCZOS_GRID2D_EPSILON)
+			{
+				w = 1.0f/q.wj;
+			}
+
+			for(ch = 0; ch < channels; ++ch)
+			{
+				q.s2[ch] *= w;
+			}
+		}
+	}
+}
+
+static int
+lanczos_grid2D_adapt(lanczos_grid2D_t* self,
+                     lanczos_paramIrregular2D_t* param,
+                     int32_t count)
+{
+	ASSERT(self);
+	ASSERT(param);
+
+	int32_t cells  = self->w*self->h;
+	int32_t stride = 2 + self->channels;
+
+	self->index = (int32_t*)
+	              lanczos_workspace_calloc(self->ws, count,
+	                                       sizeof(int32_t));
+	if(self->index == NULL)
+	{
+		LOGE("CALLOC failed");
+		return 0;
+	}
+
+	self->jf = (float*)
+	           lanczos_workspace_calloc(self->ws, 2*((size_t) count),
+	                                    sizeof(float));
+	if(self->jf == NULL)
+	{
+		LOGE("CALLOC failed");
+		goto fail_jf;
+	}
+
+	self->cell = (int32_t*)
+	             lanczos_workspace_calloc(self->ws, count,
+	                                      sizeof(int32_t));
+	if(self->cell == NULL)
+	{
+		LOGE("CALLOC failed");
+		goto fail_cell;
+	}
+
+	self->cell_hole = (int32_t*)
+	                  lanczos_workspace_calloc(self->ws, cells,
+	                                           sizeof(int32_t));
+	if(self->cell_hole == NULL)
+	{
+		LOGE("CALLOC failed");
+		goto fail_cell_hole;
+	}
+
+	if(self->hole_count)
+	{
+		self->holes = (float*)
+		              lanczos_workspace_calloc(self->ws,
+		                                       ((size_t) self->hole_count)*stride,
+		                                       sizeof(float));
+		if(self->holes == NULL)
+		{
+			LOGE("CALLOC failed");
+			goto fail_holes;
+		}
+	}
+
+	// the samples are stored in any order since the tree
+	// sorts them
+	int32_t k = 0;
+	int32_t c;
+	int32_t i;
+	float   jfx;
+	float   jfy;
+	for(i = 0; i < param->src_count; ++i)
+	{
+		c = lanczos_grid2D_cell(self, &param->src[((size_t) stride)*i],
+		                        &jfx, &jfy);
+		if(c >= 0)
+		{
+			self->jf[2*((size_t) k)]     = jfx;
+			self->jf[2*((size_t) k) + 1] = jfy;
+			self->index[k++]             = i;
+		}
+	}
+
+	int32_t h = 0;
+	for(c = 0; c < cells; ++c)
+	{
+		self->cell_hole[c] = -1;
+		if(self->start[c + 1] == 0)
+		{
+			self->cell_hole[c] = h++;
+		}
+	}
+
+	self->tree = lanczos_kdtree2D_new(self->ws, count,
+	                                  self->index, self->jf);
+	if(self->tree == NULL)
+	{
+		goto fail_tree;
+	}
+
+	for(k = 0; k < count; ++k)
+	{
+		self->cell[k] = lanczos_grid2D_cell(self,
+		                                    &param->src[((size_t) stride)*self->index[k]],
+		                                    &jfx, &jfy);
+	}
+
+	// the cell ranges are replaced by the tree
+	lanczos_workspace_free(self->ws, self->start);
+	self->start = NULL;
+
+	// success
+	return 1;
+
+	// failure
+	fail_tree:
+		lanczos_workspace_free(self->ws, self->holes);
+		self->holes = NULL;
+	fail_holes:
+		lanczos_workspace_free(self->ws, self->cell_hole);
+		self->cell_hole = NULL;
+	fail_cell_hole:
+		lanczos_workspace_free(self->ws, self->cell);
+		self->cell = NULL;
+	fail_cell:
+		lanczos_workspace_free(self->ws, self->jf);
+		self->jf = NULL;
+	fail_jf:
+		lanczos_workspace_free(self->ws, self->index);
+		self->index = NULL;
+	return 0;
+}
+
+/*
+ * public
+ */
+
+lanczos_grid2D_t*
+lanczos_grid2D_new(lanczos_paramIrregular2D_t* param)
+{
+	ASSERT(param);
+
+	if((param->a <= 0) || (param->dst_w <= 0) ||
+	   (param->dst_h <= 0) || (param->src_count < 0) ||
+	   (param->src_x1 == param->src_x0) ||
+	   (param->src_y1 == param->src_y0))
+	{
+		LOGE("invalid a=%i, dst=%ix%i, src_count=%i",
+		     param->a, param->dst_w, param->dst_h,
+		     param->src_count);
+		return NULL;
+	}
+
+	lanczos_grid2D_t* self;
+	self = (lanczos_grid2D_t*)
+	       lanczos_workspace_calloc(param->ws, 1,
+	                                sizeof(lanczos_grid2D_t));
+	if(self == NULL)
+	{
+		LOGE("CALLOC failed");
+		return NULL;
+	}
+
+	self->ws       = param->ws;
+	self->a        = param->a;
+	self->channels = param->channels;
+	self->dst_w    = param->dst_w;
+	self->dst_h    = param->dst_h;
+	self->w        = param->dst_w + 2*param->a;
+	self->h        = param->dst_h + 2*param->a;
+	self->x0       = param->src_x0;
+	self->y0       = param->src_y0;
+	self->sx       = ((float) param->dst_w)/
+	                 (param->src_x1 - param->src_x0);
+	self->sy       = ((float) param->dst_h)/
+	                 (param->src_y1 - param->src_y0);
+
+	int32_t cells  = self->w*self->h;
+	int32_t stride = 2 + self->channels;
+
+	self->start = (int32_t*)
+	              lanczos_workspace_calloc(self->ws, cells + 1,
+	                                       sizeof(int32_t));
+	if(self->start == NULL)
+	{
+		LOGE("CALLOC failed");
+		goto fail_start;
+	}
+
+	self->vk = (float*)
+	           lanczos_workspace_calloc(self->ws, cells,
+	                                    sizeof(float));
+	if(self->vk == NULL)
+	{
+		LOGE("CALLOC failed");
+		goto fail_vk;
+	}
+
+	// count the samples per cell
+	int32_t* start = self->start;
+	int32_t  c;
+	int32_t  i;
+	float    jfx;
+	float    jfy;
+	for(i = 0; i < param->src_count; ++i)
+	{
+		c = lanczos_grid2D_cell(self, &param->src[((size_t) stride)*i],
+		                        &jfx, &jfy);
+		if(c >= 0)
+		{
+			++start[c + 1];
+		}
+	}
+
+	// reserve one sample for each hole
+	int32_t count = 0;
+	for(c = 0; c < cells; ++c)
+	{
+		if(start[c + 1] == 0)
+		{
+			++self->hole_count;
+			++count;
+		}
+		count += start[c + 1];
+	}
+
+	if(param->flags & LANCZOS_FLAG_INDEX_ADAPTIVE)
+	{
+		if(lanczos_grid2D_adapt(self, param,
+		                        count - self->hole_count) == 0)
+		{
+			goto fail_index;
+		}
+
+		// success
+		return self;
+	}
+
+	self->index = (int32_t*)
+	              lanczos_workspace_calloc(self->ws, count,
+	                                       sizeof(int32_t));
+	if(self->index == NULL)
+	{
+		LOGE("CALLOC failed");
+		goto fail_index;
+	}
+
+	self->jf = (float*)
+	           lanczos_workspace_calloc(self->ws, 2*((size_t) count),
+	                                    sizeof(float));
+	if(self->jf == NULL)
+	{
+		LOGE("CALLOC failed");
+		goto fail_jf;
+	}
+
+	if(self->hole_count)
+	{
+		self->holes = (float*)
+		              lanczos_workspace_calloc(self->ws,
+		                                       ((size_t) self->hole_count)*stride,
+		                                       sizeof(float));
+		if(self->holes == NULL)
+		{
+			LOGE("CALLOC failed");
+			goto fail_holes;
+		}
+	}
+
+	// prefix sum where start[c] is used as the insertion
+	// point of the scatter and is restored afterwards
+	int32_t h = 0;
+	for(c = 0; c < cells; ++c)
+	{
+		if(start[c + 1] == 0)
+		{
+			// holes are located at the cell center
+			jfx = ((float) (c%self->w - self->a)) + 0.5f;
+			jfy = ((float) (c/self->w - self->a)) + 0.5f;
+			self->index[start[c]]               = -1 - h;
+			self->jf[2*((size_t) start[c])]     = jfx;
+			self->jf[2*((size_t) start[c]) + 1] = jfy;
+			start[c + 1] = start[c] + 1;
+			++start[c];
+			++h;
+			continue;
+		}
+		start[c + 1] += start[c];
+	}
+
+	// scatter the sample indices
+	for(i = 0; i < param->src_count; ++i)
+	{
+		c = lanczos_grid2D_cell(self, &param->src[((size_t) stride)*i],
+		                        &jfx, &jfy);
+		if(c >= 0)
+		{
+			self->jf[2*((size_t) start[c])]     = jfx;
+			self->jf[2*((size_t) start[c]) + 1] = jfy;
+			self->index[start[c]++]             = i;
+		}
+	}
+
+	for(c = cells; c > 0; --c)
+	{
+		start[c] = start[c - 1];
+	}
+	start[0] = 0;
+
+	// success
+	return self;
+
+	// failure
+	fail_holes:
+		lanczos_workspace_free(self->ws, self->jf);
+	fail_jf:
+		lanczos_workspace_free(self->ws, self->index);
+	fail_index:
+		lanczos_workspace_free(self->ws, self->vk);
+	fail_vk:
+		lanczos_workspace_free(self->ws, self->start);
+	fail_start:
+		lanczos_workspace_free(self->ws, self);
+	return NULL;
+}
+
+void lanczos_grid2D_delete(lanczos_grid2D_t** _self)
+{
+	ASSERT(_self);
+
+	lanczos_grid2D_t* self = *_self;
+	if(self)
+	{
+		lanczos_kdtree2D_delete(&self->tree);
+		lanczos_workspace_free(self->ws, self->cell_hole);
+		lanczos_workspace_free(self->ws, self->cell);
+		lanczos_workspace_free(self->ws, self->holes);
+		lanczos_workspace_free(self->ws, self->jf);
+		lanczos_workspace_free(self->ws, self->index);
+		lanczos_workspace_free(self->ws, self->vk);
+		lanczos_workspace_free(self->ws, self->start);
+		lanczos_workspace_free(self->ws, self);
+		*_self = NULL;
+	}
+}
+
+int lanczos_grid2D_resample(lanczos_grid2D_t* self,
+                            lanczos_paramIrregular2D_t* param)
+{
+	ASSERT(self);
+	ASSERT(param);
+
+	lanczos_grid2DTask_t task =
+	{
+		.self      = self,
+		.param     = param,
+		.isotropic = param->flags &
+		             LANCZOS_FLAG_MULTIDIM_2D_ISOTROPIC,
+	};
+
+	if(lanczos_kernel_init(&task.kernel, param->flags,
+	                       param->a) == 0)
+	{
+		return 0;
+	}
+
+	// partition the rows such that there are enough tasks
+	// to balance the threads
+	int32_t threads = lanczos_pool_threads(param->pool);
+	int32_t tasks   = 4*threads;
+
+	// 2D Hole Filling
+	task.rows = (self->h + tasks - 1)/tasks;
+	lanczos_pool_run(param->pool,
+	                 (self->h + task.rows - 1)/task.rows,
+	                 lanczos_grid2D_holeTask, &task);
+
+	if(self->tree)
+	{
+		// Density Compensation
+		lanczos_pool_run(param->pool,
+		                 (self->h + task.rows - 1)/task.rows,
+		                 lanczos_grid2D_densityTreeTask, &task);
+
+		// Irregular Interpolation and Normalization
+		task.rows = (self->dst_h + tasks - 1)/tasks;
+		lanczos_pool_run(param->pool,
+		                 (self->dst_h + task.rows - 1)/task.rows,
+		                 lanczos_grid2D_resampleTreeTask, &task);
+
+		return 1;
+	}
+
+	// Density Compensation
+	lanczos_pool_run(param->pool,
+	                 (self->h + task.rows - 1)/task.rows,
+	                 lanczos_grid2D_densityTask, &task);
+
+	// Irregular Interpolation and Normalization
+	task.rows = (self->dst_h + tasks - 1)/tasks;
+	lanczos_pool_run(param->pool,
+	                 (self->dst_h + task.rows - 1)/task.rows,
+	                 lanczos_grid2D_resampleTask, &task);
+
+	return 1;
+}
@@ -0,0 +1,91 @@
+/*
+ * Copyright (c) 2025 Jeff Boody
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included
+ * in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+
+#ifndef lanczos_grid2D_H
+#define lanczos_grid2D_H
+
+#include <stdint.h>
+
+#include "lanczos_kdtree2D.h"
+#include "lanczos_kernel.h"
+#include "lanczos_resample.h"
+
+// A uniform grid spatial index of irregular 2D samples. The
+// grid cells are the output samples padded by a cells on
+// each side such that the support of every output is in
+// range. The cells are stored in a compressed (CSR) layout
+// where the samples of cell c are index[k] for k in
+// [start[c], start[c + 1]). A sample index i >= 0 refers to
+// the source sample i while empty cells (holes) hold a
+// single synthesized sample i < 0 which refers to
+// holes[-1 - i] and is located at the center of the cell.
+// The grid coordinates mapjf(x,y) of each sample are stored
+// in jf such that the cells of a row of the support window
+// are a contiguous range of samples.
+//
+// The adaptive index (LANCZOS_FLAG_INDEX_ADAPTIVE) replaces
+// the compressed layout with a k-d tree of the source
+// samples such that start is NULL and the samples are
+// ordered by the tree. The holes are regular so they are
+// found by the cell_hole map instead where cell c holds
+// hole cell_hole[c] or -1 and sample k is located in cell
+// cell[k].
+typedef struct
+{
+	// optional workspace
+	lanczos_workspace_t* ws;
+
+	int32_t a;
+	int32_t channels;
+	int32_t dst_w;
+	int32_t dst_h;
+
+	// cells (dst_w + 2*a)x(dst_h + 2*a)
+	int32_t w;
+	int32_t h;
+
+	// mapjf
+	float x0;
+	float y0;
+	float sx;
+	float sy;
+
+	int32_t  hole_count;
+	int32_t* start; // n=w*h + 1
+	int32_t* index; // n=start[w*h]
+	float*   jf;    // n=2*start[w*h] : {jfx,jfy}
+	float*   holes; // n=hole_count*(2 + channels) : {x,y,val}
+	float*   vk;    // n=w*h
+
+	// adaptive index
+	lanczos_kdtree2D_t* tree;
+	int32_t*            cell;      // n=tree->count
+	int32_t*            cell_hole; // n=w*h
+} lanczos_grid2D_t;
+
+lanczos_grid2D_t* lanczos_grid2D_new(lanczos_paramIrregular2D_t* param);
+void              lanczos_grid2D_delete(lanczos_grid2D_t** _self);
+int               lanczos_grid2D_resample(lanczos_grid2D_t* self,
+                                          lanczos_paramIrregular2D_t* param);
+
+#endif
@@ -0,0 +1,722 @@
+/*
+ * Copyright (c) 2025 Jeff Boody
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included
+ * in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define LOG_TAG "lanczos"
+#include "../../libcc/cc_log.h"
+#include "../../libcc/cc_memory.h"
+#include "lanczos_gridder1D.h"
+#include "lanczos_resample.h"
+
+// density compensation threshold
+#define LANCZOS_GRIDDER1D_EPSILON 1e-6f
+
+// bin state
+#define LANCZOS_GRIDDER1D_DIRTY   0x1
+#define LANCZOS_GRIDDER1D_CHANGED 0x2
+
+/*
+ * private
+ */
+
+static int
+lanczos_gridder1D_compare(const void* a, const void* b)
+{
+	ASSERT(a);
+	ASSERT(b);
+
+	int32_t ia = *((const int32_t*) a);
+	int32_t ib = *((const int32_t*) b);
+	return (ia > ib) - (ia < ib);
+}
+
+static int32_t
+lanczos_gridder1D_bin(lanczos_gridder1D_t* self, float xi,
+                      float* _jf)
+{
+	ASSERT(self);
+	ASSERT(_jf);
+
+	// compute xi2jf
+	float n2 = (float) self->dst_w;
+	float x0 = self->src_x0;
+	float x1 = self->src_x1;
+	float jf = n2*(xi - x0)/(x1 - x0);
+	*_jf     = jf;
+
+	// discard samples outside bin range
+	// shift j to allow for support samples outside (x0..x1)
+	int32_t ja = ((int32_t) floorf(jf)) + self->a;
+	if((ja < 0) || (ja >= self->bin_count))
+	{
+		return -1;
+	}
+
+	return ja;
+}
+
+static void
+lanczos_gridder1D_mark(lanczos_gridder1D_t* self, int32_t m,
+                       uint8_t state)
+{
+	ASSERT(self);
+
+	if(self->state[m] & state)
+	{
+		return;
+	}
+	self->state[m] |= state;
+
+	if(state == LANCZOS_GRIDDER1D_DIRTY)
+	{
+		self->dirty[self->dirty_count++] = m;
+	}
+	else
+	{
+		self->changed[self->changed_count++] = m;
+	}
+}
+
+static const float*
+lanczos_gridder1D_extreme(lanczos_gridder1D_t* self,
+                          int32_t m, int max)
+{
+	ASSERT(self);
+
+	lanczos_gridder1DBin_t* bin    = &self->bins[m];
+	int32_t                 stride = 2 + self->channels;
+
+	// find the sample {x,val} with the min or max position
+	int32_t      k;
+	const float* xp;
+	const float* xe = NULL;
+	for(k = 0; k < bin->count; ++k)
+	{
+		xp = &bin->data[stride*k + 1];
+		if((xe == NULL) ||
+		   (max && (xp[0] > xe[0])) ||
+		   ((max == 0) && (xp[0] < xe[0])))
+		{
+			xe = xp;
+		}
+	}
+
+	return xe;
+}
+
+static void
+lanczos_gridder1D_fillHole(lanczos_gridder1D_t* self,
+                           int32_t h, int32_t next)
+{
+	ASSERT(self);
+
+	int32_t a        = self->a;
+	int32_t channels = self->channels;
+	int32_t stride   = 1 + channels;
+	float*  dat      = &self->holes[((size_t) stride)*h];
+
+	// compute jf2xi
+	float x0 = self->src_x0;
+	float x1 = self->src_x1;
+	float n2 = self->dst_w;
+	float jf = ((float) (h - a)) + 0.5f;
+	float xi = x0 + (x1 - x0)*jf/n2;
+	dat[0]   = xi;
+	memset(&dat[1], 0, channels*sizeof(float));
+
+	if(self->flags & LANCZOS_FLAG_NODATA_ZERO)
+	{
+		return;
+	}
+
+	// the left neighbor is the max sample of the previous
+	// bin (or the previous hole) and the right neighbor is
+	// the min sample of the next populated bin within the
+	// support radius as in lanczos_resample_holePass1D
+	const float* x0p = NULL;
+	const float* x1p = NULL;
+	if(h > 0)
+	{
+		x0p = &self->holes[((size_t) stride)*(h - 1)];
+		if(self->bins[h - 1].count)
+		{
+			x0p = lanczos_gridder1D_extreme(self, h - 1, 1);
+		}
+	}
+
+	if((next < self->bin_count) && (next - h <= a))
+	{
+		x1p = lanczos_gridder1D_extreme(self, next, 0);
+	}
+
+	// try LINEAR (default)
+	int32_t ch;
+	if(x0p && x1p &&
+	   ((self->flags & LANCZOS_FLAG_NODATA_LINEAR) ||
+	    ((self->flags & LANCZOS_FLAG_NODATA_MASK) == 0)))
+	{
+		float s = (xi - x0p[0])/(x1p[0] - x0p[0]);
+		for(ch = 1; ch <= channels; ++ch)
+		{
+			dat[ch] = x0p[ch] + s*(x1p[ch] - x0p[ch]);
+		}
+		return;
+	}
+
+	// determine NEAREST and fallthrough to copy
+	if(x0p && x1p && (fabs(x1p[0] - xi) < fabs(x0p[0] - xi)))
+	{
+		x0p = NULL;
+	}
+
+	// copy NEAREST or fallback to ZERO
+	if(x0p)
+	{
+		memcpy(&dat[1], &x0p[1], channels*sizeof(float));
+	}
+	else if(x1p)
+	{
+		memcpy(&dat[1], &x1p[1], channels*sizeof(float));
+	}
+}
+
+static void
+lanczos_gridder1D_density(lanczos_gridder1D_t* self,
+                          int32_t ja)
+{
+	ASSERT(self);
+
+	int32_t a      = self->a;
+	int32_t stride = 2 + self->channels;
+	int32_t m0     = (ja - a < 0) ? 0 : ja - a;
+	int32_t m1     = (ja + a >= self->bin_count) ?
+	                 self->bin_count - 1 : ja + a;
+
+	// sum the kernel for the samples within the support
+	// radius of the cell center where the hole of an empty
+	// bin is located at the bin center
+	lanczos_gridder1DBin_t* bin;
+	int32_t                 k;
+	int32_t                 m;
+	float                   c   = ((float) (ja - a)) + 0.5f;
+	float                   sum = 0.0f;
+	for(m = m0; m <= m1; ++m)
+	{
+		bin = &self->bins[m];
+		if(bin->count == 0)
+		{
+			sum += lanczos_kernel_eval(&self->kernel,
+			                           ((float) (m - a)) + 0.5f - c);
+			continue;
+		}
+
+		for(k = 0; k < bin->count; ++k)
+		{
+			sum += lanczos_kernel_eval(&self->kernel,
+			                           bin->data[stride*k] - c);
+		}
+	}
+
+	self->vk[ja] = 0.0f;
+	if(fabsf(sum) > LANCZOS_GRIDDER1D_EPSILON)
+	{
+		self->vk[ja] = 1.0f/sum;
+	}
+}
+
+static void
+lanczos_gridder1D_partial(lanczos_gridder1D_t* self,
+                          int32_t m)
+{
+	ASSERT(self);
+
+	lanczos_gridder1DBin_t* bin = &self->bins[m];
+
+	int32_t a        = self->a;
+	int32_t channels = self->channels;
+	int32_t stride   = 2 + channels;
+	int32_t size     = 2*a + 1;
+	float*  part     = &self->part[((size_t) size)*m*(1 + channels)];
+
+	memset(part, 0, size*(1 + channels)*sizeof(float));
+
+	// the hole of an empty bin is located at the bin center
+	int32_t      ch;
+	int32_t      d;
+	int32_t      j;
+	int32_t      k;
+	int32_t      n     = bin->count;
+	float        jf    = ((float) (m - a)) + 0.5f;
+	const float* s1    = &self->holes[((size_t) m)*(1 + channels)];
+	float*       p;
+	float        w;
+	if(n == 0)
+	{
+		n = 1;
+	}
+
+	for(k = 0; k < n; ++k)
+	{
+		if(bin->count)
+		{
+			jf = bin->data[stride*k];
+			s1 = &bin->data[stride*k + 1];
+		}
+
+		// output j = m - d for d in [0, 2a]
+		for(d = 0; d < size; ++d)
+		{
+			j = m - d;
+			if((j < 0) || (j >= self->dst_w))
+			{
+				continue;
+			}
+
+			p     = &part[(1 + channels)*d];
+			w     = lanczos_kernel_eval(&self->kernel,
+			                            jf - ((float) j) - 0.5f);
+			p[0] += w;
+			for(ch = 0; ch < channels; ++ch)
+			{
+				p[ch + 1] += w*s1[ch + 1];
+			}
+		}
+	}
+}
+
+static void
+lanczos_gridder1D_output(lanczos_gridder1D_t* self,
+                         int32_t j, float* dst)
+{
+	ASSERT(self);
+	ASSERT(dst);
+
+	int32_t a        = self->a;
+	int32_t channels = self->channels;
+	int32_t size     = 2*a + 1;
+	float*  s2       = &dst[((size_t) j)*channels];
+
+	int32_t      ch;
+	int32_t      m;
+	float        vk;
+	float        w;
+	float        wj = 0.0f;
+	const float* p;
+	for(ch = 0; ch < channels; ++ch)
+	{
+		s2[ch] = 0.0f;
+	}
+
+	// output j is the center of bin j + a and is supported
+	// by the bins [j, j + 2a]
+	for(m = j; m <= j + 2*a; ++m)
+	{
+		vk  = self->vk[m];
+		p   = &self->part[(((size_t) size)*m + m - j)*(1 + channels)];
+		wj += vk*p[0];
+		for(ch = 0; ch < channels; ++ch)
+		{
+			s2[ch] += vk*p[ch + 1];
+		}
+	}
+
+	w = 0.0f;
+	if(fabsf(wj) > LANCZOS_GRIDDER1D_EPSILON)
+	{
+		w = 1.0f/wj;
+	}
+
+	for(ch = 0; ch < channels; ++ch)
+	{
+		s2[ch] *= w;
+	}
+}
+
+/*
+ * public
+ */
+
+lanczos_gridder1D_t*
+lanczos_gridder1D_new(uint32_t flags, int32_t a,
+                      int32_t channels, float src_x0,
+                      float src_x1, int32_t dst_w)
+{
+	if((a <= 0) || (channels <= 0) || (dst_w <= 0) ||
+	   (src_x1 == src_x0))
+	{
+		LOGE("invalid a=%i, channels=%i, dst_w=%i",
+		     a, channels, dst_w);
+		return NULL;
+	}
+
+	lanczos_gridder1D_t* self;
+	self = (lanczos_gridder1D_t*)
+	       CALLOC(1, sizeof(lanczos_gridder1D_t));
+	if(self == NULL)
+	{
+		LOGE("CALLOC failed");
+		return NULL;
+	}
+
+	self->flags     = flags;
+	self->a         = a;
+	self->channels  = channels;
+	self->src_x0    = src_x0;
+	self->src_x1    = src_x1;
+	self->dst_w     = dst_w;
+	self->bin_count = dst_w + 2*a;
+
+	if(lanczos_kernel_init(&self->kernel, flags, a) == 0)
+	{
+		goto fail_kernel;
+	}
+
+	int32_t bin_count = self->bin_count;
+
+	self->bins = (lanczos_gridder1DBin_t*)
+	             CALLOC(bin_count, sizeof(lanczos_gridder1DBin_t));
+	if(self->bins == NULL)
+	{
+		LOGE("CALLOC failed");
+		goto fail_bins;
+	}
+
+	self->holes = (float*)
+	              CALLOC(((size_t) bin_count)*(1 + channels), sizeof(float));
+	if(self->holes == NULL)
+	{
+		LOGE("CALLOC failed");
+		goto fail_holes;
+	}
+
+	self->vk = (float*) CALLOC(bin_count, sizeof(float));
+	if(self->vk == NULL)
+	{
+		LOGE("CALLOC failed");
+		goto fail_vk;
+	}
+
+	self->part = (float*)
+	             CALLOC(((size_t) bin_count)*(2*a + 1)*(1 + channels),
+	                    sizeof(float));
+	if(self->part == NULL)
+	{
+		LOGE("CALLOC failed");
+		goto fail_part;
+	}
+
+	self->state = (uint8_t*) CALLOC(bin_count, sizeof(uint8_t));
+	if(self->state == NULL)
+	{
+		LOGE("CALLOC failed");
+		goto fail_state;
+	}
+
+	self->dirty = (int32_t*) CALLOC(bin_count, sizeof(int32_t));
+	if(self->dirty == NULL)
+	{
+		LOGE("CALLOC failed");
+		goto fail_dirty;
+	}
+
+	self->changed = (int32_t*) CALLOC(bin_count, sizeof(int32_t));
+	if(self->changed == NULL)
+	{
+		LOGE("CALLOC failed");
+		goto fail_changed;
+	}
+
+	// the first flush computes every bin
+	int32_t m;
+	for(m = 0; m < bin_count; ++m)
+	{
+		lanczos_gridder1D_mark(self, m, LANCZOS_GRIDDER1D_DIRTY);
+	}
+
+	// success
+	return self;
+
+	// failure
+	fail_changed:
+		FREE(self->dirty);
+	fail_dirty:
+		FREE(self->state);
+	fail_state:
+		FREE(self->part);
+	fail_part:
+		FREE(self->vk);
+	fail_vk:
+		FREE(self->holes);
+	fail_holes:
+		FREE(self->bins);
+	fail_bins:
+	fail_kernel:
+		FREE(self);
+	return NULL;
+}
+
+void lanczos_gridder1D_delete(lanczos_gridder1D_t** _self)
+{
+	ASSERT(_self);
+
+	lanczos_gridder1D_t* self = *_self;
+	if(self)
+	{
+		int32_t m;
+		for(m = 0; m < self->bin_count; ++m)
+		{
+			FREE(self->bins[m].data);
+		}
+
+		FREE(self->changed);
+		FREE(self->dirty);
+		FREE(self->state);
+		FREE(self->part);
+		FREE(self->vk);
+		FREE(self->holes);
+		FREE(self->bins);
+		FREE(self);
+		*_self = NULL;
+	}
+}
+
+int lanczos_gridder1D_insert(lanczos_gridder1D_t* self,
+                             int32_t count, const float* src)
+{
+	ASSERT(self);
+	ASSERT(src || (count == 0));
+
+	int32_t stride = 2 + self->channels;
+
+	// append the samples {x,val} to their bins
+	lanczos_gridder1DBin_t* bin;
+	int32_t                 i;
+	int32_t                 m;
+	int32_t                 size;
+	float                   jf;
+	float*                  data;
+	const float*            s1;
+	for(i = 0; i < count; ++i)
+	{
+		s1 = &src[((size_t) i)*(1 + self->channels)];
+		m  = lanczos_gridder1D_bin(self, s1[0], &jf);
+		if(m < 0)
+		{
+			continue;
+		}
+
+		bin = &self->bins[m];
+		if(bin->count == bin->size)
+		{
+			size = bin->size ? 2*bin->size : 4;
+			data = (float*)
+			       REALLOC(bin->data,
+			               size*stride*sizeof(float));
+			if(data == NULL)
+			{
+				LOGE("REALLOC failed");
+				return 0;
+			}
+			bin->data = data;
+			bin->size = size;
+		}
+
+		data    = &bin->data[stride*bin->count];
+		data[0] = jf;
+		memcpy(&data[1], s1, (1 + self->channels)*sizeof(float));
+		++bin->count;
+
+		lanczos_gridder1D_mark(self, m, LANCZOS_GRIDDER1D_DIRTY);
+	}
+
+	return 1;
+}
+
+int lanczos_gridder1D_remove(lanczos_gridder1D_t* self,
+                             int32_t count, const float* src)
+{
+	ASSERT(self);
+	ASSERT(src || (count == 0));
+
+	int32_t stride = 2 + self->channels;
+	size_t  bytes  = (1 + self->channels)*sizeof(float);
+
+	// remove the first sample of the bin that is equal to
+	// {x,val} while preserving the insertion order
+	lanczos_gridder1DBin_t* bin;
+	int32_t                 i;
+	int32_t                 k;
+	int32_t                 m;
+	float                   jf;
+	const float*            s1;
+	for(i = 0; i < count; ++i)
+	{
+		s1 = &src[((size_t) i)*(1 + self->channels)];
+		m  = lanczos_gridder1D_bin(self, s1[0], &jf);
+		if(m < 0)
+		{
+			continue;
+		}
+
+		bin = &self->bins[m];
+		for(k = 0; k < bin->count; ++k)
+		{
+			if(memcmp(&bin->data[stride*k + 1], s1, bytes) == 0)
+			{
+				break;
+			}
+		}
+
+		if(k == bin->count)
+		{
+			LOGW("invalid x=%f", s1[0]);
+			continue;
+		}
+
+		memmove(&bin->data[stride*k], &bin->data[stride*(k + 1)],
+		        (bin->count - k - 1)*stride*sizeof(float));
+		--bin->count;
+
+		lanczos_gridder1D_mark(self, m, LANCZOS_GRIDDER1D_DIRTY);
+	}
+
+	return 1;
+}
+
+int lanczos_gridder1D_flush(lanczos_gridder1D_t* self,
+                            float* dst)
+{
+	ASSERT(self);
+	ASSERT(dst);
+
+	int32_t a         = self->a;
+	int32_t bin_count = self->bin_count;
+
+	// process the dirty bins in order such that each
+	// affected range is only updated once
+	qsort(self->dirty, self->dirty_count, sizeof(int32_t),
+	      lanczos_gridder1D_compare);
+
+	// 1D Hole Filling
+	// a dirty bin affects the holes between the previous
+	// and next populated bins since each hole depends on the
+	// previous hole
+	int32_t h;
+	int32_t i;
+	int32_t m;
+	int32_t next;
+	int32_t prev;
+	int32_t last = -1;
+	for(i = 0; i < self->dirty_count; ++i)
+	{
+		m    = self->dirty[i];
+		prev = m - 1;
+		while((prev > last) && (self->bins[prev].count == 0))
+		{
+			--prev;
+		}
+
+		next = m + 1;
+		while((next < bin_count) && (self->bins[next].count == 0))
+		{
+			++next;
+		}
+
+		// m is the only bin which may be populated between
+		// prev and next
+		h = (prev > last) ? prev + 1 : last + 1;
+		for(; h < next; ++h)
+		{
+			if(self->bins[h].count == 0)
+			{
+				lanczos_gridder1D_fillHole(self, h,
+				                           ((h < m) && self->bins[m].count) ?
+				                           m : next);
+				lanczos_gridder1D_partial(self, h);
+				lanczos_gridder1D_mark(self, h,
+				                       LANCZOS_GRIDDER1D_CHANGED);
+			}
+		}
+		last = next - 1;
+	}
+
+	// Density Compensation
+	int32_t b;
+	int32_t b1;
+	last = -1;
+	for(i = 0; i < self->dirty_count; ++i)
+	{
+		m  = self->dirty[i];
+		b  = (m - a > last) ? m - a : last + 1;
+		b1 = (m + a >= bin_count) ? bin_count - 1 : m + a;
+		for(; b <= b1; ++b)
+		{
+			lanczos_gridder1D_density(self, b);
+			lanczos_gridder1D_mark(self, b,
+			                       LANCZOS_GRIDDER1D_CHANGED);
+		}
+
+		if(b1 > last)
+		{
+			last = b1;
+		}
+
+		if(self->bins[m].count)
+		{
+			lanczos_gridder1D_partial(self, m);
+		}
+		self->state[m] &= ~LANCZOS_GRIDDER1D_DIRTY;
+	}
+	self->dirty_count = 0;
+
+	// Irregular Interpolation and Normalization
+	// bin b supports the outputs [b - 2a, b]
+	qsort(self->changed, self->changed_count, sizeof(int32_t),
+	      lanczos_gridder1D_compare);
+
+	int32_t j;
+	int32_t j1;
+	last = -1;
+	for(i = 0; i < self->changed_count; ++i)
+	{
+		b  = self->changed[i];
+		j  = (b - 2*a > last) ? b - 2*a : last + 1;
+		j1 = (b >= self->dst_w) ? self->dst_w - 1 : b;
+		for(; j <= j1; ++j)
+		{
+			lanczos_gridder1D_output(self, j, dst);
+		}
+
+		if(j1 > last)
+		{
+			last = j1;
+		}
+		self->state[b] &= ~LANCZOS_GRIDDER1D_CHANGED;
+	}
+	self->changed_count = 0;
+
+	return 1;
+}
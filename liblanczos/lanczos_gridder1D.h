@@ -0,0 +1,98 @@
+/*
+ * Copyright (c) 2025 Jeff Boody
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included
+ * in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+
+#ifndef lanczos_gridder1D_H
+#define lanczos_gridder1D_H
+
+#include <stdint.h>
+
+#include "lanczos_kernel.h"
+
+typedef struct
+{
+	int32_t count;
+	int32_t size;
+	float*  data; // n=size*(2 + channels) : {jf,x,val}
+} lanczos_gridder1DBin_t;
+
+// A persistent irregular 1D gridder whose samples are
+// inserted and removed in batches. The bins match those of
+// lanczos_resample_irregular1D (dst_w + 2*a bins where
+// output j is the center of bin j + a) and store their
+// samples in insertion order. The partial sums of each bin
+// are stored for the 2a + 1 outputs that it supports where
+// part[(2a + 1)*m + d] holds {w,num} of output j = m - d
+// such that output j is the sum of vk[m]*part for the bins
+// m in [j, j + 2a].
+//
+// Updates only mark the bins whose samples changed and the
+// flush recomputes the holes, densities, partial sums and
+// outputs within the support radius of those bins. The
+// cost of an update is proportional to the batch size
+// rather than the dataset size and the result does not
+// depend on the update history. The flush only writes the
+// outputs that changed since the previous flush so dst
+// should hold the result of the previous flush (the first
+// flush writes every output).
+typedef struct
+{
+	uint32_t         flags;
+	int32_t          a;
+	int32_t          channels;
+	float            src_x0;
+	float            src_x1;
+	int32_t          dst_w;
+	int32_t          bin_count;
+	lanczos_kernel_t kernel;
+
+	lanczos_gridder1DBin_t* bins;  // n=bin_count
+	float*                  holes; // n=bin_count*(1 + channels) : {x,val}
+	float*                  vk;    // n=bin_count
+	float*                  part;  // n=bin_count*(2a + 1)*(1 + channels)
+
+	// bins whose samples changed (dirty) and bins whose
+	// density or partial sums changed since the last flush
+	uint8_t* state;   // n=bin_count
+	int32_t  dirty_count;
+	int32_t* dirty;   // n=bin_count
+	int32_t  changed_count;
+	int32_t* changed; // n=bin_count
+} lanczos_gridder1D_t;
+
+lanczos_gridder1D_t* lanczos_gridder1D_new(uint32_t flags,
+                                           int32_t a,
+                                           int32_t channels,
+                                           float src_x0,
+                                           float src_x1,
+                                           int32_t dst_w);
+void                 lanczos_gridder1D_delete(lanczos_gridder1D_t** _self);
+int                  lanczos_gridder1D_insert(lanczos_gridder1D_t* self,
+                                              int32_t count,
+                                              const float* src);
+int                  lanczos_gridder1D_remove(lanczos_gridder1D_t* self,
+                                              int32_t count,
+                                              const float* src);
+int                  lanczos_gridder1D_flush(lanczos_gridder1D_t* self,
+                                             float* dst);
+
+#endif
@@ -0,0 +1,774 @@
+/*
+ * Copyright (c) 2025 Jeff Boody
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included
+ * in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define LOG_TAG "lanczos"
+#include "../../libcc/cc_log.h"
+#include "../../libcc/cc_memory.h"
+#include "lanczos_gridder2D.h"
+#include "lanczos_resample.h"
+
+// density compensation threshold
+#define LANCZOS_GRIDDER2D_EPSILON 1e-6f
+
+// cell state
+#define LANCZOS_GRIDDER2D_DIRTY   0x1
+#define LANCZOS_GRIDDER2D_HOLE    0x2
+#define LANCZOS_GRIDDER2D_DENSITY 0x4
+
+/*
+ * private
+ */
+
+static int
+lanczos_gridder2D_compare(const void* a, const void* b)
+{
+	ASSERT(a);
+	ASSERT(b);
+
+	int32_t ia = *((const int32_t*) a);
+	int32_t ib = *((const int32_t*) b);
+	return (ia > ib) - (ia < ib);
+}
+
+static int32_t
+lanczos_gridder2D_cell(lanczos_gridder2D_t* self,
+                       const float* xy, float* _jfx,
+                       float* _jfy)
+{
+	ASSERT(self);
+	ASSERT(xy);
+	ASSERT(_jfx);
+	ASSERT(_jfy);
+
+	// compute xi2jf as in lanczos_grid2D_cell
+	float jfx = self->sx*(xy[0] - self->x0);
+	float jfy = self->sy*(xy[1] - self->y0);
+	*_jfx = jfx;
+	*_jfy = jfy;
+
+	// discard samples outside cell range
+	// shift j to allow for support samples outside (x0..x1)
+	int32_t jx = ((int32_t) floorf(jfx)) + self->a;
+	int32_t jy = ((int32_t) floorf(jfy)) + self->a;
+	if((jx < 0) || (jx >= self->w) || (jy < 0) || (jy >= self->h))
+	{
+		return -1;
+	}
+
+	return jy*self->w + jx;
+}
+
+static void
+lanczos_gridder2D_mark(lanczos_gridder2D_t* self, int32_t c,
+                       uint8_t state)
+{
+	ASSERT(self);
+
+	if(self->state[c] & state)
+	{
+		return;
+	}
+	self->state[c] |= state;
+
+	if(state == LANCZOS_GRIDDER2D_DIRTY)
+	{
+		self->dirty[self->dirty_count++] = c;
+	}
+	else if(state == LANCZOS_GRIDDER2D_HOLE)
+	{
+		self->hole[self->hole_count++] = c;
+	}
+	else
+	{
+		self->density[self->density_count++] = c;
+	}
+}
+
+static float
+lanczos_gridder2D_L(lanczos_gridder2D_t* self, float dx,
+                    float dy)
+{
+	ASSERT(self);
+
+	if(self->isotropic)
+	{
+		return lanczos_kernel_eval(&self->kernel,
+		                           sqrtf(dx*dx + dy*dy));
+	}
+
+	return lanczos_kernel_eval(&self->kernel, dx)*
+	       lanczos_kernel_eval(&self->kernel, dy);
+}
+
+static const float*
+lanczos_gridder2D_nearest(lanczos_gridder2D_t* self,
+                          int32_t c, float jfx, float jfy,
+                          float* _d2)
+{
+	ASSERT(self);
+	ASSERT(_d2);
+
+	lanczos_gridder2DCell_t* cell   = &self->cells[c];
+	int32_t                  stride = 4 + self->channels;
+
+	// find the nearest sample {x,y,val} of the cell
+	int32_t      k;
+	float        d2;
+	const float* data;
+	const float* xmin  = NULL;
+	float        d2min = 0.0f;
+	for(k = 0; k < cell->count; ++k)
+	{
+		data = &cell->data[stride*k];
+		d2   = (data[0] - jfx)*(data[0] - jfx) +
+		       (data[1] - jfy)*(data[1] - jfy);
+		if((xmin == NULL) || (d2 < d2min))
+		{
+			xmin  = &data[2];
+			d2min = d2;
+		}
+	}
+
+	*_d2 = d2min;
+	return xmin;
+}
+
+static void
+lanczos_gridder2D_fillHole(lanczos_gridder2D_t* self,
+                           int32_t c)
+{
+	ASSERT(self);
+
+	int32_t a        = self->a;
+	int32_t channels = self->channels;
+	int32_t cx       = c%self->w;
+	int32_t cy       = c/self->w;
+	float*  dat      = &self->holes[((size_t) c)*(2 + channels)];
+
+	// compute jf2xi
+	float jfx = ((float) (cx - a)) + 0.5f;
+	float jfy = ((float) (cy - a)) + 0.5f;
+	dat[0] = self->x0 + jfx/self->sx;
+	dat[1] = self->y0 + jfy/self->sy;
+	memset(&dat[2], 0, channels*sizeof(float));
+
+	if(self->flags & LANCZOS_FLAG_NODATA_ZERO)
+	{
+		return;
+	}
+
+	int nearest = self->flags & LANCZOS_FLAG_NODATA_NEAREST;
+
+	// the nearest sample of each populated cell within the
+	// support radius as in lanczos_grid2D_fillHole
+	int32_t      ch;
+	int32_t      i;
+	int32_t      j;
+	float        d2min;
+	float        w;
+	float        wsum = 0.0f;
+	float        best = 0.0f;
+	const float* xmin;
+	const float* xbest = NULL;
+	int32_t      i0 = (cy - a < 0) ? 0 : cy - a;
+	int32_t      i1 = (cy + a >= self->h) ? self->h - 1 : cy + a;
+	int32_t      j0 = (cx - a < 0) ? 0 : cx - a;
+	int32_t      j1 = (cx + a >= self->w) ? self->w - 1 : cx + a;
+	for(i = i0; i <= i1; ++i)
+	{
+		for(j = j0; j <= j1; ++j)
+		{
+			xmin = lanczos_gridder2D_nearest(self, i*self->w + j,
+			                                 jfx, jfy, &d2min);
+			if(xmin == NULL)
+			{
+				continue;
+			}
+
+			if((xbest == NULL) || (d2min < best))
+			{
+				xbest = xmin;
+				best  = d2min;
+			}
+
+			if(nearest || (d2min == 0.0f))
+			{
+				continue;
+			}
+
+			w     = 1.0f/sqrtf(d2min);
+			wsum += w;
+			for(ch = 0; ch < channels; ++ch)
+			{
+				dat[ch + 2] += w*xmin[ch + 2];
+			}
+		}
+	}
+
+	// fallback to ZERO when no samples are found
+	if(xbest == NULL)
+	{
+		return;
+	}
+
+	// copy NEAREST or coincident samples
+	if(nearest || (best == 0.0f))
+	{
+		memcpy(&dat[2], &xbest[2], channels*sizeof(float));
+		return;
+	}
+
+	for(ch = 0; ch < channels; ++ch)
+	{
+		dat[ch + 2] /= wsum;
+	}
+}
+
+static void
+lanczos_gridder2D_density(lanczos_gridder2D_t* self,
+                          int32_t c)
+{
+	ASSERT(self);
+
+	int32_t a      = self->a;
+	int32_t stride = 4 + self->channels;
+	int32_t cx     = c%self->w;
+	int32_t cy     = c/self->w;
+	int32_t i0     = (cy - a < 0) ? 0 : cy - a;
+	int32_t i1     = (cy + a >= self->h) ? self->h - 1 : cy + a;
+	int32_t j0     = (cx - a < 0) ? 0 : cx - a;
+	int32_t j1     = (cx + a >= self->w) ? self->w - 1 : cx + a;
+
+	// sum the kernel for the samples within the support
+	// radius of the cell center where the hole of an empty
+	// cell is located at the cell center
+	lanczos_gridder2DCell_t* cell;
+	int32_t                  i;
+	int32_t                  j;
+	int32_t                  k;
+	float                    ccx = ((float) (cx - a)) + 0.5f;
+	float                    ccy = ((float) (cy - a)) + 0.5f;
+	float                    sum = 0.0f;
+	const float*             data;
+	for(i = i0; i <= i1; ++i)
+	{
+		for(j = j0; j <= j1; ++j)
+		{
+			cell = &self->cells[i*self->w + j];
+			if(cell->count == 0)
+			{
+				sum += lanczos_gridder2D_L(self,
+				                           ((float) (j - a)) + 0.5f - ccx,
+				                           ((float) (i - a)) + 0.5f - ccy);
+				continue;
+			}
+
+			for(k = 0; k < cell->count; ++k)
+			{
+				data = &cell->data[stride*k];
+				sum += lanczos_gridder2D_L(self, data[0] - ccx,
+				                           data[1] - ccy);
+			}
+		}
+	}
+
+	self->vk[c] = 0.0f;
+	if(fabsf(sum) > LANCZOS_GRIDDER2D_EPSILON)
+	{
+		self->vk[c] = 1.0f/sum;
+	}
+}
+
+static void
+lanczos_gridder2D_output(lanczos_gridder2D_t* self,
+                         int32_t o, float* dst)
+{
+	ASSERT(self);
+	ASSERT(dst);
+
+	int32_t a        = self->a;
+	int32_t channels = self->channels;
+	int32_t stride   = 4 + channels;
+	int32_t x        = o%self->dst_w;
+	int32_t y        = o/self->dst_w;
+	float*  s2       = &dst[((size_t) o)*channels];
+
+	int32_t                  ch;
+	int32_t                  i;
+	int32_t                  j;
+	int32_t                  k;
+	int32_t                  m;
+	float                    ccx = ((float) x) + 0.5f;
+	float                    ccy = ((float) y) + 0.5f;
+	float                    w;
+	float                    wj = 0.0f;
+	lanczos_gridder2DCell_t* cell;
+	const float*             s1;
+	const float*             data;
+	for(ch = 0; ch < channels; ++ch)
+	{
+		s2[ch] = 0.0f;
+	}
+
+	// output (x, y) is the center of cell (x + a, y + a) and
+	// is supported by the cells [x, x + 2a]x[y, y + 2a]
+	for(i = y; i <= y + 2*a; ++i)
+	{
+		for(j = x; j <= x + 2*a; ++j)
+		{
+			m    = i*self->w + j;
+			cell = &self->cells[m];
+			if(cell->count == 0)
+			{
+				s1  = &self->holes[((size_t) m)*(2 + channels)];
+				w   = self->vk[m]*
+				      lanczos_gridder2D_L(self,
+				                          ((float) (j - a)) + 0.5f - ccx,
+				                          ((float) (i - a)) + 0.5f - ccy);
+				wj += w;
+				for(ch = 0; ch < channels; ++ch)
+				{
+					s2[ch] += w*s1[ch + 2];
+				}
+				continue;
+			}
+
+			for(k = 0; k < cell->count; ++k)
+			{
+				data = &cell->data[stride*k];
+				s1   = &data[2];
+				w    = self->vk[m]*
+				       lanczos_gridder2D_L(self, data[0] - ccx,
+				                           data[1] - ccy);
+				wj  += w;
+				for(ch = 0; ch < channels; ++ch)
+				{
+					s2[ch] += w*s1[ch + 2];
+				}
+			}
+		}
+	}
+
+	w = 0.0f;
+	if(fabsf(wj) > LANCZOS_GRIDDER2D_EPSILON)
+	{
+		w = 1.0f/wj;
+	}
+
+	for(ch = 0; ch < channels; ++ch)
+	{
+		s2[ch] *= w;
+	}
+}
+
+/*
+ * public
+ */
+
+lanczos_gridder2D_t*
+lanczos_gridder2D_new(uint32_t flags, int32_t a,
+                      int32_t channels, float src_x0,
+                      float src_y0, float src_x1,
+                      float src_y1, int32_t dst_w,
+                      int32_t dst_h)
+{
+	if((a <= 0) || (channels <= 0) || (dst_w <= 0) ||
+	   (dst_h <= 0) || (src_x1 == src_x0) ||
+	   (src_y1 == src_y0))
+	{
+		LOGE("invalid a=%i, channels=%i, dst=%ix%i",
+		     a, channels, dst_w, dst_h);
+		return NULL;
+	}
+
+	lanczos_gridder2D_t* self;
+	self = (lanczos_gridder2D_t*)
+	       CALLOC(1, sizeof(lanczos_gridder2D_t));
+	if(self == NULL)
+	{
+		LOGE("CALLOC failed");
+		return NULL;
+	}
+
+	self->flags     = flags;
+	self->a         = a;
+	self->channels  = channels;
+	self->dst_w     = dst_w;
+	self->dst_h     = dst_h;
+	self->isotropic = flags & LANCZOS_FLAG_MULTIDIM_2D_ISOTROPIC;
+	self->w         = dst_w + 2*a;
+	self->h         = dst_h + 2*a;
+	self->x0        = src_x0;
+	self->y0        = src_y0;
+	self->sx        = ((float) dst_w)/(src_x1 - src_x0);
+	self->sy        = ((float) dst_h)/(src_y1 - src_y0);
+
+	if(lanczos_kernel_init(&self->kernel, flags, a) == 0)
+	{
+		goto fail_kernel;
+	}
+
+	int32_t cells   = self->w*self->h;
+	int32_t outputs = dst_w*dst_h;
+
+	self->cells = (lanczos_gridder2DCell_t*)
+	              CALLOC(cells, sizeof(lanczos_gridder2DCell_t));
+	if(self->cells == NULL)
+	{
+		LOGE("CALLOC failed");
+		goto fail_cells;
+	}
+
+	self->holes = (float*)
+	              CALLOC(((size_t) cells)*(2 + channels), sizeof(float));
+	if(self->holes == NULL)
+	{
+		LOGE("CALLOC failed");
+		goto fail_holes;
+	}
+
+	self->vk = (float*) CALLOC(cells, sizeof(float));
+	if(self->vk == NULL)
+	{
+		LOGE("CALLOC failed");
+		goto fail_vk;
+	}
+
+	self->state = (uint8_t*) CALLOC(cells, sizeof(uint8_t));
+	if(self->state == NULL)
+	{
+		LOGE("CALLOC failed");
+		goto fail_state;
+	}
+
+	self->dirty = (int32_t*) CALLOC(cells, sizeof(int32_t));
+	if(self->dirty == NULL)
+	{
+		LOGE("CALLOC failed");
+		goto fail_dirty;
+	}
+
+	self->hole = (int32_t*) CALLOC(cells, sizeof(int32_t));
+	if(self->hole == NULL)
+	{
+		LOGE("CALLOC failed");
+		goto fail_hole;
+	}
+
+	self->density = (int32_t*) CALLOC(cells, sizeof(int32_t));
+	if(self->density == NULL)
+	{
+		LOGE("CALLOC failed");
+		goto fail_density;
+	}
+
+	self->output_state = (uint8_t*)
+	                     CALLOC(outputs, sizeof(uint8_t));
+	if(self->output_state == NULL)
+	{
+		LOGE("CALLOC failed");
+		goto fail_output_state;
+	}
+
+	self->output = (int32_t*) CALLOC(outputs, sizeof(int32_t));
+	if(self->output == NULL)
+	{
+		LOGE("CALLOC failed");
+		goto fail_output;
+	}
+
+	// the first flush computes every cell
+	int32_t c;
+	for(c = 0; c < cells; ++c)
+	{
+		lanczos_gridder2D_mark(self, c, LANCZOS_GRIDDER2D_DIRTY);
+	}
+
+	// success
+	return self;
+
+	// failure
+	fail_output:
+		FREE(self->output_state);
+	fail_output_state:
+		FREE(self->density);
+	fail_density:
+		FREE(self->hole);
+	fail_hole:
+		FREE(self->dirty);
+	fail_dirty:
+		FREE(self->state);
+	fail_state:
+		FREE(self->vk);
+	fail_vk:
+		FREE(self->holes);
+	fail_holes:
+		FREE(self->cells);
+	fail_cells:
+	fail_kernel:
+		FREE(self);
+	return NULL;
+}
+
+void lanczos_gridder2D_delete(lanczos_gridder2D_t** _self)
+{
+	ASSERT(_self);
+
+	lanczos_gridder2D_t* self = *_self;
+	if(self)
+	{
+		int32_t c;
+		for(c = 0; c < self->w*self->h; ++c)
+		{
+			FREE(self->cells[c].data);
+		}
+
+		FREE(self->output);
+		FREE(self->output_state);
+		FREE(self->density);
+		FREE(self->hole);
+		FREE(self->dirty);
+		FREE(self->state);
+		FREE(self->vk);
+		FREE(self->holes);
+		FREE(self->cells);
+		FREE(self);
+		*_self = NULL;
+	}
+}
+
+int lanczos_gridder2D_insert(lanczos_gridder2D_t* self,
+                             int32_t count, const float* src)
+{
+	ASSERT(self);
+	ASSERT(src || (count == 0));
+
+	int32_t stride = 4 + self->channels;
+
+	// append the samples {x,y,val} to their cells
+	lanczos_gridder2DCell_t* cell;
+	int32_t                  c;
+	int32_t                  i;
+	int32_t                  size;
+	float                    jfx;
+	float                    jfy;
+	float*                   data;
+	const float*             s1;
+	for(i = 0; i < count; ++i)
+	{
+		s1 = &src[((size_t) i)*(2 + self->channels)];
+		c  = lanczos_gridder2D_cell(self, s1, &jfx, &jfy);
+		if(c < 0)
+		{
+			continue;
+		}
+
+		cell = &self->cells[c];
+		if(cell->count == cell->size)
+		{
+			size = cell->size ? 2*cell->size : 4;
+			data = (float*)
+			       REALLOC(cell->data,
+			               size*stride*sizeof(float));
+			if(data == NULL)
+			{
+				LOGE("REALLOC failed");
+				return 0;
+			}
+			cell->data = data;
+			cell->size = size;
+		}
+
+		data    = &cell->data[stride*cell->count];
+		data[0] = jfx;
+		data[1] = jfy;
+		memcpy(&data[2], s1, (2 + self->channels)*sizeof(float));
+		++cell->count;
+
+		lanczos_gridder2D_mark(self, c, LANCZOS_GRIDDER2D_DIRTY);
+	}
+
+	return 1;
+}
+
+int lanczos_gridder2D_remove(lanczos_gridder2D_t* self,
+                             int32_t count, const float* src)
+{
+	ASSERT(self);
+	ASSERT(src || (count == 0));
+
+	int32_t stride = 4 + self->channels;
+	size_t  bytes  = (2 + self->channels)*sizeof(float);
+
+	// remove the first sample of the cell that is equal to
+	// {x,y,val} while preserving the insertion order
+	lanczos_gridder2DCell_t* cell;
+	int32_t                  c;
+	int32_t                  i;
+	int32_t                  k;
+	float                    jfx;
+	float                    jfy;
+	const float*             s1;
+	for(i = 0; i < count; ++i)
+	{
+		s1 = &src[((size_t) i)*(2 + self->channels)];
+		c  = lanczos_gridder2D_cell(self, s1, &jfx, &jfy);
+		if(c < 0)
+		{
+			continue;
+		}
+
+		cell = &self->cells[c];
+		for(k = 0; k < cell->count; ++k)
+		{
+			if(memcmp(&cell->data[stride*k + 2], s1, bytes) == 0)
+			{
+				break;
+			}
+		}
+
+		if(k == cell->count)
+		{
+			LOGW("invalid x=%f, y=%f", s1[0], s1[1]);
+			continue;
+		}
+
+		memmove(&cell->data[stride*k], &cell->data[stride*(k + 1)],
+		        (cell->count - k - 1)*stride*sizeof(float));
+		--cell->count;
+
+		lanczos_gridder2D_mark(self, c, LANCZOS_GRIDDER2D_DIRTY);
+	}
+
+	return 1;
+}
+
+int lanczos_gridder2D_flush(lanczos_gridder2D_t* self,
+                            float* dst)
+{
+	ASSERT(self);
+	ASSERT(dst);
+
+	int32_t a = self->a;
+	int32_t w = self->w;
+	int32_t h = self->h;
+
+	// a dirty cell changes the holes and densities of the
+	// cells within its support radius since 2D holes are
+	// filled from the samples within the support radius
+	// rather than from the previous hole
+	int32_t c;
+	int32_t d;
+	int32_t cx;
+	int32_t cy;
+	int32_t i;
+	int32_t j;
+	int32_t i0;
+	int32_t i1;
+	int32_t j0;
+	int32_t j1;
+	for(d = 0; d < self->dirty_count; ++d)
+	{
+		c  = self->dirty[d];
+		cx = c%w;
+		cy = c/w;
+		i0 = (cy - a < 0) ? 0 : cy - a;
+		i1 = (cy + a >= h) ? h - 1 : cy + a;
+		j0 = (cx - a < 0) ? 0 : cx - a;
+		j1 = (cx + a >= w) ? w - 1 : cx + a;
+		for(i = i0; i <= i1; ++i)
+		{
+			for(j = j0; j <= j1; ++j)
+			{
+				if(self->cells[i*w + j].count == 0)
+				{
+					lanczos_gridder2D_mark(self, i*w + j,
+					                       LANCZOS_GRIDDER2D_HOLE);
+				}
+				lanczos_gridder2D_mark(self, i*w + j,
+				                       LANCZOS_GRIDDER2D_DENSITY);
+			}
+		}
+		self->state[c] &= ~LANCZOS_GRIDDER2D_DIRTY;
+	}
+	self->dirty_count = 0;
+
+	// 2D Hole Filling
+	for(d = 0; d < self->hole_count; ++d)
+	{
+		c = self->hole[d];
+		lanczos_gridder2D_fillHole(self, c);
+		self->state[c] &= ~LANCZOS_GRIDDER2D_HOLE;
+	}
+	self->hole_count = 0;
+
+	// Density Compensation
+	// cell (cx, cy) supports the outputs
+	// [cx - 2a, cx]x[cy - 2a, cy]
+	int32_t o;
+	for(d = 0; d < self->density_count; ++d)
+	{
+		c = self->density[d];
+		lanczos_gridder2D_density(self, c);
+		self->state[c] &= ~LANCZOS_GRIDDER2D_DENSITY;
+
+		cx = c%w;
+		cy = c/w;
+		i0 = (cy - 2*a < 0) ? 0 : cy - 2*a;
+		i1 = (cy >= self->dst_h) ? self->dst_h - 1 : cy;
+		j0 = (cx - 2*a < 0) ? 0 : cx - 2*a;
+		j1 = (cx >= self->dst_w) ? self->dst_w - 1 : cx;
+		for(i = i0; i <= i1; ++i)
+		{
+			for(j = j0; j <= j1; ++j)
+			{
+				o = i*self->dst_w + j;
+				if(self->output_state[o] == 0)
+				{
+					self->output_state[o] = 1;
+					self->output[self->output_count++] = o;
+				}
+			}
+		}
+	}
+	self->density_count = 0;
+
+	// Irregular Interpolation and Normalization
+	// the outputs are resampled in memory order
+	qsort(self->output, self->output_count, sizeof(int32_t),
+	      lanczos_gridder2D_compare);
+
+	for(d = 0; d < self->output_count; ++d)
+	{
+		o = self->output[d];
+		lanczos_gridder2D_output(self, o, dst);
+		self->output_state[o] = 0;
+	}
+	self->output_count = 0;
+
+	return 1;
+}
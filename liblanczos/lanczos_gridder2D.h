@@ -0,0 +1,117 @@
+/*
+ * Copyright (c) 2025 Jeff Boody
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included
+ * in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+
+#ifndef lanczos_gridder2D_H
+#define lanczos_gridder2D_H
+
+#include <stdint.h>
+
+#include "lanczos_kernel.h"
+
+typedef struct
+{
+	int32_t count;
+	int32_t size;
+	float*  data; // n=size*(4 + channels) : {jfx,jfy,x,y,val}
+} lanczos_gridder2DCell_t;
+
+// A persistent irregular 2D gridder whose samples are
+// inserted and removed in batches. The cells match those of
+// lanczos_grid2D_t ((dst_w + 2*a)x(dst_h + 2*a) cells where
+// output (x, y) is the center of cell (x + a, y + a)) and
+// store their samples in insertion order.
+//
+// Updates only mark the cells whose samples changed and the
+// flush recomputes the holes and densities of the cells
+// within the support radius of those cells followed by the
+// outputs whose support window contains a recomputed cell.
+// Unlike lanczos_gridder1D_t the partial sums of the
+// outputs are not stored since they would require
+// (2a + 1)^2 sums per cell so the outputs are gathered from
+// the cells of their support window. The cost of an update
+// is proportional to the batch size rather than the dataset
+// size and the result does not depend on the update
+// history. The flush only writes the outputs that changed
+// since the previous flush so dst should hold the result of
+// the previous flush (the first flush writes every output).
+// The cells replace the adaptive index
+// (LANCZOS_FLAG_INDEX_ADAPTIVE is ignored).
+typedef struct
+{
+	uint32_t         flags;
+	int32_t          a;
+	int32_t          channels;
+	int32_t          dst_w;
+	int32_t          dst_h;
+	int              isotropic;
+	lanczos_kernel_t kernel;
+
+	// cells (dst_w + 2*a)x(dst_h + 2*a)
+	int32_t w;
+	int32_t h;
+
+	// mapjf
+	float x0;
+	float y0;
+	float sx;
+	float sy;
+
+	lanczos_gridder2DCell_t* cells; // n=w*h
+	float*                   holes; // n=w*h*(2 + channels) : {x,y,val}
+	float*                   vk;    // n=w*h
+
+	// cells whose samples changed (dirty), cells whose hole
+	// or density must be recomputed and the outputs whose
+	// support window contains a recomputed cell
+	uint8_t* state;        // n=w*h
+	int32_t  dirty_count;
+	int32_t* dirty;        // n=w*h
+	int32_t  hole_count;
+	int32_t* hole;         // n=w*h
+	int32_t  density_count;
+	int32_t* density;      // n=w*h
+	uint8_t* output_state; // n=dst_w*dst_h
+	int32_t  output_count;
+	int32_t* output;       // n=dst_w*dst_h
+} lanczos_gridder2D_t;
+
+lanczos_gridder2D_t* lanczos_gridder2D_new(uint32_t flags,
+                                           int32_t a,
+                                           int32_t channels,
+                                           float src_x0,
+                                           float src_y0,
+                                           float src_x1,
+                                           float src_y1,
+                                           int32_t dst_w,
+                                           int32_t dst_h);
+void                 lanczos_gridder2D_delete(lanczos_gridder2D_t** _self);
+int                  lanczos_gridder2D_insert(lanczos_gridder2D_t* self,
+                                              int32_t count,
+                                              const float* src);
+int                  lanczos_gridder2D_remove(lanczos_gridder2D_t* self,
+                                              int32_t count,
+                                              const float* src);
+int                  lanczos_gridder2D_flush(lanczos_gridder2D_t* self,
+                                             float* dst);
+
+#endif
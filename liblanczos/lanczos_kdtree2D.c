@@ -0,0 +1,428 @@
+/*
+ * Copyright (c) 2025 Jeff Boody
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included
+ * in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+
+#include <float.h>
+#include <stdlib.h>
+
+#define LOG_TAG "lanczos"
+#include "../../libcc/cc_log.h"
+#include "../../libcc/cc_memory.h"
+#include "lanczos_kdtree2D.h"
+
+/*
+ * private
+ */
+
+static void
+lanczos_kdtree2D_swap(lanczos_kdtree2D_t* self,
+                      int32_t i, int32_t j)
+{
+	ASSERT(self);
+
+	int32_t index = self->index[i];
+	float   x     = self->xy[2*((size_t) i)];
+	float   y     = self->xy[2*((size_t) i) + 1];
+	self->index[i]               = self->index[j];
+	self->xy[2*((size_t) i)]     = self->xy[2*((size_t) j)];
+	self->xy[2*((size_t) i) + 1] = self->xy[2*((size_t) j) + 1];
+	self->index[j]               = index;
+	self->xy[2*((size_t) j)]     = x;
+	self->xy[2*((size_t) j) + 1] = y;
+}
+
+static void
+lanczos_kdtree2D_select(lanczos_kdtree2D_t* self,
+                        int32_t axis, int32_t k0, int32_t k1,
+                        int32_t m)
+{
+	ASSERT(self);
+
+	// partition [k0, k1) such that the samples before m are
+	// less or equal and the samples after m are greater or
+	// equal to sample m along the axis (quickselect)
+	float*  xy = self->xy;
+	int32_t lo = k0;
+	int32_t hi = k1 - 1;
+	int32_t i;
+	int32_t j;
+	float   pivot;
+	while(hi > lo)
+	{
+		pivot = xy[2*((size_t) (lo + (hi - lo)/2)) + axis];
+		i     = lo;
+		j     = hi;
+		while(i <= j)
+		{
+			while(xy[2*((size_t) i) + axis] < pivot)
+			{
+				++i;
+			}
+			while(xy[2*((size_t) j) + axis] > pivot)
+			{
+				--j;
+			}
+			if(i <= j)
+			{
+				lanczos_kdtree2D_swap(self, i, j);
+				++i;
+				--j;
+			}
+		}
+
+		// samples (j, i) are equal to the pivot
+		if(m <= j)
+		{
+			hi = j;
+		}
+		else if(m >= i)
+		{
+			lo = i;
+		}
+		else
+		{
+			break;
+		}
+	}
+}
+
+static void
+lanczos_kdtree2D_bound(lanczos_kdtree2D_t* self,
+                       lanczos_kdtree2DNode_t* node)
+{
+	ASSERT(self);
+	ASSERT(node);
+
+	float* box = node->box;
+	box[0] = FLT_MAX;
+	box[1] = FLT_MAX;
+	box[2] = -FLT_MAX;
+	box[3] = -FLT_MAX;
+
+	int32_t      k;
+	const float* xy;
+	for(k = node->k0; k < node->k1; ++k)
+	{
+		xy = &self->xy[2*((size_t) k)];
+		if(xy[0] < box[0]) box[0] = xy[0];
+		if(xy[1] < box[1]) box[1] = xy[1];
+		if(xy[0] > box[2]) box[2] = xy[0];
+		if(xy[1] > box[3]) box[3] = xy[1];
+	}
+}
+
+static int
+lanczos_kdtree2D_leaf(lanczos_kdtree2DNode_t* node)
+{
+	ASSERT(node);
+
+	return (node->k1 - node->k0) <= LANCZOS_KDTREE2D_BUCKET;
+}
+
+static float
+lanczos_kdtree2D_dist2(const float* box, float x, float y)
+{
+	ASSERT(box);
+
+	// squared distance from (x,y) to the box
+	float dx = 0.0f;
+	float dy = 0.0f;
+	if(x < box[0])
+	{
+		dx = box[0] - x;
+	}
+	else if(x > box[2])
+	{
+		dx = x - box[2];
+	}
+
+	if(y < box[1])
+	{
+		dy = box[1] - y;
+	}
+	else if(y > box[3])
+	{
+		dy = y - box[3];
+	}
+
+	return dx*dx + dy*dy;
+}
+
+static int
+lanczos_kdtree2D_disjoint(const float* a, const float* b)
+{
+	ASSERT(a);
+	ASSERT(b);
+
+	return (a[2] < b[0]) || (a[0] > b[2]) ||
+	       (a[3] < b[1]) || (a[1] > b[3]);
+}
+
+static int32_t lanczos_kdtree2D_depth(int32_t count)
+{
+	// the node sizes of each level differ by at most one
+	// such that the leaves are found within depth levels
+	int32_t depth = 0;
+	int32_t size  = count;
+	while(size > LANCZOS_KDTREE2D_BUCKET)
+	{
+		size = size - size/2;
+		++depth;
+	}
+	return depth;
+}
+
+/*
+ * public
+ */
+
+lanczos_kdtree2D_t*
+lanczos_kdtree2D_new(lanczos_workspace_t* ws, int32_t count,
+                     int32_t* index, float* xy)
+{
+	ASSERT(count >= 0);
+	ASSERT(index || (count == 0));
+	ASSERT(xy    || (count == 0));
+
+	int32_t depth = lanczos_kdtree2D_depth(count);
+
+	if(depth >= LANCZOS_KDTREE2D_DEPTH)
+	{
+		LOGE("invalid count=%i", count);
+		return NULL;
+	}
+
+	lanczos_kdtree2D_t* self;
+	self = (lanczos_kdtree2D_t*)
+	       lanczos_workspace_calloc(ws, 1,
+	                                sizeof(lanczos_kdtree2D_t));
+	if(self == NULL)
+	{
+		LOGE("CALLOC failed");
+		return NULL;
+	}
+
+	self->ws         = ws;
+	self->count      = count;
+	self->index      = index;
+	self->xy         = xy;
+	self->node_count = (2 << depth) - 1;
+
+	self->nodes = (lanczos_kdtree2DNode_t*)
+	              lanczos_workspace_calloc(ws, self->node_count,
+	                                       sizeof(lanczos_kdtree2DNode_t));
+	if(self->nodes == NULL)
+	{
+		LOGE("CALLOC failed");
+		goto fail_nodes;
+	}
+
+	// split the nodes in breadth first order where the
+	// unreached children of leaves remain empty
+	lanczos_kdtree2DNode_t* node;
+	lanczos_kdtree2DNode_t* left;
+	lanczos_kdtree2DNode_t* right;
+	int32_t                 axis;
+	int32_t                 m;
+	int32_t                 n;
+	node     = &self->nodes[0];
+	node->k1 = count;
+	lanczos_kdtree2D_bound(self, node);
+	for(n = 0; n < self->node_count; ++n)
+	{
+		node = &self->nodes[n];
+		if(lanczos_kdtree2D_leaf(node))
+		{
+			continue;
+		}
+
+		// split the longest axis at the median
+		axis = 0;
+		if((node->box[3] - node->box[1]) >
+		   (node->box[2] - node->box[0]))
+		{
+			axis = 1;
+		}
+		m = node->k0 + (node->k1 - node->k0)/2;
+		lanczos_kdtree2D_select(self, axis,
+		                        node->k0, node->k1, m);
+
+		left      = &self->nodes[2*n + 1];
+		right     = &self->nodes[2*n + 2];
+		left->k0  = node->k0;
+		left->k1  = m;
+		right->k0 = m;
+		right->k1 = node->k1;
+		lanczos_kdtree2D_bound(self, left);
+		lanczos_kdtree2D_bound(self, right);
+	}
+
+	// success
+	return self;
+
+	// failure
+	fail_nodes:
+		lanczos_workspace_free(ws, self);
+	return NULL;
+}
+
+void lanczos_kdtree2D_delete(lanczos_kdtree2D_t** _self)
+{
+	ASSERT(_self);
+
+	lanczos_kdtree2D_t* self = *_self;
+	if(self)
+	{
+		lanczos_workspace_free(self->ws, self->nodes);
+		lanczos_workspace_free(self->ws, self);
+		*_self = NULL;
+	}
+}
+
+size_t lanczos_kdtree2D_workspace(int32_t count)
+{
+	int32_t depth = lanczos_kdtree2D_depth(count);
+	return lanczos_workspace_bytes(1, sizeof(lanczos_kdtree2D_t)) +
+	       lanczos_workspace_bytes((2 << depth) - 1,
+	                               sizeof(lanczos_kdtree2DNode_t));
+}
+
+void lanczos_kdtree2D_range(lanczos_kdtree2D_t* self,
+                            const float* box,
+                            lanczos_kdtree2D_fn fn, void* arg)
+{
+	ASSERT(self);
+	ASSERT(box);
+	ASSERT(fn);
+
+	if(self->count == 0)
+	{
+		return;
+	}
+
+	// depth first traversal where a subtree that is
+	// contained by the box is a single range
+	lanczos_kdtree2DNode_t* node;
+	int32_t                 stack[LANCZOS_KDTREE2D_DEPTH + 1];
+	int32_t                 top = 0;
+	int32_t                 n;
+	stack[top++] = 0;
+	while(top)
+	{
+		n    = stack[--top];
+		node = &self->nodes[n];
+		if(lanczos_kdtree2D_disjoint(node->box, box))
+		{
+			continue;
+		}
+
+		if(lanczos_kdtree2D_leaf(node) ||
+		   ((node->box[0] >= box[0]) && (node->box[2] <= box[2]) &&
+		    (node->box[1] >= box[1]) && (node->box[3] <= box[3])))
+		{
+			fn(arg, node->k0, node->k1);
+			continue;
+		}
+
+		stack[top++] = 2*n + 2;
+		stack[top++] = 2*n + 1;
+	}
+}
+
+int32_t lanczos_kdtree2D_nearest(lanczos_kdtree2D_t* self,
+                                 float x, float y,
+                                 const float* box, float* _d2)
+{
+	ASSERT(self);
+	ASSERT(box);
+	ASSERT(_d2);
+
+	if(self->count == 0)
+	{
+		return -1;
+	}
+
+	// depth first traversal of the nearer child first which
+	// prunes the subtrees that are farther than the nearest
+	// sample found so far or outside of the box [x0,x1)x[y0,y1)
+	lanczos_kdtree2DNode_t* node;
+	lanczos_kdtree2DNode_t* left;
+	lanczos_kdtree2DNode_t* right;
+	const float*            xy;
+	int32_t                 stack[LANCZOS_KDTREE2D_DEPTH + 1];
+	int32_t                 top   = 0;
+	int32_t                 best  = -1;
+	float                   d2min = FLT_MAX;
+	float                   d2;
+	int32_t                 k;
+	int32_t                 n;
+	stack[top++] = 0;
+	while(top)
+	{
+		n    = stack[--top];
+		node = &self->nodes[n];
+		if(lanczos_kdtree2D_disjoint(node->box, box) ||
+		   (lanczos_kdtree2D_dist2(node->box, x, y) > d2min))
+		{
+			continue;
+		}
+
+		if(lanczos_kdtree2D_leaf(node))
+		{
+			for(k = node->k0; k < node->k1; ++k)
+			{
+				xy = &self->xy[2*((size_t) k)];
+				if((xy[0] < box[0]) || (xy[0] >= box[2]) ||
+				   (xy[1] < box[1]) || (xy[1] >= box[3]))
+				{
+					continue;
+				}
+
+				d2 = (xy[0] - x)*(xy[0] - x) +
+				     (xy[1] - y)*(xy[1] - y);
+				if((best < 0) || (d2 < d2min))
+				{
+					best  = k;
+					d2min = d2;
+				}
+			}
+			continue;
+		}
+
+		left  = &self->nodes[2*n + 1];
+		right = &self->nodes[2*n + 2];
+		if(lanczos_kdtree2D_dist2(left->box, x, y) <
+		   lanczos_kdtree2D_dist2(right->box, x, y))
+		{
+			stack[top++] = 2*n + 2;
+			stack[top++] = 2*n + 1;
+		}
+		else
+		{
+			stack[top++] = 2*n + 1;
+			stack[top++] = 2*n + 2;
+		}
+	}
+
+	*_d2 = d2min;
+	return best;
+}
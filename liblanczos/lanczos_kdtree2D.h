@@ -0,0 +1,90 @@
+/*
+ * Copyright (c) 2025 Jeff Boody
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included
+ * in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+
+#ifndef lanczos_kdtree2D_H
+#define lanczos_kdtree2D_H
+
+#include <stdint.h>
+
+#include "lanczos_workspace.h"
+
+// maximum number of samples per leaf
+#define LANCZOS_KDTREE2D_BUCKET 16
+
+// maximum depth of the tree
+#define LANCZOS_KDTREE2D_DEPTH 32
+
+// range callback
+// the samples [k0, k1) are the contents of a leaf (or
+// subtree) whose bounds intersect the query box and may
+// include samples outside of the box
+typedef void (*lanczos_kdtree2D_fn)(void* arg, int32_t k0,
+                                    int32_t k1);
+
+typedef struct
+{
+	// bounds {x0,y0,x1,y1}
+	float box[4];
+
+	// samples [k0, k1)
+	int32_t k0;
+	int32_t k1;
+} lanczos_kdtree2DNode_t;
+
+// A bucketed k-d tree of 2D samples which is built in one
+// bulk pass by median splits along the longest axis of
+// each node. The sample arrays are owned by the caller and
+// are permuted in place such that the samples of every
+// subtree are a contiguous range. The nodes are stored
+// implicitly where the children of node n are 2n + 1 and
+// 2n + 2 and a node with at most LANCZOS_KDTREE2D_BUCKET
+// samples is a leaf.
+typedef struct
+{
+	// optional workspace
+	lanczos_workspace_t* ws;
+
+	int32_t  count;
+	int32_t* index; // n=count
+	float*   xy;    // n=2*count
+
+	int32_t                 node_count;
+	lanczos_kdtree2DNode_t* nodes;
+} lanczos_kdtree2D_t;
+
+lanczos_kdtree2D_t* lanczos_kdtree2D_new(lanczos_workspace_t* ws,
+                                         int32_t count,
+                                         int32_t* index,
+                                         float* xy);
+void                lanczos_kdtree2D_delete(lanczos_kdtree2D_t** _self);
+void                lanczos_kdtree2D_range(lanczos_kdtree2D_t* self,
+                                           const float* box,
+                                           lanczos_kdtree2D_fn fn,
+                                           void* arg);
+int32_t             lanczos_kdtree2D_nearest(lanczos_kdtree2D_t* self,
+                                             float x, float y,
+                                             const float* box,
+                                             float* _d2);
+size_t              lanczos_kdtree2D_workspace(int32_t count);
+
+#endif
@@ -0,0 +1,188 @@
+/*
+ * Copyright (c) 2025 Jeff Boody
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included
+ * in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+
+#include <math.h>
+#include <pthread.h>
+#include <stdlib.h>
+
+#define LOG_TAG "lanczos"
+#include "../../libcc/cc_log.h"
+#include "../../libcc/cc_memory.h"
+#include "lanczos_kernel.h"
+#include "lanczos_resample.h"
+
+// process-wide kernel tables indexed by oversampling and a
+static pthread_mutex_t lanczos_kernel_mutex =
+	PTHREAD_MUTEX_INITIALIZER;
+static float* lanczos_kernel_tables[2][LANCZOS_KERNEL_LUT_MAX_A + 1];
+
+/*
+ * private
+ */
+
+static double lanczos_kernel_Ld(double x, double a)
+{
+	if(x == 0.0)
+	{
+		return 1.0;
+	}
+	else if((x <= -a) || (x >= a))
+	{
+		return 0.0;
+	}
+
+	return a*sin(M_PI*x)*sin(M_PI*x/a)/(M_PI*M_PI*x*x);
+}
+
+static const float*
+lanczos_kernel_table(int32_t a, int32_t hi, int32_t scale)
+{
+	pthread_mutex_lock(&lanczos_kernel_mutex);
+
+	float* table = lanczos_kernel_tables[hi][a];
+	if(table)
+	{
+		pthread_mutex_unlock(&lanczos_kernel_mutex);
+		return table;
+	}
+
+	// the table is offset by one entry and padded by two
+	// entries such that the cubic interpolation may access
+	// entries k - 1 to k + 2 for x in [0, a)
+	int32_t n = a*scale;
+	table = (float*) CALLOC(n + 3, sizeof(float));
+	if(table == NULL)
+	{
+		LOGE("CALLOC failed");
+		pthread_mutex_unlock(&lanczos_kernel_mutex);
+		return NULL;
+	}
+
+	int32_t k;
+	for(k = 0; k <= n; ++k)
+	{
+		table[k + 1] = (float)
+		               lanczos_kernel_Ld(((double) k)/scale, a);
+	}
+
+	// L(x) is even
+	table[0] = table[2];
+
+	lanczos_kernel_tables[hi][a] = table;
+
+	pthread_mutex_unlock(&lanczos_kernel_mutex);
+
+	return table;
+}
+
+/*
+ * public
+ */
+
+float lanczos_kernel_sinc(float x)
+{
+	if(x == 0.0f)
+	{
+		return 1.0f;
+	}
+
+	return sinf(M_PI*x)/(M_PI*x);
+}
+
+float lanczos_kernel_L(float x, float a)
+{
+	if((-a < x) && (x < a))
+	{
+		return lanczos_kernel_sinc(x)*lanczos_kernel_sinc(x/a);
+	}
+
+	return 0.0f;
+}
+
+int lanczos_kernel_init(lanczos_kernel_t* self,
+                        uint32_t flags, int32_t a)
+{
+	ASSERT(self);
+
+	self->a     = (float) a;
+	self->cubic = 0;
+	self->scale = 0.0f;
+	self->n     = 0;
+	self->table = NULL;
+
+	if((flags & LANCZOS_FLAG_KERNEL_LUT) == 0)
+	{
+		return 1;
+	}
+
+	if((a <= 0) || (a > LANCZOS_KERNEL_LUT_MAX_A))
+	{
+		LOGE("invalid a=%i", a);
+		return 0;
+	}
+
+	int32_t hi    = (flags & LANCZOS_FLAG_KERNEL_LUT_4096) ? 1 : 0;
+	int32_t scale = hi ? 4096 : 1024;
+
+	self->table = lanczos_kernel_table(a, hi, scale);
+	if(self->table == NULL)
+	{
+		return 0;
+	}
+
+	self->cubic = (flags & LANCZOS_FLAG_KERNEL_LUT_CUBIC) ? 1 : 0;
+	self->scale = (float) scale;
+	self->n     = a*scale;
+
+	return 1;
+}
+
+float lanczos_kernel_eval(const lanczos_kernel_t* self, float x)
+{
+	ASSERT(self);
+
+	if(self->table == NULL)
+	{
+		return lanczos_kernel_L(x, self->a);
+	}
+
+	float   f = fabsf(x)*self->scale;
+	int32_t k = (int32_t) f;
+	if(k >= self->n)
+	{
+		return 0.0f;
+	}
+
+	// entry k + 1 of the table is L(k/scale)
+	float        t = f - (float) k;
+	const float* p = &self->table[k];
+	if(self->cubic)
+	{
+		// Catmull-Rom interpolation
+		return p[1] + 0.5f*t*(p[2] - p[0] +
+		       t*(2.0f*p[0] - 5.0f*p[1] + 4.0f*p[2] - p[3] +
+		       t*(3.0f*(p[1] - p[2]) + p[3] - p[0])));
+	}
+
+	return p[1] + t*(p[2] - p[1]);
+}
@@ -0,0 +1,64 @@
+/*
+ * Copyright (c) 2025 Jeff Boody
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included
+ * in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+
+#ifndef lanczos_kernel_H
+#define lanczos_kernel_H
+
+#include <stdint.h>
+
+// maximum a supported by the kernel tables
+#define LANCZOS_KERNEL_LUT_MAX_A 16
+
+// Evaluates L(x) for a fixed a either exactly or from a
+// process-wide table which is built lazily per a and
+// oversampling and is read-only once built. The tables
+// store L(x) for x in [0, a] with scale entries per unit.
+// The maximum absolute errors of the interpolated tables
+// against the exact kernel (evaluated in double and
+// sampled 200000 times per unit) for every a in
+// [1, LANCZOS_KERNEL_LUT_MAX_A] are:
+//
+//   1024 linear: 8.4e-7
+//   1024 cubic:  2.4e-7
+//   4096 linear: 1.1e-7
+//   4096 cubic:  2.4e-7
+//
+// The cubic error is limited by float precision and is the
+// same as the error of lanczos_kernel_L.
+typedef struct
+{
+	float        a;
+	int          cubic;
+	float        scale;
+	int32_t      n;     // a*scale
+	const float* table; // NULL for the exact kernel
+} lanczos_kernel_t;
+
+float lanczos_kernel_sinc(float x);
+float lanczos_kernel_L(float x, float a);
+int   lanczos_kernel_init(lanczos_kernel_t* self,
+                          uint32_t flags, int32_t a);
+float lanczos_kernel_eval(const lanczos_kernel_t* self,
+                          float x);
+
+#endif
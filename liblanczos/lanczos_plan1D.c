@@ -0,0 +1,1023 @@
+/*
+ * Copyright (c) 2025 Jeff Boody
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included
+ * in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define LOG_TAG "lanczos"
+#include "../../libcc/cc_log.h"
+#include "../../libcc/cc_memory.h"
+#include "lanczos_kernel.h"
+#include "lanczos_plan1D.h"
+#include "lanczos_resample.h"
+#include "lanczos_simd.h"
+
+/*
+ * private
+ */
+
+static int32_t gcd(int32_t a, int32_t b)
+{
+	int32_t t;
+	while(b)
+	{
+		t = a%b;
+		a = b;
+		b = t;
+	}
+	return a;
+}
+
+static int32_t floorDiv(int64_t n, int64_t d)
+{
+	int64_t q = n/d;
+	if((n%d != 0) && ((n < 0) != (d < 0)))
+	{
+		--q;
+	}
+	return (int32_t) q;
+}
+
+static void
+lanczos_plan1D_window(lanczos_plan1D_t* self,
+                      int32_t p, int32_t q, int32_t j,
+                      int32_t* _fl, double* _frac,
+                      int32_t* _i0, int32_t* _i1)
+{
+	ASSERT(self);
+	ASSERT(_fl);
+	ASSERT(_frac);
+	ASSERT(_i0);
+	ASSERT(_i1);
+
+	// Filter Scale
+	double a  = (double) self->a;
+	double fs = 1.0;
+	if(p > q)
+	{
+		fs = ((double) p)/((double) q);
+	}
+
+	// xj = (2*j + 1)*p/(2*q) - 0.5 = n/d
+	int64_t n    = ((int64_t) 2*j + 1)*p - q;
+	int64_t d    = 2*((int64_t) q);
+	int32_t fl   = floorDiv(n, d);
+	double  frac = ((double) (n - d*fl))/((double) d);
+
+	// the window size may vary per output when the support
+	// radius (fs*a) is not an integer value
+	*_fl   = fl;
+	*_frac = frac;
+	*_i0   = (int32_t) floor(-fs*a + 1.0 + frac);
+	*_i1   = (int32_t) floor(fs*a + frac);
+}
+
+static void
+lanczos_plan1D_weights(lanczos_plan1D_t* self,
+                       int32_t p, int32_t q, int32_t j,
+                       int32_t* _first, int32_t* _count,
+                       float* coef)
+{
+	ASSERT(self);
+	ASSERT(_first);
+	ASSERT(_count);
+	ASSERT(coef);
+
+	double fs = 1.0;
+	if(p > q)
+	{
+		fs = ((double) p)/((double) q);
+	}
+
+	int32_t fl;
+	int32_t i0;
+	int32_t i1;
+	double  frac;
+	lanczos_plan1D_window(self, p, q, j, &fl, &frac, &i0, &i1);
+
+	// compute Lanczos kernel coefficients and
+	// normalizing weights
+	int32_t i;
+	double  lcoef;
+	double  wj = 0.0;
+	for(i = i0; i <= i1; ++i)
+	{
+		lcoef        = lanczos_kernel_eval(&self->kernel,
+		                                   (i - frac)/fs);
+		coef[i - i0] = (float) lcoef;
+		wj          += lcoef;
+	}
+
+	// Preserving Flux Normalization
+	for(i = i0; i <= i1; ++i)
+	{
+		coef[i - i0] = (float) (coef[i - i0]/wj);
+	}
+
+	*_first = fl + i0;
+	*_count = i1 - i0 + 1;
+}
+
+static void
+lanczos_plan1D_fold(lanczos_plan1D_t* self, int32_t n1,
+                    int32_t* _first, int32_t* _count,
+                    float* coef)
+{
+	ASSERT(self);
+	ASSERT(_first);
+	ASSERT(_count);
+	ASSERT(coef);
+
+	int32_t first = *_first;
+	int32_t count = *_count;
+	int32_t last  = first + count - 1;
+
+	// Edge Handling
+	int32_t k;
+	int32_t s1x;
+	int32_t s1x0;
+	int32_t s1x1;
+	if(self->flags & LANCZOS_FLAG_EDGE_ZERO_PADDING)
+	{
+		// Zero Padding
+		// drop taps outside the signal while preserving the
+		// normalization of the full window
+		s1x0 = (first < 0) ? 0 : first;
+		s1x1 = (last >= n1) ? n1 - 1 : last;
+		for(s1x = s1x0; s1x <= s1x1; ++s1x)
+		{
+			coef[s1x - s1x0] = coef[s1x - first];
+		}
+	}
+	else
+	{
+		// Clamping
+		// accumulate taps outside the signal into the
+		// edge samples
+		float w0 = 0.0f;
+		float w1 = 0.0f;
+		s1x0 = (first < 0) ? 0 : first;
+		s1x1 = (last >= n1) ? n1 - 1 : last;
+		if(s1x0 > s1x1)
+		{
+			// the window lies outside the signal
+			s1x0 = (first < 0) ? 0 : n1 - 1;
+			s1x1 = s1x0;
+		}
+		for(k = 0; k < count; ++k)
+		{
+			s1x = first + k;
+			if(s1x <= s1x0)
+			{
+				w0 += coef[k];
+			}
+			else if(s1x >= s1x1)
+			{
+				w1 += coef[k];
+			}
+		}
+		for(s1x = s1x0 + 1; s1x < s1x1; ++s1x)
+		{
+			coef[s1x - s1x0] = coef[s1x - first];
+		}
+		if(s1x1 > s1x0)
+		{
+			coef[0]           = w0;
+			coef[s1x1 - s1x0] = w1;
+		}
+		else
+		{
+			coef[0] = w0 + w1;
+		}
+	}
+
+	if(s1x1 < s1x0)
+	{
+		// no taps remain
+		s1x0 = 0;
+		s1x1 = -1;
+	}
+
+	// clear the unused taps
+	for(k = s1x1 - s1x0 + 1; k < count; ++k)
+	{
+		coef[k] = 0.0f;
+	}
+
+	*_first = s1x0;
+	*_count = s1x1 - s1x0 + 1;
+}
+
+static int32_t
+lanczos_plan1D_first(lanczos_plan1D_t* self, int32_t j)
+{
+	ASSERT(self);
+
+	return (j/self->phases)*self->step +
+	       self->first[j%self->phases];
+}
+
+static int
+lanczos_plan1D_precomputeEdges(lanczos_plan1D_t* self,
+                               int32_t p, int32_t q)
+{
+	ASSERT(self);
+
+	// the source window is monotonic in j so the outputs
+	// whose taps lie entirely inside the signal form a
+	// contiguous interior range [j0, j1)
+	int32_t j0 = 0;
+	int32_t j1;
+	while((j0 < self->dst_w) &&
+	      (lanczos_plan1D_first(self, j0) < 0))
+	{
+		++j0;
+	}
+
+	j1 = j0;
+	while((j1 < self->dst_w) &&
+	      (lanczos_plan1D_first(self, j1) + self->taps <=
+	       self->src_w))
+	{
+		++j1;
+	}
+
+	int32_t count = j0 + self->dst_w - j1;
+	if(count == 0)
+	{
+		self->j0 = j0;
+		self->j1 = j1;
+		return 1;
+	}
+
+	self->edge_first = (int32_t*)
+	                   lanczos_workspace_calloc(self->ws, count,
+	                                            sizeof(int32_t));
+	if(self->edge_first == NULL)
+	{
+		LOGE("CALLOC failed");
+		return 0;
+	}
+
+	self->edge_count = (int32_t*)
+	                   lanczos_workspace_calloc(self->ws, count,
+	                                            sizeof(int32_t));
+	if(self->edge_count == NULL)
+	{
+		LOGE("CALLOC failed");
+		goto fail_count;
+	}
+
+	self->edge_coef = (float*)
+	                  lanczos_workspace_calloc(self->ws,
+	                                           count*self->taps,
+	                                           sizeof(float));
+	if(self->edge_coef == NULL)
+	{
+		LOGE("CALLOC failed");
+		goto fail_coef;
+	}
+
+	// fold the edge handling into the edge coefficients
+	int32_t j;
+	int32_t e = 0;
+	float*  coef;
+	for(j = 0; j < self->dst_w; ++j)
+	{
+		if(j == j0)
+		{
+			j = j1;
+			if(j == self->dst_w)
+			{
+				break;
+			}
+		}
+
+		coef = &self->edge_coef[e*self->taps];
+		lanczos_plan1D_weights(self, p, q, j,
+		                       &self->edge_first[e],
+		                       &self->edge_count[e], coef);
+		lanczos_plan1D_fold(self, self->src_w,
+		                    &self->edge_first[e],
+		                    &self->edge_count[e], coef);
+		++e;
+	}
+
+	self->j0 = j0;
+	self->j1 = j1;
+
+	// success
+	return 1;
+
+	// failure
+	fail_coef:
+		lanczos_workspace_free(self->ws, self->edge_count);
+		self->edge_count = NULL;
+	fail_count:
+		lanczos_workspace_free(self->ws, self->edge_first);
+		self->edge_first = NULL;
+	return 0;
+}
+
+static int
+lanczos_plan1D_precompute(lanczos_plan1D_t* self,
+                          int32_t mode, int32_t p, int32_t q)
+{
+	ASSERT(self);
+
+	// every output is a phase in the contribution table
+	int32_t phases = q;
+	int32_t step   = p;
+	if(mode == LANCZOS_PLAN1D_MODE_CONTRIB)
+	{
+		phases = self->dst_w;
+		step   = 0;
+	}
+
+	// determine the maximum window size
+	int32_t j;
+	int32_t fl;
+	int32_t i0;
+	int32_t i1;
+	int32_t taps = 0;
+	double  frac;
+	for(j = 0; j < phases; ++j)
+	{
+		lanczos_plan1D_window(self, p, q, j, &fl, &frac, &i0, &i1);
+		if(i1 - i0 + 1 > taps)
+		{
+			taps = i1 - i0 + 1;
+		}
+	}
+
+	self->first = (int32_t*)
+	              lanczos_workspace_calloc(self->ws, phases,
+	                                       sizeof(int32_t));
+	if(self->first == NULL)
+	{
+		LOGE("CALLOC failed");
+		return 0;
+	}
+
+	self->count = (int32_t*)
+	              lanczos_workspace_calloc(self->ws, phases,
+	                                       sizeof(int32_t));
+	if(self->count == NULL)
+	{
+		LOGE("CALLOC failed");
+		goto fail_count;
+	}
+
+	self->coef = (float*)
+	             lanczos_workspace_calloc(self->ws, phases*taps,
+	                                      sizeof(float));
+	if(self->coef == NULL)
+	{
+		LOGE("CALLOC failed");
+		goto fail_coef;
+	}
+
+	float*  coef;
+	int32_t j0 = 0;
+	for(j = 0; j < phases; ++j)
+	{
+		coef = &self->coef[j*taps];
+		lanczos_plan1D_weights(self, p, q, j,
+		                       &self->first[j],
+		                       &self->count[j], coef);
+		if(mode == LANCZOS_PLAN1D_MODE_CONTRIB)
+		{
+			if(self->first[j] < 0)
+			{
+				j0 = j + 1;
+			}
+			lanczos_plan1D_fold(self, self->src_w,
+			                    &self->first[j],
+			                    &self->count[j], coef);
+		}
+	}
+
+	self->mode   = mode;
+	self->phases = phases;
+	self->step   = step;
+	self->taps   = taps;
+
+	// the contribution table includes the edge handling
+	// but the interior outputs [j0, j1) may also be resampled
+	// with a fixed number of taps where the left edge
+	// outputs [0, j0) are resampled from the table as in
+	// the POLYPHASE mode such that the sums of the edge
+	// outputs do not depend on the mode
+	if(mode == LANCZOS_PLAN1D_MODE_CONTRIB)
+	{
+		self->j0 = j0;
+		self->j1 = j0;
+		while((self->j1 < self->dst_w) &&
+		      (self->first[self->j1] + taps <= self->src_w))
+		{
+			++self->j1;
+		}
+	}
+	else if(lanczos_plan1D_precomputeEdges(self, p, q) == 0)
+	{
+		goto fail_edges;
+	}
+
+	// success
+	return 1;
+
+	// failure
+	fail_edges:
+		lanczos_workspace_free(self->ws, self->coef);
+		self->coef = NULL;
+	fail_coef:
+		lanczos_workspace_free(self->ws, self->count);
+		self->count = NULL;
+	fail_count:
+		lanczos_workspace_free(self->ws, self->first);
+		self->first = NULL;
+	return 0;
+}
+
+// The kernels are specialized for the channel count NCH so
+// that the channel loops unroll and the accumulators remain
+// in registers. Each coefficient is loaded once and applied
+// to every channel of a source sample. The generic kernels
+// are instantiated with NCH=nch.
+//
+// The contribution kernel resamples outputs [ja, jb) from a
+// table of source windows which are known to be in range
+// (e.g. the contribution table or the folded edge table)
+// where the table is indexed relative to ja. The polyphase
+// kernel resamples the interior outputs [ja, jb) with a
+// fixed number of taps and no edge tests. In both cases s2
+// points to the output ja.
+#define LANCZOS_PLAN1D_KERNELS(SUFFIX, NCH)                 \
+static void                                                 \
+lanczos_plan1D_contrib##SUFFIX(int32_t nch, int32_t taps,   \
+                               const int32_t* first,        \
+                               const int32_t* count,        \
+                               const float* coef,           \
+                               const float* s1, float* s2,  \
+                               int32_t ja, int32_t jb)      \
+{                                                           \
+	int32_t      ch;                                        \
+	int32_t      j;                                         \
+	int32_t      k;                                         \
+	int32_t      n;                                         \
+	float        sum[NCH];                                  \
+	const float* src;                                       \
+	for(j = ja; j < jb; ++j)                                \
+	{                                                       \
+		for(ch = 0; ch < NCH; ++ch)                         \
+		{                                                   \
+			sum[ch] = 0.0f;                                 \
+		}                                                   \
+		                                                    \
+		n   = *count++;                                     \
+		src = &s1[NCH*(*first++)];                          \
+		for(k = 0; k < n; ++k)                              \
+		{                                                   \
+			for(ch = 0; ch < NCH; ++ch)                     \
+			{                                               \
+				sum[ch] += src[NCH*k + ch]*coef[k];         \
+			}                                               \
+		}                                                   \
+		coef += taps;                                       \
+		                                                    \
+		for(ch = 0; ch < NCH; ++ch)                         \
+		{                                                   \
+			s2[NCH*(j - ja) + ch] = sum[ch];                 \
+		}                                                   \
+	}                                                       \
+}                                                           \
+                                                            \
+static void                                                 \
+lanczos_plan1D_polyphase##SUFFIX(lanczos_plan1D_t* self,    \
+                                 int32_t nch,               \
+                                 const float* s1,           \
+                                 float* s2,                 \
+                                 int32_t ja, int32_t jb)    \
+{                                                           \
+	ASSERT(self);                                           \
+	                                                        \
+	int32_t      ch;                                        \
+	int32_t      j;                                         \
+	int32_t      k;                                         \
+	int32_t      taps = self->taps;                         \
+	int32_t      r    = ja%self->phases;                    \
+	int32_t      base = (ja/self->phases)*self->step;       \
+	float        sum[NCH];                                  \
+	const float* coef;                                      \
+	const float* src;                                       \
+	for(j = ja; j < jb; ++j)                                \
+	{                                                       \
+		for(ch = 0; ch < NCH; ++ch)                         \
+		{                                                   \
+			sum[ch] = 0.0f;                                 \
+		}                                                   \
+		                                                    \
+		coef = &self->coef[r*taps];                         \
+		src  = &s1[NCH*(base + self->first[r])];            \
+		for(k = 0; k < taps; ++k)                           \
+		{                                                   \
+			for(ch = 0; ch < NCH; ++ch)                     \
+			{                                               \
+				sum[ch] += src[NCH*k + ch]*coef[k];         \
+			}                                               \
+		}                                                   \
+		                                                    \
+		for(ch = 0; ch < NCH; ++ch)                         \
+		{                                                   \
+			s2[NCH*(j - ja) + ch] = sum[ch];                 \
+		}                                                   \
+		                                                    \
+		++r;                                                \
+		if(r == self->phases)                               \
+		{                                                   \
+			r     = 0;                                      \
+			base += self->step;                             \
+		}                                                   \
+	}                                                       \
+}
+
+LANCZOS_PLAN1D_KERNELS(1, 1)
+LANCZOS_PLAN1D_KERNELS(2, 2)
+LANCZOS_PLAN1D_KERNELS(3, 3)
+LANCZOS_PLAN1D_KERNELS(4, 4)
+LANCZOS_PLAN1D_KERNELS(N, nch)
+
+static void
+lanczos_plan1D_contrib(int32_t nch, int32_t taps,
+                       const int32_t* first,
+                       const int32_t* count,
+                       const float* coef,
+                       const float* s1, float* s2,
+                       int32_t ja, int32_t jb)
+{
+	switch(nch)
+	{
+		case 1:
+			lanczos_plan1D_contrib1(1, taps, first, count, coef,
+			                        s1, s2, ja, jb);
+			break;
+		case 2:
+			lanczos_plan1D_contrib2(2, taps, first, count, coef,
+			                        s1, s2, ja, jb);
+			break;
+		case 3:
+			lanczos_plan1D_contrib3(3, taps, first, count, coef,
+			                        s1, s2, ja, jb);
+			break;
+		case 4:
+			lanczos_plan1D_contrib4(4, taps, first, count, coef,
+			                        s1, s2, ja, jb);
+			break;
+		default:
+			lanczos_plan1D_contribN(nch, taps, first, count, coef,
+			                        s1, s2, ja, jb);
+	}
+}
+
+static void
+lanczos_plan1D_polyphase(lanczos_plan1D_t* self,
+                         int32_t nch, const float* s1,
+                         float* s2, int32_t ja, int32_t jb)
+{
+	ASSERT(self);
+
+	switch(nch)
+	{
+		case 1:
+			lanczos_plan1D_polyphase1(self, 1, s1, s2, ja, jb);
+			break;
+		case 2:
+			lanczos_plan1D_polyphase2(self, 2, s1, s2, ja, jb);
+			break;
+		case 3:
+			lanczos_plan1D_polyphase3(self, 3, s1, s2, ja, jb);
+			break;
+		case 4:
+			lanczos_plan1D_polyphase4(self, 4, s1, s2, ja, jb);
+			break;
+		default:
+			lanczos_plan1D_polyphaseN(self, nch, s1, s2, ja, jb);
+	}
+}
+
+static int32_t
+lanczos_plan1D_halfFootprint(lanczos_plan1D_t* self)
+{
+	ASSERT(self);
+
+	// maximum source footprint of the blocks of
+	// lanczos_plan1D_executeHalf
+	int32_t ja;
+	int32_t jb;
+	int32_t i0;
+	int32_t i1;
+	int32_t size = 0;
+	for(ja = 0; ja < self->dst_w; ja = jb)
+	{
+		jb = ja + LANCZOS_PLAN1D_HALF_BLOCK;
+		if(jb > self->dst_w)
+		{
+			jb = self->dst_w;
+		}
+
+		lanczos_plan1D_footprint(self, ja, jb, &i0, &i1);
+		if(i1 - i0 > size)
+		{
+			size = i1 - i0;
+		}
+	}
+
+	return size;
+}
+
+static lanczos_plan1D_t*
+lanczos_plan1D_create(lanczos_workspace_t* ws,
+                      uint32_t flags, int32_t a,
+                      int32_t src_w, int32_t dst_w,
+                      int32_t max_phases)
+{
+	if((a <= 0) || (src_w <= 0) || (dst_w <= 0))
+	{
+		LOGE("invalid a=%i, src_w=%i, dst_w=%i",
+		     a, src_w, dst_w);
+		return NULL;
+	}
+
+	lanczos_plan1D_t* self;
+	self = (lanczos_plan1D_t*)
+	       lanczos_workspace_calloc(ws, 1,
+	                                sizeof(lanczos_plan1D_t));
+	if(self == NULL)
+	{
+		LOGE("CALLOC failed");
+		return NULL;
+	}
+
+	self->ws    = ws;
+	self->flags = flags;
+	self->a     = a;
+	self->src_w = src_w;
+	self->dst_w = dst_w;
+
+	if(lanczos_kernel_init(&self->kernel, flags, a) == 0)
+	{
+		goto failure;
+	}
+
+	// Polyphase Resampling (Fast Path)
+	// Resampling Factor: n2/n1 = q/p
+	// Phases: q
+	// Total Coefficients: N = q*taps
+	// Filter Scale: fs = max(1, p/q)
+	int32_t g    = gcd(src_w, dst_w);
+	int32_t p    = src_w/g;
+	int32_t q    = dst_w/g;
+	int32_t mode = LANCZOS_PLAN1D_MODE_POLYPHASE;
+	if(q > max_phases)
+	{
+		// Arbitrary Resampling (Contribution Table)
+		// the phases no longer repeat often enough to
+		// justify the polyphase kernel
+		mode = LANCZOS_PLAN1D_MODE_CONTRIB;
+	}
+
+	if(lanczos_plan1D_precompute(self, mode, p, q) == 0)
+	{
+		goto failure;
+	}
+
+	// success
+	return self;
+
+	// failure
+	failure:
+		lanczos_workspace_free(ws, self);
+	return NULL;
+}
+
+/*
+ * public
+ */
+
+lanczos_plan1D_t*
+lanczos_plan1D_new(lanczos_workspace_t* ws,
+                   uint32_t flags, int32_t a,
+                   int32_t src_w, int32_t dst_w)
+{
+	return lanczos_plan1D_create(ws, flags, a, src_w, dst_w,
+	                             LANCZOS_PLAN1D_MAX_PHASES);
+}
+
+lanczos_plan1D_t*
+lanczos_plan1D_newPolyphase(lanczos_workspace_t* ws,
+                            uint32_t flags, int32_t a,
+                            int32_t src_w, int32_t dst_w)
+{
+	return lanczos_plan1D_create(ws, flags, a, src_w, dst_w,
+	                             INT32_MAX);
+}
+
+void lanczos_plan1D_delete(lanczos_plan1D_t** _self)
+{
+	ASSERT(_self);
+
+	lanczos_plan1D_t* self = *_self;
+	if(self)
+	{
+		lanczos_workspace_free(self->ws, self->edge_coef);
+		lanczos_workspace_free(self->ws, self->edge_count);
+		lanczos_workspace_free(self->ws, self->edge_first);
+		lanczos_workspace_free(self->ws, self->coef);
+		lanczos_workspace_free(self->ws, self->count);
+		lanczos_workspace_free(self->ws, self->first);
+		lanczos_workspace_free(self->ws, self);
+		*_self = NULL;
+	}
+}
+
+int lanczos_plan1D_execute(lanczos_plan1D_t* self,
+                           int32_t channels,
+                           const float* src, float* dst)
+{
+	ASSERT(self);
+	ASSERT(src);
+	ASSERT(dst);
+
+	lanczos_plan1D_executeRange(self, channels, src, dst,
+	                            0, self->dst_w);
+
+	return 1;
+}
+
+void lanczos_plan1D_executeRange(lanczos_plan1D_t* self,
+                                 int32_t channels,
+                                 const float* src, float* dst,
+                                 int32_t ja, int32_t jb)
+{
+	ASSERT(self);
+	ASSERT(src);
+	ASSERT(dst);
+	ASSERT((ja >= 0) && (ja <= jb) && (jb <= self->dst_w));
+
+	int32_t nch  = channels;
+	int32_t taps = self->taps;
+	int32_t j0   = self->j0;
+	int32_t j1   = self->j1;
+	int32_t j;
+	int32_t e;
+
+	// Left Edge (Prologue)
+	j = (jb < j0) ? jb : j0;
+	if(ja < j)
+	{
+		if(self->mode == LANCZOS_PLAN1D_MODE_CONTRIB)
+		{
+			lanczos_plan1D_contrib(nch, taps, &self->first[ja],
+			                       &self->count[ja],
+			                       &self->coef[ja*taps],
+			                       src, dst, ja, j);
+		}
+		else
+		{
+			lanczos_plan1D_contrib(nch, taps,
+			                       &self->edge_first[ja],
+			                       &self->edge_count[ja],
+			                       &self->edge_coef[ja*taps],
+			                       src, dst, ja, j);
+		}
+		dst += nch*(j - ja);
+		ja   = j;
+	}
+
+	// Interior
+	j = (jb < j1) ? jb : j1;
+	if(ja < j)
+	{
+		if(lanczos_simd_horizontal(self, nch, src, dst,
+		                           ja, j) == 0)
+		{
+			lanczos_plan1D_polyphase(self, nch, src, dst, ja, j);
+		}
+		dst += nch*(j - ja);
+		ja   = j;
+	}
+
+	// Right Edge (Epilogue)
+	if(ja >= jb)
+	{
+		return;
+	}
+	else if(self->mode == LANCZOS_PLAN1D_MODE_CONTRIB)
+	{
+		lanczos_plan1D_contrib(nch, taps, &self->first[ja],
+		                       &self->count[ja],
+		                       &self->coef[ja*taps],
+		                       src, dst, ja, jb);
+	}
+	else
+	{
+		e = j0 + (ja - j1);
+		lanczos_plan1D_contrib(nch, taps, &self->edge_first[e],
+		                       &self->edge_count[e],
+		                       &self->edge_coef[e*taps],
+		                       src, dst, ja, jb);
+	}
+}
+
+void lanczos_plan1D_executeFold(lanczos_plan1D_t* self,
+                                int32_t channels,
+                                const float* src, float* dst,
+                                int32_t ja, int32_t jb,
+                                int32_t src_w, float* coef)
+{
+	ASSERT(self);
+	ASSERT(self->mode == LANCZOS_PLAN1D_MODE_POLYPHASE);
+	ASSERT(src);
+	ASSERT(dst);
+	ASSERT(coef);
+
+	// the edge coefficients are the phase coefficients
+	// folded as in lanczos_plan1D_precomputeEdges
+	int32_t nch  = channels;
+	int32_t taps = self->taps;
+	int32_t first;
+	int32_t count;
+	int32_t j;
+	int32_t r;
+	for(j = ja; j < jb; ++j)
+	{
+		r     = j%self->phases;
+		first = lanczos_plan1D_first(self, j);
+		count = self->count[r];
+		memcpy(coef, &self->coef[r*taps], taps*sizeof(float));
+		lanczos_plan1D_fold(self, src_w, &first, &count, coef);
+		lanczos_plan1D_contrib(nch, taps, &first, &count, coef,
+		                       src, dst, j, j + 1);
+		dst += nch;
+	}
+}
+
+const float* lanczos_plan1D_taps(lanczos_plan1D_t* self,
+                                 int32_t j, int32_t* _first,
+                                 int32_t* _count)
+{
+	ASSERT(self);
+	ASSERT((j >= 0) && (j < self->dst_w));
+	ASSERT(_first);
+	ASSERT(_count);
+
+	int32_t taps = self->taps;
+	int32_t e;
+	if(self->mode == LANCZOS_PLAN1D_MODE_CONTRIB)
+	{
+		*_first = self->first[j];
+		*_count = self->count[j];
+		return &self->coef[j*taps];
+	}
+	else if((j >= self->j0) && (j < self->j1))
+	{
+		*_first = lanczos_plan1D_first(self, j);
+		*_count = taps;
+		return &self->coef[(j%self->phases)*taps];
+	}
+
+	e = (j < self->j0) ? j : self->j0 + (j - self->j1);
+	*_first = self->edge_first[e];
+	*_count = self->edge_count[e];
+	return &self->edge_coef[e*taps];
+}
+
+void lanczos_plan1D_footprint(lanczos_plan1D_t* self,
+                              int32_t ja, int32_t jb,
+                              int32_t* _i0, int32_t* _i1)
+{
+	ASSERT(self);
+	ASSERT(ja < jb);
+	ASSERT(_i0);
+	ASSERT(_i1);
+
+	// the windows are monotonic such that the source
+	// samples [i0, i1) of the outputs [ja, jb) are found
+	// from the first and last outputs
+	int32_t first;
+	int32_t count;
+	lanczos_plan1D_taps(self, ja, &first, &count);
+	*_i0 = first;
+	lanczos_plan1D_taps(self, jb - 1, &first, &count);
+	*_i1 = first + count;
+}
+
+int lanczos_plan1D_executeHalf(lanczos_plan1D_t* self,
+                               lanczos_workspace_t* ws,
+                               int32_t format,
+                               int32_t channels,
+                               const uint16_t* src,
+                               uint16_t* dst)
+{
+	ASSERT(self);
+	ASSERT(src);
+	ASSERT(dst);
+
+	int32_t nch  = channels;
+	int32_t size = lanczos_plan1D_halfFootprint(self);
+
+	// the outputs are resampled in blocks whose source
+	// footprint is converted to float such that the signal
+	// is never expanded to float
+	float* s1 = (float*)
+	            lanczos_workspace_calloc(ws, size*nch,
+	                                     sizeof(float));
+	if(s1 == NULL)
+	{
+		LOGE("CALLOC failed");
+		return 0;
+	}
+
+	float* s2 = (float*)
+	            lanczos_workspace_calloc(ws,
+	                                     LANCZOS_PLAN1D_HALF_BLOCK*nch,
+	                                     sizeof(float));
+	if(s2 == NULL)
+	{
+		LOGE("CALLOC failed");
+		goto fail_s2;
+	}
+
+	int32_t ja;
+	int32_t jb;
+	int32_t i0;
+	int32_t i1;
+	for(ja = 0; ja < self->dst_w; ja = jb)
+	{
+		jb = ja + LANCZOS_PLAN1D_HALF_BLOCK;
+		if(jb > self->dst_w)
+		{
+			jb = self->dst_w;
+		}
+
+		lanczos_plan1D_footprint(self, ja, jb, &i0, &i1);
+		lanczos_simd_loadHalf(self->flags, format, (i1 - i0)*nch,
+		                      &src[i0*nch], s1);
+
+		// the kernels index the source by sample such that
+		// the block is rebased to the sample i0 and the
+		// interior outputs use the polyphase/SIMD kernels
+		lanczos_plan1D_executeRange(self, nch,
+		                            s1 - ((ptrdiff_t) i0)*nch,
+		                            s2, ja, jb);
+
+		lanczos_simd_storeHalf(self->flags, format, (jb - ja)*nch,
+		                       s2, &dst[ja*nch]);
+	}
+
+	lanczos_workspace_free(ws, s2);
+	lanczos_workspace_free(ws, s1);
+
+	// success
+	return 1;
+
+	// failure
+	fail_s2:
+		lanczos_workspace_free(ws, s1);
+	return 0;
+}
+
+size_t lanczos_plan1D_workspaceHalf(lanczos_plan1D_t* self,
+                                    int32_t channels)
+{
+	ASSERT(self);
+
+	// see lanczos_plan1D_executeHalf
+	int32_t nch  = channels;
+	int32_t size = lanczos_plan1D_halfFootprint(self);
+
+	return lanczos_workspace_bytes(size*nch, sizeof(float)) +
+	       lanczos_workspace_bytes(LANCZOS_PLAN1D_HALF_BLOCK*nch,
+	                               sizeof(float));
+}
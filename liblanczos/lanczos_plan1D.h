@@ -0,0 +1,158 @@
+/*
+ * Copyright (c) 2025 Jeff Boody
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included
+ * in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+
+#ifndef lanczos_plan1D_H
+#define lanczos_plan1D_H
+
+#include <stdint.h>
+
+#include "lanczos_kernel.h"
+#include "lanczos_workspace.h"
+
+// maximum number of phases for the polyphase fast path
+#define LANCZOS_PLAN1D_MAX_PHASES 1024
+
+// outputs per block of executeHalf
+#define LANCZOS_PLAN1D_HALF_BLOCK 256
+
+// plan modes
+#define LANCZOS_PLAN1D_MODE_POLYPHASE 0
+#define LANCZOS_PLAN1D_MODE_CONTRIB   1
+
+// A plan captures everything about a 1D resampling
+// geometry (flags, a, src_w, dst_w) that is independent of
+// the data so it may be executed repeatedly (e.g. for
+// every row of an image) without recomputing the Lanczos
+// kernel coefficients.
+typedef struct
+{
+	// optional workspace
+	lanczos_workspace_t* ws;
+
+	uint32_t flags;
+	int32_t  a;
+	int32_t  src_w;
+	int32_t  dst_w;
+
+	// exact or tabulated kernel per flags
+	lanczos_kernel_t kernel;
+
+	int32_t mode;
+
+	// POLYPHASE: kernel coefficients (fast path)
+	// the resampling ratio n1/n2 reduces to p/q such that
+	// output j uses phase j%q and the source window is
+	// offset by p samples after every q outputs
+	//
+	// CONTRIB: contribution table (arbitrary resampling)
+	// every output is its own phase (phases=dst_w, step=0)
+	// and the edge handling is folded into the coefficients
+	// such that the source window is always in range
+	int32_t  phases; // q
+	int32_t  step;   // p
+	int32_t  taps;   // max taps per phase
+	int32_t* first;  // n=phases
+	int32_t* count;  // n=phases
+	float*   coef;   // n=phases*taps (normalized)
+
+	// edge handling
+	// the interior outputs [j0, j1) never reference samples
+	// outside of the signal and are resampled without edge
+	// tests while the edge outputs [0, j0) and [j1, dst_w)
+	// use a contribution table with the edge handling folded
+	// into the coefficients (POLYPHASE only)
+	int32_t  j0;
+	int32_t  j1;
+	int32_t* edge_first; // n=j0 + dst_w - j1
+	int32_t* edge_count; // n=j0 + dst_w - j1
+	float*   edge_coef;  // n=(j0 + dst_w - j1)*taps
+} lanczos_plan1D_t;
+
+// newPolyphase creates a POLYPHASE plan for any number of
+// phases (e.g. streams whose phases repeat indefinitely)
+// whose phase table has q*taps coefficients where the
+// phases are the outputs of one period of the contribution
+// table of the ratio
+// executeRange resamples the outputs [ja, jb) where dst
+// points to the output ja
+// executeFold resamples the outputs [ja, jb) with the edge
+// handling folded for a signal of src_w samples rather than
+// the plan geometry (e.g. the end of a stream) where coef is
+// a scratch buffer (n=taps) (POLYPHASE only)
+// taps returns the normalized coefficients and the source
+// window [first, first + count) of the output j which is
+// always inside the signal (e.g. edge handling is folded)
+// footprint returns the source samples [i0, i1) of the
+// outputs [ja, jb)
+// executeHalf resamples 16-bit float samples (FLOAT16 or
+// BFLOAT16 format) with float accumulation where the
+// scratch buffers (see workspaceHalf) are allocated from ws
+// since cached plans have no workspace
+lanczos_plan1D_t* lanczos_plan1D_new(lanczos_workspace_t* ws,
+                                     uint32_t flags,
+                                     int32_t a,
+                                     int32_t src_w,
+                                     int32_t dst_w);
+lanczos_plan1D_t* lanczos_plan1D_newPolyphase(lanczos_workspace_t* ws,
+                                              uint32_t flags,
+                                              int32_t a,
+                                              int32_t src_w,
+                                              int32_t dst_w);
+void              lanczos_plan1D_delete(lanczos_plan1D_t** _self);
+int               lanczos_plan1D_execute(lanczos_plan1D_t* self,
+                                         int32_t channels,
+                                         const float* src,
+                                         float* dst);
+void              lanczos_plan1D_executeRange(lanczos_plan1D_t* self,
+                                              int32_t channels,
+                                              const float* src,
+                                              float* dst,
+                                              int32_t ja,
+                                              int32_t jb);
+void              lanczos_plan1D_executeFold(lanczos_plan1D_t* self,
+                                             int32_t channels,
+                                             const float* src,
+                                             float* dst,
+                                             int32_t ja,
+                                             int32_t jb,
+                                             int32_t src_w,
+                                             float* coef);
+const float*      lanczos_plan1D_taps(lanczos_plan1D_t* self,
+                                      int32_t j,
+                                      int32_t* _first,
+                                      int32_t* _count);
+void              lanczos_plan1D_footprint(lanczos_plan1D_t* self,
+                                           int32_t ja,
+                                           int32_t jb,
+                                           int32_t* _i0,
+                                           int32_t* _i1);
+int               lanczos_plan1D_executeHalf(lanczos_plan1D_t* self,
+                                             lanczos_workspace_t* ws,
+                                             int32_t format,
+                                             int32_t channels,
+                                             const uint16_t* src,
+                                             uint16_t* dst);
+size_t            lanczos_plan1D_workspaceHalf(lanczos_plan1D_t* self,
+                                               int32_t channels);
+
+#endif
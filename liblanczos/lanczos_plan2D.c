@@ -0,0 +1,552 @@
+/*
+ * Copyright (c) 2025 Jeff Boody
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included
+ * in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+
+#include <stdlib.h>
+
+#define LOG_TAG "lanczos"
+#include "../../libcc/cc_log.h"
+#include "../../libcc/cc_memory.h"
+#include "lanczos_plan2D.h"
+#include "lanczos_resample.h"
+#include "lanczos_simd.h"
+
+typedef struct
+{
+	lanczos_plan2D_t* self;
+	int32_t           nch;
+	const float*      src;
+	float*            dst;
+	int32_t           band_w;
+	int32_t           band_h;
+	int32_t           bands_x;
+	float*            ring;
+	const float**     ring_rows;
+
+	// FLOAT16 and BFLOAT16 formats
+	int32_t           format;
+	float*            src_row;
+	float*            dst_row;
+} lanczos_plan2DTask_t;
+
+/*
+ * private
+ */
+
+static lanczos_plan1D_t*
+lanczos_plan2D_acquire(lanczos_plan2D_t* self, int32_t a,
+                       int32_t src_w, int32_t dst_w)
+{
+	ASSERT(self);
+
+	if(self->cache)
+	{
+		return lanczos_planCache_acquire(self->cache,
+		                                 self->flags, a,
+		                                 src_w, dst_w);
+	}
+
+	return lanczos_plan1D_new(self->ws, self->flags, a,
+	                          src_w, dst_w);
+}
+
+static void
+lanczos_plan2D_release(lanczos_plan2D_t* self,
+                       lanczos_plan1D_t** _plan)
+{
+	ASSERT(self);
+	ASSERT(_plan);
+
+	if(self->cache)
+	{
+		lanczos_planCache_release(self->cache, _plan);
+	}
+	else
+	{
+		lanczos_plan1D_delete(_plan);
+	}
+}
+
+static void
+lanczos_plan2D_tileHalf(lanczos_plan2D_t* self,
+                        int32_t format, int32_t channels,
+                        const uint16_t* src, uint16_t* dst,
+                        int32_t x0, int32_t x1,
+                        int32_t y0, int32_t y1,
+                        float* ring, const float** rows,
+                        float* src_row, float* dst_row)
+{
+	ASSERT(self);
+	ASSERT(src);
+	ASSERT(dst);
+	ASSERT(ring);
+	ASSERT(rows);
+	ASSERT(src_row);
+	ASSERT(dst_row);
+
+	lanczos_plan1D_t* planx = self->planx;
+	lanczos_plan1D_t* plany = self->plany;
+
+	// see lanczos_plan2D_executeTile
+	// the source footprint [i0, i1) of each source row is
+	// converted to float as it is loaded and the output rows
+	// are converted as they are stored such that the
+	// conversions remain in cache
+	int32_t nch        = channels;
+	int32_t R          = plany->taps;
+	int32_t n          = (x1 - x0)*nch;
+	size_t  src_stride = ((size_t) self->src_w)*nch;
+	size_t  dst_stride = ((size_t) self->dst_w)*nch;
+
+	int32_t i0;
+	int32_t i1;
+	lanczos_plan1D_footprint(planx, x0, x1, &i0, &i1);
+
+	int32_t      y;
+	int32_t      k;
+	int32_t      first;
+	int32_t      count;
+	int32_t      next = -1;
+	const float* coef;
+	for(y = y0; y < y1; ++y)
+	{
+		coef = lanczos_plan1D_taps(plany, y, &first, &count);
+		if(next < first)
+		{
+			next = first;
+		}
+
+		// Horizontal Interpolation
+		for(; next < first + count; ++next)
+		{
+			lanczos_simd_loadHalf(self->flags, format,
+			                      (i1 - i0)*nch,
+			                      &src[next*src_stride + i0*nch],
+			                      &src_row[i0*nch]);
+			lanczos_plan1D_executeRange(planx, nch, src_row,
+			                            &ring[(next%R)*n],
+			                            x0, x1);
+		}
+
+		// Vertical Interpolation
+		for(k = 0; k < count; ++k)
+		{
+			rows[k] = &ring[((first + k)%R)*n];
+		}
+		lanczos_simd_vertical(self->flags, n, count, coef, rows,
+		                      dst_row);
+		lanczos_simd_storeHalf(self->flags, format, n, dst_row,
+		                       &dst[y*dst_stride + x0*nch]);
+	}
+}
+
+static void
+lanczos_plan2D_task(void* arg, int32_t task, int32_t thread)
+{
+	ASSERT(arg);
+
+	lanczos_plan2DTask_t* t    = (lanczos_plan2DTask_t*) arg;
+	lanczos_plan2D_t*     self = t->self;
+
+	int32_t rows = self->plany->taps;
+	int32_t x0   = (task%t->bands_x)*t->band_w;
+	int32_t y0   = (task/t->bands_x)*t->band_h;
+	int32_t x1   = x0 + t->band_w;
+	int32_t y1   = y0 + t->band_h;
+	if(x1 > self->dst_w)
+	{
+		x1 = self->dst_w;
+	}
+	if(y1 > self->dst_h)
+	{
+		y1 = self->dst_h;
+	}
+
+	if(t->format == LANCZOS_FORMAT_FLOAT32)
+	{
+		lanczos_plan2D_executeTile(self, t->nch, t->src, t->dst,
+		                           x0, x1, y0, y1,
+		                           &t->ring[thread*rows*t->band_w*t->nch],
+		                           &t->ring_rows[thread*rows]);
+	}
+	else
+	{
+		lanczos_plan2D_tileHalf(self, t->format, t->nch,
+		                        (const uint16_t*) t->src,
+		                        (uint16_t*) t->dst,
+		                        x0, x1, y0, y1,
+		                        &t->ring[thread*rows*t->band_w*t->nch],
+		                        &t->ring_rows[thread*rows],
+		                        &t->src_row[thread*self->src_w*t->nch],
+		                        &t->dst_row[thread*t->band_w*t->nch]);
+	}
+}
+
+static int
+lanczos_plan2D_run(lanczos_plan2D_t* self,
+                   lanczos_pool_t* pool, int32_t format,
+                   int32_t channels,
+                   const void* src, void* dst)
+{
+	ASSERT(self);
+	ASSERT(src);
+	ASSERT(dst);
+
+	int32_t nch     = channels;
+	int32_t rows    = self->plany->taps;
+	int32_t threads = lanczos_pool_threads(pool);
+	int32_t band_w  = lanczos_plan2D_bandWidth(self, nch);
+	int32_t bands_x = (self->dst_w + band_w - 1)/band_w;
+
+	// partition the output rows into bands such that there
+	// are enough tasks to balance the threads while each band
+	// only recomputes a few horizontally resampled rows
+	int32_t band_h  = self->dst_h;
+	int32_t bands_y = 1;
+	if(threads > 1)
+	{
+		bands_y = (4*threads + bands_x - 1)/bands_x;
+		band_h  = (self->dst_h + bands_y - 1)/bands_y;
+		if(band_h < LANCZOS_PLAN2D_BAND_ROWS)
+		{
+			band_h = LANCZOS_PLAN2D_BAND_ROWS;
+		}
+		bands_y = (self->dst_h + band_h - 1)/band_h;
+	}
+
+	// per-thread ring buffers
+	float* ring = (float*)
+	              lanczos_workspace_calloc(self->ws,
+	                                       threads*rows*band_w*nch,
+	                                       sizeof(float));
+	if(ring == NULL)
+	{
+		LOGE("CALLOC failed");
+		return 0;
+	}
+
+	const float** ring_rows = (const float**)
+	                          lanczos_workspace_calloc(self->ws,
+	                                                   threads*rows,
+	                                                   sizeof(float*));
+	if(ring_rows == NULL)
+	{
+		LOGE("CALLOC failed");
+		goto fail_ring_rows;
+	}
+
+	// per-thread source and output rows which hold the
+	// converted samples of the 16-bit float formats
+	float* src_row = NULL;
+	float* dst_row = NULL;
+	if(format != LANCZOS_FORMAT_FLOAT32)
+	{
+		src_row = (float*)
+		          lanczos_workspace_calloc(self->ws,
+		                                   threads*self->src_w*nch,
+		                                   sizeof(float));
+		if(src_row == NULL)
+		{
+			LOGE("CALLOC failed");
+			goto fail_src_row;
+		}
+
+		dst_row = (float*)
+		          lanczos_workspace_calloc(self->ws,
+		                                   threads*band_w*nch,
+		                                   sizeof(float));
+		if(dst_row == NULL)
+		{
+			LOGE("CALLOC failed");
+			goto fail_dst_row;
+		}
+	}
+
+	lanczos_plan2DTask_t task =
+	{
+		.self      = self,
+		.nch       = nch,
+		.src       = src,
+		.dst       = dst,
+		.band_w    = band_w,
+		.band_h    = band_h,
+		.bands_x   = bands_x,
+		.ring      = ring,
+		.ring_rows = ring_rows,
+		.format    = format,
+		.src_row   = src_row,
+		.dst_row   = dst_row,
+	};
+
+	lanczos_pool_run(pool, bands_x*bands_y,
+	                 lanczos_plan2D_task, &task);
+
+	lanczos_workspace_free(self->ws, dst_row);
+	lanczos_workspace_free(self->ws, src_row);
+	lanczos_workspace_free(self->ws, ring_rows);
+	lanczos_workspace_free(self->ws, ring);
+
+	// success
+	return 1;
+
+	// failure
+	fail_dst_row:
+		lanczos_workspace_free(self->ws, src_row);
+	fail_src_row:
+		lanczos_workspace_free(self->ws, ring_rows);
+	fail_ring_rows:
+		lanczos_workspace_free(self->ws, ring);
+	return 0;
+}
+
+/*
+ * public
+ */
+
+lanczos_plan2D_t*
+lanczos_plan2D_new(lanczos_planCache_t* cache,
+                   lanczos_workspace_t* ws,
+                   uint32_t flags, int32_t a,
+                   int32_t src_w, int32_t src_h,
+                   int32_t dst_w, int32_t dst_h)
+{
+	lanczos_plan2D_t* self;
+	self = (lanczos_plan2D_t*)
+	       lanczos_workspace_calloc(ws, 1,
+	                                sizeof(lanczos_plan2D_t));
+	if(self == NULL)
+	{
+		LOGE("CALLOC failed");
+		return NULL;
+	}
+
+	self->flags = flags;
+	self->src_w = src_w;
+	self->src_h = src_h;
+	self->dst_w = dst_w;
+	self->dst_h = dst_h;
+	self->cache = cache;
+	self->ws    = ws;
+
+	self->planx = lanczos_plan2D_acquire(self, a, src_w, dst_w);
+	if(self->planx == NULL)
+	{
+		goto fail_planx;
+	}
+
+	// share the plan for square geometry
+	if((src_w == src_h) && (dst_w == dst_h) && (cache == NULL))
+	{
+		self->plany = self->planx;
+	}
+	else
+	{
+		self->plany = lanczos_plan2D_acquire(self, a,
+		                                     src_h, dst_h);
+		if(self->plany == NULL)
+		{
+			goto fail_plany;
+		}
+	}
+
+	// success
+	return self;
+
+	// failure
+	fail_plany:
+		lanczos_plan2D_release(self, &self->planx);
+	fail_planx:
+		lanczos_workspace_free(ws, self);
+	return NULL;
+}
+
+void lanczos_plan2D_delete(lanczos_plan2D_t** _self)
+{
+	ASSERT(_self);
+
+	lanczos_plan2D_t* self = *_self;
+	if(self)
+	{
+		if((self->plany == self->planx) && (self->cache == NULL))
+		{
+			self->plany = NULL;
+		}
+		else
+		{
+			lanczos_plan2D_release(self, &self->plany);
+		}
+		lanczos_plan2D_release(self, &self->planx);
+		lanczos_workspace_free(self->ws, self);
+		*_self = NULL;
+	}
+}
+
+int lanczos_plan2D_execute(lanczos_plan2D_t* self,
+                           lanczos_pool_t* pool,
+                           int32_t channels,
+                           const float* src, float* dst)
+{
+	ASSERT(self);
+	ASSERT(src);
+	ASSERT(dst);
+
+	return lanczos_plan2D_run(self, pool, LANCZOS_FORMAT_FLOAT32,
+	                          channels, src, dst);
+}
+
+int lanczos_plan2D_executeHalf(lanczos_plan2D_t* self,
+                               lanczos_pool_t* pool,
+                               int32_t format,
+                               int32_t channels,
+                               const uint16_t* src,
+                               uint16_t* dst)
+{
+	ASSERT(self);
+	ASSERT(src);
+	ASSERT(dst);
+
+	return lanczos_plan2D_run(self, pool, format, channels,
+	                          src, dst);
+}
+
+void lanczos_plan2D_executeTile(lanczos_plan2D_t* self,
+                                int32_t channels,
+                                const float* src, float* dst,
+                                int32_t x0, int32_t x1,
+                                int32_t y0, int32_t y1,
+                                float* ring, const float** rows)
+{
+	ASSERT(self);
+	ASSERT(src);
+	ASSERT(dst);
+	ASSERT(ring);
+	ASSERT(rows);
+
+	lanczos_plan1D_t* planx = self->planx;
+	lanczos_plan1D_t* plany = self->plany;
+
+	// the strides are size_t since the images may exceed
+	// 2^31 samples
+	int32_t nch        = channels;
+	int32_t R          = plany->taps;
+	int32_t n          = (x1 - x0)*nch;
+	size_t  src_stride = ((size_t) self->src_w)*nch;
+	size_t  dst_stride = ((size_t) self->dst_w)*nch;
+
+	// the vertical windows are monotonic so each source row
+	// is horizontally resampled once into the ring buffer
+	// and remains available until the window moves past it
+	int32_t      y;
+	int32_t      k;
+	int32_t      first;
+	int32_t      count;
+	int32_t      next = -1;
+	const float* coef;
+	for(y = y0; y < y1; ++y)
+	{
+		coef = lanczos_plan1D_taps(plany, y, &first, &count);
+		if(next < first)
+		{
+			next = first;
+		}
+
+		// Horizontal Interpolation
+		for(; next < first + count; ++next)
+		{
+			lanczos_plan1D_executeRange(planx, nch,
+			                            &src[next*src_stride],
+			                            &ring[(next%R)*n],
+			                            x0, x1);
+		}
+
+		// Vertical Interpolation
+		for(k = 0; k < count; ++k)
+		{
+			rows[k] = &ring[((first + k)%R)*n];
+		}
+		lanczos_simd_vertical(self->flags, n, count, coef, rows,
+		                      &dst[y*dst_stride + x0*nch]);
+	}
+}
+
+int32_t lanczos_plan2D_bandWidth(lanczos_plan2D_t* self,
+                                 int32_t channels)
+{
+	ASSERT(self);
+
+	int32_t nch = channels;
+
+	// size the column bands such that the ring buffer of
+	// horizontally resampled rows fits in cache
+	int32_t rows   = self->plany->taps;
+	int32_t band_w = LANCZOS_PLAN2D_BAND_BYTES/
+	                 (rows*nch*sizeof(float));
+	if(band_w < 16)
+	{
+		band_w = 16;
+	}
+
+	if(band_w >= self->dst_w)
+	{
+		return self->dst_w;
+	}
+
+	// balance the band widths
+	int32_t bands = (self->dst_w + band_w - 1)/band_w;
+	return (self->dst_w + bands - 1)/bands;
+}
+
+size_t lanczos_plan2D_workspace(lanczos_plan2D_t* self,
+                                lanczos_pool_t* pool,
+                                int32_t channels)
+{
+	ASSERT(self);
+
+	// see lanczos_plan2D_run
+	int32_t nch     = channels;
+	int32_t rows    = self->plany->taps;
+	int32_t threads = lanczos_pool_threads(pool);
+	int32_t band_w  = lanczos_plan2D_bandWidth(self, nch);
+
+	return lanczos_workspace_bytes(threads*rows*band_w*nch,
+	                               sizeof(float)) +
+	       lanczos_workspace_bytes(threads*rows,
+	                               sizeof(float*));
+}
+
+size_t lanczos_plan2D_workspaceHalf(lanczos_plan2D_t* self,
+                                    lanczos_pool_t* pool,
+                                    int32_t channels)
+{
+	ASSERT(self);
+
+	// see lanczos_plan2D_run
+	int32_t nch     = channels;
+	int32_t threads = lanczos_pool_threads(pool);
+	int32_t band_w  = lanczos_plan2D_bandWidth(self, nch);
+
+	return lanczos_plan2D_workspace(self, pool, channels) +
+	       lanczos_workspace_bytes(threads*self->src_w*nch,
+	                               sizeof(float)) +
+	       lanczos_workspace_bytes(threads*band_w*nch,
+	                               sizeof(float));
+}
@@ -0,0 +1,118 @@
+/*
+ * Copyright (c) 2025 Jeff Boody
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included
+ * in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+
+#ifndef lanczos_plan2D_H
+#define lanczos_plan2D_H
+
+#include <stdint.h>
+
+#include "lanczos_plan1D.h"
+#include "lanczos_planCache.h"
+#include "lanczos_pool.h"
+#include "lanczos_workspace.h"
+
+// target size of the intermediate buffer
+#define LANCZOS_PLAN2D_BAND_BYTES 262144
+
+// minimum output rows per band for multithreading
+#define LANCZOS_PLAN2D_BAND_ROWS 16
+
+// A separable 2D plan performs a horizontal pass followed by
+// a vertical pass. Rather than materializing the full
+// dst_w*src_h intermediate image, the output is processed in
+// column bands whose horizontally resampled rows are kept in
+// a ring buffer that only holds the rows required by the
+// vertical kernel. The ring buffer is sized to fit in cache.
+// When a thread pool is provided, the output is partitioned
+// into row bands and column bands which are resampled
+// independently with per-thread ring buffers.
+typedef struct
+{
+	uint32_t flags;
+	int32_t  src_w;
+	int32_t  src_h;
+	int32_t  dst_w;
+	int32_t  dst_h;
+
+	// the axes share a plan when their geometry is equal
+	lanczos_planCache_t* cache;
+	lanczos_plan1D_t*    planx;
+	lanczos_plan1D_t*    plany;
+
+	// optional workspace for the uncached plans and the
+	// ring buffers
+	lanczos_workspace_t* ws;
+} lanczos_plan2D_t;
+
+// executeTile resamples the outputs [x0, x1)x[y0, y1) of
+// the images src and dst where ring (n=plany->taps*(x1 -
+// x0)*channels) and rows (n=plany->taps) are scratch
+// buffers such that only the source footprint of the tile
+// is accessed
+// bandWidth returns the width of the column bands such
+// that the ring buffer fits in cache
+// executeHalf resamples 16-bit float images (FLOAT16 or
+// BFLOAT16 format) where the source rows are converted to
+// float as they are loaded, the sums are accumulated in
+// float and the output rows are converted as they are
+// stored (see workspaceHalf for the scratch buffers)
+lanczos_plan2D_t* lanczos_plan2D_new(lanczos_planCache_t* cache,
+                                     lanczos_workspace_t* ws,
+                                     uint32_t flags,
+                                     int32_t a,
+                                     int32_t src_w,
+                                     int32_t src_h,
+                                     int32_t dst_w,
+                                     int32_t dst_h);
+void              lanczos_plan2D_delete(lanczos_plan2D_t** _self);
+int               lanczos_plan2D_execute(lanczos_plan2D_t* self,
+                                         lanczos_pool_t* pool,
+                                         int32_t channels,
+                                         const float* src,
+                                         float* dst);
+void              lanczos_plan2D_executeTile(lanczos_plan2D_t* self,
+                                             int32_t channels,
+                                             const float* src,
+                                             float* dst,
+                                             int32_t x0,
+                                             int32_t x1,
+                                             int32_t y0,
+                                             int32_t y1,
+                                             float* ring,
+                                             const float** rows);
+int               lanczos_plan2D_executeHalf(lanczos_plan2D_t* self,
+                                             lanczos_pool_t* pool,
+                                             int32_t format,
+                                             int32_t channels,
+                                             const uint16_t* src,
+                                             uint16_t* dst);
+int32_t           lanczos_plan2D_bandWidth(lanczos_plan2D_t* self,
+                                           int32_t channels);
+size_t            lanczos_plan2D_workspace(lanczos_plan2D_t* self,
+                                           lanczos_pool_t* pool,
+                                           int32_t channels);
+size_t            lanczos_plan2D_workspaceHalf(lanczos_plan2D_t* self,
+                                               lanczos_pool_t* pool,
+                                               int32_t channels);
+
+#endif
@@ -0,0 +1,247 @@
+/*
+ * Copyright (c) 2025 Jeff Boody
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included
+ * in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+
+#include <stdlib.h>
+
+#define LOG_TAG "lanczos"
+#include "../../libcc/cc_log.h"
+#include "../../libcc/cc_memory.h"
+#include "lanczos_planCache.h"
+
+/*
+ * private
+ */
+
+static lanczos_planCacheEntry_t*
+lanczos_planCache_find(lanczos_planCache_t* self,
+                       uint32_t flags, int32_t a,
+                       int32_t src_w, int32_t dst_w)
+{
+	ASSERT(self);
+
+	int32_t           i;
+	lanczos_plan1D_t* plan;
+	for(i = 0; i < self->count; ++i)
+	{
+		plan = self->entries[i].plan;
+		if((plan->flags == flags) && (plan->a == a) &&
+		   (plan->src_w == src_w) && (plan->dst_w == dst_w))
+		{
+			return &self->entries[i];
+		}
+	}
+
+	return NULL;
+}
+
+static lanczos_planCacheEntry_t*
+lanczos_planCache_slot(lanczos_planCache_t* self)
+{
+	ASSERT(self);
+
+	if(self->count < self->max_count)
+	{
+		lanczos_planCacheEntry_t* entry;
+		entry = &self->entries[self->count];
+		++self->count;
+		return entry;
+	}
+
+	// evict the least recently used plan which is not in use
+	int32_t                   i;
+	lanczos_planCacheEntry_t* lru = NULL;
+	for(i = 0; i < self->count; ++i)
+	{
+		if(self->entries[i].refcount)
+		{
+			continue;
+		}
+
+		if((lru == NULL) || (self->entries[i].stamp < lru->stamp))
+		{
+			lru = &self->entries[i];
+		}
+	}
+
+	if(lru)
+	{
+		lanczos_plan1D_delete(&lru->plan);
+	}
+
+	return lru;
+}
+
+/*
+ * public
+ */
+
+lanczos_planCache_t* lanczos_planCache_new(int32_t max_count)
+{
+	if(max_count <= 0)
+	{
+		LOGE("invalid max_count=%i", max_count);
+		return NULL;
+	}
+
+	lanczos_planCache_t* self;
+	self = (lanczos_planCache_t*)
+	       CALLOC(1, sizeof(lanczos_planCache_t));
+	if(self == NULL)
+	{
+		LOGE("CALLOC failed");
+		return NULL;
+	}
+
+	self->entries = (lanczos_planCacheEntry_t*)
+	                CALLOC(max_count,
+	                       sizeof(lanczos_planCacheEntry_t));
+	if(self->entries == NULL)
+	{
+		LOGE("CALLOC failed");
+		goto fail_entries;
+	}
+
+	if(pthread_mutex_init(&self->mutex, NULL) != 0)
+	{
+		LOGE("pthread_mutex_init failed");
+		goto fail_mutex;
+	}
+
+	self->max_count = max_count;
+
+	// success
+	return self;
+
+	// failure
+	fail_mutex:
+		FREE(self->entries);
+	fail_entries:
+		FREE(self);
+	return NULL;
+}
+
+void lanczos_planCache_delete(lanczos_planCache_t** _self)
+{
+	ASSERT(_self);
+
+	lanczos_planCache_t* self = *_self;
+	if(self)
+	{
+		int32_t i;
+		for(i = 0; i < self->count; ++i)
+		{
+			if(self->entries[i].refcount)
+			{
+				LOGW("plan in use");
+			}
+			lanczos_plan1D_delete(&self->entries[i].plan);
+		}
+
+		pthread_mutex_destroy(&self->mutex);
+		FREE(self->entries);
+		FREE(self);
+		*_self = NULL;
+	}
+}
+
+lanczos_plan1D_t*
+lanczos_planCache_acquire(lanczos_planCache_t* self,
+                          uint32_t flags, int32_t a,
+                          int32_t src_w, int32_t dst_w)
+{
+	ASSERT(self);
+
+	pthread_mutex_lock(&self->mutex);
+
+	lanczos_planCacheEntry_t* entry;
+	entry = lanczos_planCache_find(self, flags, a,
+	                               src_w, dst_w);
+	if(entry == NULL)
+	{
+		// plans are created while holding the lock so that
+		// concurrent requests for the same geometry do not
+		// race to build duplicate plans
+		lanczos_plan1D_t* plan;
+		plan = lanczos_plan1D_new(NULL, flags, a, src_w, dst_w);
+		if(plan == NULL)
+		{
+			pthread_mutex_unlock(&self->mutex);
+			return NULL;
+		}
+
+		entry = lanczos_planCache_slot(self);
+		if(entry == NULL)
+		{
+			// every cached plan is in use so the caller
+			// receives an uncached plan which is deleted
+			// on release
+			pthread_mutex_unlock(&self->mutex);
+			return plan;
+		}
+
+		entry->plan     = plan;
+		entry->refcount = 0;
+	}
+
+	++self->stamp;
+	++entry->refcount;
+	entry->stamp = self->stamp;
+
+	lanczos_plan1D_t* plan = entry->plan;
+
+	pthread_mutex_unlock(&self->mutex);
+
+	return plan;
+}
+
+void lanczos_planCache_release(lanczos_planCache_t* self,
+                               lanczos_plan1D_t** _plan)
+{
+	ASSERT(self);
+	ASSERT(_plan);
+
+	lanczos_plan1D_t* plan = *_plan;
+	if(plan == NULL)
+	{
+		return;
+	}
+
+	pthread_mutex_lock(&self->mutex);
+
+	int32_t i;
+	for(i = 0; i < self->count; ++i)
+	{
+		if(self->entries[i].plan == plan)
+		{
+			--self->entries[i].refcount;
+			pthread_mutex_unlock(&self->mutex);
+			*_plan = NULL;
+			return;
+		}
+	}
+
+	pthread_mutex_unlock(&self->mutex);
+
+	// uncached plan
+	lanczos_plan1D_delete(_plan);
+}
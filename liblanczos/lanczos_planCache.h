@@ -0,0 +1,61 @@
+/*
+ * Copyright (c) 2025 Jeff Boody
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included
+ * in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+
+#ifndef lanczos_planCache_H
+#define lanczos_planCache_H
+
+#include <pthread.h>
+
+#include "lanczos_plan1D.h"
+
+typedef struct
+{
+	lanczos_plan1D_t* plan;
+	int32_t           refcount;
+	uint64_t          stamp;
+} lanczos_planCacheEntry_t;
+
+// A thread-safe LRU cache of 1D plans keyed on geometry
+// (flags, a, src_w, dst_w). Plans which are acquired from
+// the cache must be released back to the cache and are
+// never evicted while they are in use.
+typedef struct
+{
+	pthread_mutex_t           mutex;
+	uint64_t                  stamp;
+	int32_t                   max_count;
+	int32_t                   count;
+	lanczos_planCacheEntry_t* entries; // n=max_count
+} lanczos_planCache_t;
+
+lanczos_planCache_t* lanczos_planCache_new(int32_t max_count);
+void                 lanczos_planCache_delete(lanczos_planCache_t** _self);
+lanczos_plan1D_t*    lanczos_planCache_acquire(lanczos_planCache_t* self,
+                                               uint32_t flags,
+                                               int32_t a,
+                                               int32_t src_w,
+                                               int32_t dst_w);
+void                 lanczos_planCache_release(lanczos_planCache_t* self,
+                                               lanczos_plan1D_t** _plan);
+
+#endif
@@ -0,0 +1,654 @@
+/*
+ * Copyright (c) 2025 Jeff Boody
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included
+ * in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+#include <math.h>
+#include <stdlib.h>
+
+#define LOG_TAG "lanczos"
+#include "../../libcc/cc_log.h"
+#include "lanczos_planFixed1D.h"
+#include "lanczos_resample.h"
+#include "lanczos_simd.h"
+
+/*
+ * private
+ */
+
+static void
+lanczos_planFixed1D_quantize(int32_t count, const float* coef,
+                             int32_t bits, int32_t* q)
+{
+	ASSERT(coef);
+	ASSERT(q);
+
+	// round the coefficients and add the residual to the
+	// largest coefficient such that the sum is preserved
+	// (e.g. exactly one unless zero padding drops taps)
+	int32_t k;
+	int32_t kmax  = 0;
+	int64_t sum   = 0;
+	double  total = 0.0;
+	float   one   = (float) (1 << bits);
+	for(k = 0; k < count; ++k)
+	{
+		q[k]   = (int32_t) floorf(one*coef[k] + 0.5f);
+		sum   += q[k];
+		total += coef[k];
+		if(fabsf(coef[k]) > fabsf(coef[kmax]))
+		{
+			kmax = k;
+		}
+	}
+
+	if(count)
+	{
+		q[kmax] += (int32_t) (((int64_t) floor(one*total + 0.5)) -
+		                      sum);
+	}
+}
+
+static inline void
+lanczos_planFixed1D_rangeU8(lanczos_planFixed1D_t* self,
+                            int32_t nch,
+                            const uint8_t* src, int16_t* dst,
+                            int32_t ja, int32_t jb)
+{
+	ASSERT(self);
+	ASSERT(src);
+	ASSERT(dst);
+
+	int32_t shift = LANCZOS_PLANFIXED1D_BITS8 -
+	                LANCZOS_PLANFIXED1D_FRAC8;
+	int32_t round = 1 << (shift - 1);
+
+	int32_t        j;
+	int32_t        k;
+	int32_t        i;
+	int32_t        count;
+	int32_t        sum;
+	const int16_t* coef;
+	const uint8_t* s1;
+	for(j = ja; j < jb; ++j)
+	{
+		count = self->count[j];
+		coef  = &self->coef16[j*self->taps];
+		s1    = &src[self->first[j]*nch];
+		for(i = 0; i < nch; ++i)
+		{
+			sum = round;
+			for(k = 0; k < count; ++k)
+			{
+				sum += coef[k]*s1[k*nch + i];
+			}
+			sum >>= shift;
+
+			// saturate the intermediate sample
+			if(sum < INT16_MIN)
+			{
+				sum = INT16_MIN;
+			}
+			else if(sum > INT16_MAX)
+			{
+				sum = INT16_MAX;
+			}
+			*dst++ = (int16_t) sum;
+		}
+	}
+}
+
+static inline void
+lanczos_planFixed1D_rangeU16(lanczos_planFixed1D_t* self,
+                             int32_t nch,
+                             const uint16_t* src, int32_t* dst,
+                             int32_t ja, int32_t jb)
+{
+	ASSERT(self);
+	ASSERT(src);
+	ASSERT(dst);
+
+	int32_t shift = LANCZOS_PLANFIXED1D_BITS16 -
+	                LANCZOS_PLANFIXED1D_FRAC16;
+	int64_t round = ((int64_t) 1) << (shift - 1);
+
+	int32_t         j;
+	int32_t         k;
+	int32_t         i;
+	int32_t         count;
+	int64_t         sum;
+	const int32_t*  coef;
+	const uint16_t* s1;
+	for(j = ja; j < jb; ++j)
+	{
+		count = self->count[j];
+		coef  = &self->coef32[j*self->taps];
+		s1    = &src[self->first[j]*nch];
+		for(i = 0; i < nch; ++i)
+		{
+			sum = round;
+			for(k = 0; k < count; ++k)
+			{
+				sum += ((int64_t) coef[k])*s1[k*nch + i];
+			}
+			*dst++ = (int32_t) (sum >> shift);
+		}
+	}
+}
+
+static inline void
+lanczos_planFixed1D_executeU8(lanczos_planFixed1D_t* self,
+                              int32_t nch,
+                              const uint8_t* src, uint8_t* dst)
+{
+	ASSERT(self);
+	ASSERT(src);
+	ASSERT(dst);
+
+	int32_t shift = LANCZOS_PLANFIXED1D_BITS8;
+	int32_t round = 1 << (shift - 1);
+
+	int32_t        j;
+	int32_t        k;
+	int32_t        i;
+	int32_t        count;
+	int32_t        sum;
+	const int16_t* coef;
+	const uint8_t* s1;
+	for(j = 0; j < self->dst_w; ++j)
+	{
+		count = self->count[j];
+		coef  = &self->coef16[j*self->taps];
+		s1    = &src[self->first[j]*nch];
+		for(i = 0; i < nch; ++i)
+		{
+			sum = round;
+			for(k = 0; k < count; ++k)
+			{
+				sum += coef[k]*s1[k*nch + i];
+			}
+			sum >>= shift;
+
+			// round and clamp into the output range
+			if(sum < 0)
+			{
+				sum = 0;
+			}
+			else if(sum > UINT8_MAX)
+			{
+				sum = UINT8_MAX;
+			}
+			*dst++ = (uint8_t) sum;
+		}
+	}
+}
+
+static inline void
+lanczos_planFixed1D_executeU16(lanczos_planFixed1D_t* self,
+                               int32_t nch,
+                               const uint16_t* src,
+                               uint16_t* dst)
+{
+	ASSERT(self);
+	ASSERT(src);
+	ASSERT(dst);
+
+	int32_t shift = LANCZOS_PLANFIXED1D_BITS16;
+	int64_t round = ((int64_t) 1) << (shift - 1);
+
+	int32_t         j;
+	int32_t         k;
+	int32_t         i;
+	int32_t         count;
+	int64_t         sum;
+	const int32_t*  coef;
+	const uint16_t* s1;
+	for(j = 0; j < self->dst_w; ++j)
+	{
+		count = self->count[j];
+		coef  = &self->coef32[j*self->taps];
+		s1    = &src[self->first[j]*nch];
+		for(i = 0; i < nch; ++i)
+		{
+			sum = round;
+			for(k = 0; k < count; ++k)
+			{
+				sum += ((int64_t) coef[k])*s1[k*nch + i];
+			}
+			sum >>= shift;
+
+			// round and clamp into the output range
+			if(sum < 0)
+			{
+				sum = 0;
+			}
+			else if(sum > UINT16_MAX)
+			{
+				sum = UINT16_MAX;
+			}
+			*dst++ = (uint16_t) sum;
+		}
+	}
+}
+
+static void
+lanczos_planFixed1D_verticalU8(int32_t n, int32_t count,
+                               const int16_t* coef,
+                               const int16_t** rows,
+                               int32_t* acc, uint8_t* dst)
+{
+	ASSERT(coef);
+	ASSERT(rows);
+	ASSERT(acc);
+	ASSERT(dst);
+
+	int32_t shift = LANCZOS_PLANFIXED1D_BITS8 +
+	                LANCZOS_PLANFIXED1D_FRAC8;
+	int32_t round = 1 << (shift - 1);
+
+	// accumulate the rows one at a time such that the
+	// inner loops are contiguous and vectorize
+	int32_t        x;
+	int32_t        k;
+	int32_t        c;
+	int32_t        sum;
+	const int16_t* row;
+	for(x = 0; x < n; ++x)
+	{
+		acc[x] = round;
+	}
+
+	for(k = 0; k < count; ++k)
+	{
+		c   = coef[k];
+		row = rows[k];
+		for(x = 0; x < n; ++x)
+		{
+			acc[x] += c*row[x];
+		}
+	}
+
+	// round and clamp into the output range
+	for(x = 0; x < n; ++x)
+	{
+		sum = acc[x] >> shift;
+		sum = (sum < 0) ? 0 : sum;
+		sum = (sum > UINT8_MAX) ? UINT8_MAX : sum;
+		dst[x] = (uint8_t) sum;
+	}
+}
+
+static void
+lanczos_planFixed1D_verticalU16(int32_t n, int32_t count,
+                                const int32_t* coef,
+                                const int32_t** rows,
+                                int64_t* acc, uint16_t* dst)
+{
+	ASSERT(coef);
+	ASSERT(rows);
+	ASSERT(acc);
+	ASSERT(dst);
+
+	int32_t shift = LANCZOS_PLANFIXED1D_BITS16 +
+	                LANCZOS_PLANFIXED1D_FRAC16;
+	int64_t round = ((int64_t) 1) << (shift - 1);
+
+	// see lanczos_planFixed1D_verticalU8
+	int32_t        x;
+	int32_t        k;
+	int64_t        c;
+	int64_t        sum;
+	const int32_t* row;
+	for(x = 0; x < n; ++x)
+	{
+		acc[x] = round;
+	}
+
+	for(k = 0; k < count; ++k)
+	{
+		c   = coef[k];
+		row = rows[k];
+		for(x = 0; x < n; ++x)
+		{
+			acc[x] += c*row[x];
+		}
+	}
+
+	for(x = 0; x < n; ++x)
+	{
+		sum = acc[x] >> shift;
+		sum = (sum < 0) ? 0 : sum;
+		sum = (sum > UINT16_MAX) ? UINT16_MAX : sum;
+		dst[x] = (uint16_t) sum;
+	}
+}
+
+/*
+ * public
+ */
+
+lanczos_planFixed1D_t*
+lanczos_planFixed1D_new(lanczos_workspace_t* ws,
+                        lanczos_plan1D_t* plan,
+                        int32_t format)
+{
+	ASSERT(plan);
+
+	int32_t bits;
+	if(format == LANCZOS_FORMAT_UINT8)
+	{
+		bits = LANCZOS_PLANFIXED1D_BITS8;
+	}
+	else if(format == LANCZOS_FORMAT_UINT16)
+	{
+		bits = LANCZOS_PLANFIXED1D_BITS16;
+	}
+	else
+	{
+		LOGE("invalid format=%i", format);
+		return NULL;
+	}
+
+	lanczos_planFixed1D_t* self;
+	self = (lanczos_planFixed1D_t*)
+	       lanczos_workspace_calloc(ws, 1,
+	                                sizeof(lanczos_planFixed1D_t));
+	if(self == NULL)
+	{
+		LOGE("CALLOC failed");
+		return NULL;
+	}
+
+	int32_t dst_w = plan->dst_w;
+	int32_t taps  = plan->taps;
+
+	self->ws     = ws;
+	self->flags  = plan->flags;
+	self->format = format;
+	self->dst_w  = dst_w;
+	self->taps   = taps;
+
+	if(format == LANCZOS_FORMAT_UINT8)
+	{
+		self->bytes    = sizeof(uint8_t);
+		self->size     = sizeof(int16_t);
+		self->acc_size = sizeof(int32_t);
+	}
+	else
+	{
+		self->bytes    = sizeof(uint16_t);
+		self->size     = sizeof(int32_t);
+		self->acc_size = sizeof(int64_t);
+	}
+
+	self->first = (int32_t*)
+	              lanczos_workspace_calloc(ws, dst_w,
+	                                       sizeof(int32_t));
+	if(self->first == NULL)
+	{
+		LOGE("CALLOC failed");
+		goto fail_first;
+	}
+
+	self->count = (int32_t*)
+	              lanczos_workspace_calloc(ws, dst_w,
+	                                       sizeof(int32_t));
+	if(self->count == NULL)
+	{
+		LOGE("CALLOC failed");
+		goto fail_count;
+	}
+
+	int32_t* coef32 = NULL;
+	if(format == LANCZOS_FORMAT_UINT8)
+	{
+		self->coef16 = (int16_t*)
+		               lanczos_workspace_calloc(ws, dst_w*taps,
+		                                        sizeof(int16_t));
+		if(self->coef16 == NULL)
+		{
+			LOGE("CALLOC failed");
+			goto fail_coef;
+		}
+
+		// scratch buffer of the quantized coefficients
+		coef32 = (int32_t*)
+		         lanczos_workspace_calloc(ws, taps,
+		                                  sizeof(int32_t));
+		if(coef32 == NULL)
+		{
+			LOGE("CALLOC failed");
+			goto fail_coef32;
+		}
+	}
+	else
+	{
+		self->coef32 = (int32_t*)
+		               lanczos_workspace_calloc(ws, dst_w*taps,
+		                                        sizeof(int32_t));
+		if(self->coef32 == NULL)
+		{
+			LOGE("CALLOC failed");
+			goto fail_coef;
+		}
+	}
+
+	int32_t      j;
+	int32_t      k;
+	const float* coef;
+	for(j = 0; j < dst_w; ++j)
+	{
+		coef = lanczos_plan1D_taps(plan, j, &self->first[j],
+		                           &self->count[j]);
+		if(self->coef16)
+		{
+			lanczos_planFixed1D_quantize(self->count[j], coef,
+			                             bits, coef32);
+			for(k = 0; k < self->count[j]; ++k)
+			{
+				self->coef16[j*taps + k] = (int16_t) coef32[k];
+			}
+		}
+		else
+		{
+			lanczos_planFixed1D_quantize(self->count[j], coef,
+			                             bits,
+			                             &self->coef32[j*taps]);
+		}
+	}
+	lanczos_workspace_free(ws, coef32);
+
+	// success
+	return self;
+
+	// failure
+	fail_coef32:
+		lanczos_workspace_free(ws, self->coef16);
+	fail_coef:
+		lanczos_workspace_free(ws, self->count);
+	fail_count:
+		lanczos_workspace_free(ws, self->first);
+	fail_first:
+		lanczos_workspace_free(ws, self);
+	return NULL;
+}
+
+void lanczos_planFixed1D_delete(lanczos_planFixed1D_t** _self)
+{
+	ASSERT(_self);
+
+	lanczos_planFixed1D_t* self = *_self;
+	if(self)
+	{
+		lanczos_workspace_free(self->ws, self->coef16);
+		lanczos_workspace_free(self->ws, self->coef32);
+		lanczos_workspace_free(self->ws, self->count);
+		lanczos_workspace_free(self->ws, self->first);
+		lanczos_workspace_free(self->ws, self);
+		*_self = NULL;
+	}
+}
+
+void lanczos_planFixed1D_execute(lanczos_planFixed1D_t* self,
+                                 int32_t channels,
+                                 const void* src, void* dst)
+{
+	ASSERT(self);
+	ASSERT(src);
+	ASSERT(dst);
+
+	// specialize the common channel counts such that the
+	// per-channel sums are unrolled
+	int32_t nch = channels;
+	if(self->format == LANCZOS_FORMAT_UINT8)
+	{
+		if(nch == 1)
+		{
+			lanczos_planFixed1D_executeU8(self, 1, src, dst);
+		}
+		else if(nch == 3)
+		{
+			lanczos_planFixed1D_executeU8(self, 3, src, dst);
+		}
+		else if(nch == 4)
+		{
+			lanczos_planFixed1D_executeU8(self, 4, src, dst);
+		}
+		else
+		{
+			lanczos_planFixed1D_executeU8(self, nch, src, dst);
+		}
+	}
+	else
+	{
+		if(nch == 1)
+		{
+			lanczos_planFixed1D_executeU16(self, 1, src, dst);
+		}
+		else if(nch == 3)
+		{
+			lanczos_planFixed1D_executeU16(self, 3, src, dst);
+		}
+		else if(nch == 4)
+		{
+			lanczos_planFixed1D_executeU16(self, 4, src, dst);
+		}
+		else
+		{
+			lanczos_planFixed1D_executeU16(self, nch, src, dst);
+		}
+	}
+}
+
+void lanczos_planFixed1D_executeRange(lanczos_planFixed1D_t* self,
+                                      int32_t channels,
+                                      const void* src,
+                                      void* dst,
+                                      int32_t ja, int32_t jb)
+{
+	ASSERT(self);
+	ASSERT(src);
+	ASSERT(dst);
+
+	// see lanczos_planFixed1D_execute
+	int32_t nch = channels;
+	if(self->format == LANCZOS_FORMAT_UINT8)
+	{
+		if(lanczos_simd_horizontalU8(self, nch, src, dst, ja, jb))
+		{
+			return;
+		}
+		else if(nch == 1)
+		{
+			lanczos_planFixed1D_rangeU8(self, 1, src, dst, ja, jb);
+		}
+		else if(nch == 3)
+		{
+			lanczos_planFixed1D_rangeU8(self, 3, src, dst, ja, jb);
+		}
+		else if(nch == 4)
+		{
+			lanczos_planFixed1D_rangeU8(self, 4, src, dst, ja, jb);
+		}
+		else
+		{
+			lanczos_planFixed1D_rangeU8(self, nch, src, dst,
+			                            ja, jb);
+		}
+	}
+	else
+	{
+		if(nch == 1)
+		{
+			lanczos_planFixed1D_rangeU16(self, 1, src, dst, ja, jb);
+		}
+		else if(nch == 3)
+		{
+			lanczos_planFixed1D_rangeU16(self, 3, src, dst, ja, jb);
+		}
+		else if(nch == 4)
+		{
+			lanczos_planFixed1D_rangeU16(self, 4, src, dst, ja, jb);
+		}
+		else
+		{
+			lanczos_planFixed1D_rangeU16(self, nch, src, dst,
+			                             ja, jb);
+		}
+	}
+}
+
+void lanczos_planFixed1D_executeVertical(lanczos_planFixed1D_t* self,
+                                         int32_t j, int32_t n,
+                                         const void** rows,
+                                         void* acc, void* dst)
+{
+	ASSERT(self);
+	ASSERT((j >= 0) && (j < self->dst_w));
+	ASSERT(rows);
+	ASSERT(acc);
+	ASSERT(dst);
+
+	int32_t count = self->count[j];
+	if(self->format == LANCZOS_FORMAT_UINT8)
+	{
+		if(lanczos_simd_verticalU8(self->flags, n, count,
+		                           &self->coef16[j*self->taps],
+		                           (const int16_t**) rows,
+		                           (uint8_t*) dst))
+		{
+			return;
+		}
+
+		lanczos_planFixed1D_verticalU8(n, count,
+		                               &self->coef16[j*self->taps],
+		                               (const int16_t**) rows,
+		                               (int32_t*) acc,
+		                               (uint8_t*) dst);
+	}
+	else
+	{
+		lanczos_planFixed1D_verticalU16(n, count,
+		                                &self->coef32[j*self->taps],
+		                                (const int32_t**) rows,
+		                                (int64_t*) acc,
+		                                (uint16_t*) dst);
+	}
+}
@@ -0,0 +1,104 @@
+/*
+ * Copyright (c) 2025 Jeff Boody
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included
+ * in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+#ifndef lanczos_planFixed1D_H
+#define lanczos_planFixed1D_H
+
+#include <stdint.h>
+
+#include "lanczos_plan1D.h"
+#include "lanczos_workspace.h"
+
+// UINT8: Q14 int16 coefficients, Q6 int16 intermediate
+// samples and int32 accumulation
+#define LANCZOS_PLANFIXED1D_BITS8 14
+#define LANCZOS_PLANFIXED1D_FRAC8 6
+
+// UINT16: Q24 int32 coefficients, Q8 int32 intermediate
+// samples and int64 accumulation
+#define LANCZOS_PLANFIXED1D_BITS16 24
+#define LANCZOS_PLANFIXED1D_FRAC16 8
+
+// A fixed-point plan quantizes the normalized coefficients
+// of a 1D plan for the integer sample formats. The
+// coefficients of every output are rounded such that their
+// sum is exactly one (e.g. flat regions are preserved) and
+// the edge handling is folded into the coefficients such
+// that the source window is always in range. The plan does
+// not own the 1D plan.
+//
+// The horizontal pass (executeRange) produces intermediate
+// samples with extra fraction bits (n=size bytes per
+// sample) and the vertical pass (executeVertical) rounds
+// and clamps the accumulated sums into the output format
+// as they are stored. The 1D pass (execute) rounds and
+// clamps directly.
+typedef struct
+{
+	// optional workspace
+	lanczos_workspace_t* ws;
+
+	uint32_t flags;
+	int32_t  format;
+	int32_t dst_w;
+	int32_t taps;
+
+	// bytes per source/output sample, intermediate sample
+	// and accumulator
+	int32_t bytes;
+	int32_t size;
+	int32_t acc_size;
+
+	int32_t* first;  // n=dst_w
+	int32_t* count;  // n=dst_w
+	int16_t* coef16; // n=dst_w*taps (UINT8)
+	int32_t* coef32; // n=dst_w*taps (UINT16)
+} lanczos_planFixed1D_t;
+
+// executeRange resamples the outputs [ja, jb) of the source
+// row src into the intermediate row dst where dst points to
+// the output ja
+// executeVertical resamples the output j of n samples from
+// the intermediate rows of its source window (n=count)
+// where acc is a scratch buffer (n=n*acc_size bytes)
+lanczos_planFixed1D_t* lanczos_planFixed1D_new(lanczos_workspace_t* ws,
+                                               lanczos_plan1D_t* plan,
+                                               int32_t format);
+void                   lanczos_planFixed1D_delete(lanczos_planFixed1D_t** _self);
+void                   lanczos_planFixed1D_execute(lanczos_planFixed1D_t* self,
+                                                   int32_t channels,
+                                                   const void* src,
+                                                   void* dst);
+void                   lanczos_planFixed1D_executeRange(lanczos_planFixed1D_t* self,
+                                                        int32_t channels,
+                                                        const void* src,
+                                                        void* dst,
+                                                        int32_t ja,
+                                                        int32_t jb);
+void                   lanczos_planFixed1D_executeVertical(lanczos_planFixed1D_t* self,
+                                                           int32_t j,
+                                                           int32_t n,
+                                                           const void** rows,
+                                                           void* acc,
+                                                           void* dst);
+
+#endif
@@ -0,0 +1,376 @@
+/*
+ * Copyright (c) 2025 Jeff Boody
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included
+ * in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+#include <stdlib.h>
+
+#define LOG_TAG "lanczos"
+#include "../../libcc/cc_log.h"
+#include "lanczos_planFixed2D.h"
+#include "lanczos_resample.h"
+
+typedef struct
+{
+	lanczos_planFixed2D_t* self;
+	int32_t                nch;
+	const void*            src;
+	void*                  dst;
+	int32_t                band_w;
+	int32_t                band_h;
+	int32_t                bands_x;
+	uint8_t*               ring;
+	const void**           ring_rows;
+	uint8_t*               acc;
+} lanczos_planFixed2DTask_t;
+
+/*
+ * private
+ */
+
+static int32_t
+lanczos_planFixed2D_bandWidth(lanczos_planFixed2D_t* self,
+                              int32_t nch)
+{
+	ASSERT(self);
+
+	// see lanczos_plan2D_bandWidth
+	lanczos_plan2D_t* plan   = self->plan;
+	int32_t           rows   = plan->plany->taps;
+	int32_t           band_w = LANCZOS_PLAN2D_BAND_BYTES/
+	                           (rows*nch*self->fx->size);
+	if(band_w < 16)
+	{
+		band_w = 16;
+	}
+
+	if(band_w >= plan->dst_w)
+	{
+		return plan->dst_w;
+	}
+
+	int32_t bands = (plan->dst_w + band_w - 1)/band_w;
+	return (plan->dst_w + bands - 1)/bands;
+}
+
+static void
+lanczos_planFixed2D_task(void* arg, int32_t task, int32_t thread)
+{
+	ASSERT(arg);
+
+	lanczos_planFixed2DTask_t* t    = (lanczos_planFixed2DTask_t*) arg;
+	lanczos_planFixed2D_t*     self = t->self;
+	lanczos_plan2D_t*          plan = self->plan;
+
+	int32_t rows = plan->plany->taps;
+	int32_t n    = t->band_w*t->nch;
+	int32_t x0   = (task%t->bands_x)*t->band_w;
+	int32_t y0   = (task/t->bands_x)*t->band_h;
+	int32_t x1   = x0 + t->band_w;
+	int32_t y1   = y0 + t->band_h;
+	if(x1 > plan->dst_w)
+	{
+		x1 = plan->dst_w;
+	}
+	if(y1 > plan->dst_h)
+	{
+		y1 = plan->dst_h;
+	}
+
+	lanczos_planFixed2D_executeTile(self, t->nch, t->src, t->dst,
+	                                x0, x1, y0, y1,
+	                                &t->ring[thread*rows*n*self->fx->size],
+	                                &t->ring_rows[thread*rows],
+	                                &t->acc[thread*n*self->fy->acc_size]);
+}
+
+/*
+ * public
+ */
+
+lanczos_planFixed2D_t*
+lanczos_planFixed2D_new(lanczos_planCache_t* cache,
+                        lanczos_workspace_t* ws,
+                        uint32_t flags, int32_t a,
+                        int32_t format,
+                        int32_t src_w, int32_t src_h,
+                        int32_t dst_w, int32_t dst_h)
+{
+	if(flags & LANCZOS_FLAG_MULTIDIM_2D_ISOTROPIC)
+	{
+		LOGE("invalid flags=0x%X", flags);
+		return NULL;
+	}
+
+	lanczos_planFixed2D_t* self;
+	self = (lanczos_planFixed2D_t*)
+	       lanczos_workspace_calloc(ws, 1,
+	                                sizeof(lanczos_planFixed2D_t));
+	if(self == NULL)
+	{
+		LOGE("CALLOC failed");
+		return NULL;
+	}
+
+	self->format = format;
+	self->ws     = ws;
+
+	self->plan = lanczos_plan2D_new(cache, ws, flags, a,
+	                                src_w, src_h, dst_w, dst_h);
+	if(self->plan == NULL)
+	{
+		goto fail_plan;
+	}
+
+	self->fx = lanczos_planFixed1D_new(ws, self->plan->planx,
+	                                   format);
+	if(self->fx == NULL)
+	{
+		goto fail_fx;
+	}
+
+	// share the fixed-point plan when the plans are shared
+	if(self->plan->plany == self->plan->planx)
+	{
+		self->fy = self->fx;
+	}
+	else
+	{
+		self->fy = lanczos_planFixed1D_new(ws, self->plan->plany,
+		                                   format);
+		if(self->fy == NULL)
+		{
+			goto fail_fy;
+		}
+	}
+
+	// success
+	return self;
+
+	// failure
+	fail_fy:
+		lanczos_planFixed1D_delete(&self->fx);
+	fail_fx:
+		lanczos_plan2D_delete(&self->plan);
+	fail_plan:
+		lanczos_workspace_free(ws, self);
+	return NULL;
+}
+
+void lanczos_planFixed2D_delete(lanczos_planFixed2D_t** _self)
+{
+	ASSERT(_self);
+
+	lanczos_planFixed2D_t* self = *_self;
+	if(self)
+	{
+		if(self->fy == self->fx)
+		{
+			self->fy = NULL;
+		}
+		else
+		{
+			lanczos_planFixed1D_delete(&self->fy);
+		}
+		lanczos_planFixed1D_delete(&self->fx);
+		lanczos_plan2D_delete(&self->plan);
+		lanczos_workspace_free(self->ws, self);
+		*_self = NULL;
+	}
+}
+
+int lanczos_planFixed2D_execute(lanczos_planFixed2D_t* self,
+                                lanczos_pool_t* pool,
+                                int32_t channels,
+                                const void* src, void* dst)
+{
+	ASSERT(self);
+	ASSERT(src);
+	ASSERT(dst);
+
+	// see lanczos_plan2D_execute
+	lanczos_plan2D_t* plan = self->plan;
+
+	int32_t nch     = channels;
+	int32_t rows    = plan->plany->taps;
+	int32_t threads = lanczos_pool_threads(pool);
+	int32_t band_w  = lanczos_planFixed2D_bandWidth(self, nch);
+	int32_t bands_x = (plan->dst_w + band_w - 1)/band_w;
+
+	int32_t band_h  = plan->dst_h;
+	int32_t bands_y = 1;
+	if(threads > 1)
+	{
+		bands_y = (4*threads + bands_x - 1)/bands_x;
+		band_h  = (plan->dst_h + bands_y - 1)/bands_y;
+		if(band_h < LANCZOS_PLAN2D_BAND_ROWS)
+		{
+			band_h = LANCZOS_PLAN2D_BAND_ROWS;
+		}
+		bands_y = (plan->dst_h + band_h - 1)/band_h;
+	}
+
+	// per-thread ring buffers and accumulators
+	uint8_t* ring = (uint8_t*)
+	                lanczos_workspace_calloc(self->ws,
+	                                         threads*rows*band_w*nch,
+	                                         self->fx->size);
+	if(ring == NULL)
+	{
+		LOGE("CALLOC failed");
+		return 0;
+	}
+
+	const void** ring_rows = (const void**)
+	                         lanczos_workspace_calloc(self->ws,
+	                                                  threads*rows,
+	                                                  sizeof(void*));
+	if(ring_rows == NULL)
+	{
+		LOGE("CALLOC failed");
+		goto fail_ring_rows;
+	}
+
+	uint8_t* acc = (uint8_t*)
+	               lanczos_workspace_calloc(self->ws,
+	                                        threads*band_w*nch,
+	                                        self->fy->acc_size);
+	if(acc == NULL)
+	{
+		LOGE("CALLOC failed");
+		goto fail_acc;
+	}
+
+	lanczos_planFixed2DTask_t task =
+	{
+		.self      = self,
+		.nch       = nch,
+		.src       = src,
+		.dst       = dst,
+		.band_w    = band_w,
+		.band_h    = band_h,
+		.bands_x   = bands_x,
+		.ring      = ring,
+		.ring_rows = ring_rows,
+		.acc       = acc,
+	};
+
+	lanczos_pool_run(pool, bands_x*bands_y,
+	                 lanczos_planFixed2D_task, &task);
+
+	lanczos_workspace_free(self->ws, acc);
+	lanczos_workspace_free(self->ws, ring_rows);
+	lanczos_workspace_free(self->ws, ring);
+
+	// success
+	return 1;
+
+	// failure
+	fail_acc:
+		lanczos_workspace_free(self->ws, ring_rows);
+	fail_ring_rows:
+		lanczos_workspace_free(self->ws, ring);
+	return 0;
+}
+
+void lanczos_planFixed2D_executeTile(lanczos_planFixed2D_t* self,
+                                     int32_t channels,
+                                     const void* src, void* dst,
+                                     int32_t x0, int32_t x1,
+                                     int32_t y0, int32_t y1,
+                                     void* ring, const void** rows,
+                                     void* acc)
+{
+	ASSERT(self);
+	ASSERT(src);
+	ASSERT(dst);
+	ASSERT(ring);
+	ASSERT(rows);
+	ASSERT(acc);
+
+	lanczos_planFixed1D_t* fx   = self->fx;
+	lanczos_planFixed1D_t* fy   = self->fy;
+	lanczos_plan2D_t*      plan = self->plan;
+
+	// see lanczos_plan2D_executeTile
+	// the strides are in bytes
+	int32_t        nch        = channels;
+	int32_t        R          = plan->plany->taps;
+	int32_t        n          = (x1 - x0)*nch;
+	size_t         ring_size  = ((size_t) n)*fx->size;
+	size_t         src_stride = ((size_t) plan->src_w)*nch*fx->bytes;
+	size_t         dst_stride = ((size_t) plan->dst_w)*nch*fx->bytes;
+	const uint8_t* s1         = (const uint8_t*) src;
+	uint8_t*       s2         = (uint8_t*) dst;
+	uint8_t*       r          = (uint8_t*) ring;
+
+	int32_t y;
+	int32_t k;
+	int32_t first;
+	int32_t count;
+	int32_t next = -1;
+	for(y = y0; y < y1; ++y)
+	{
+		first = fy->first[y];
+		count = fy->count[y];
+		if(next < first)
+		{
+			next = first;
+		}
+
+		// Horizontal Interpolation
+		for(; next < first + count; ++next)
+		{
+			lanczos_planFixed1D_executeRange(fx, nch,
+			                                 &s1[next*src_stride],
+			                                 &r[(next%R)*ring_size],
+			                                 x0, x1);
+		}
+
+		// Vertical Interpolation
+		for(k = 0; k < count; ++k)
+		{
+			rows[k] = &r[((first + k)%R)*ring_size];
+		}
+		lanczos_planFixed1D_executeVertical(fy, y, n, rows, acc,
+		                                    &s2[y*dst_stride +
+		                                        x0*nch*fx->bytes]);
+	}
+}
+
+size_t lanczos_planFixed2D_workspace(lanczos_planFixed2D_t* self,
+                                     lanczos_pool_t* pool,
+                                     int32_t channels)
+{
+	ASSERT(self);
+
+	// see lanczos_planFixed2D_execute
+	int32_t nch     = channels;
+	int32_t rows    = self->plan->plany->taps;
+	int32_t threads = lanczos_pool_threads(pool);
+	int32_t band_w  = lanczos_planFixed2D_bandWidth(self, nch);
+
+	return lanczos_workspace_bytes(threads*rows*band_w*nch,
+	                               self->fx->size) +
+	       lanczos_workspace_bytes(threads*rows,
+	                               sizeof(void*)) +
+	       lanczos_workspace_bytes(threads*band_w*nch,
+	                               self->fy->acc_size);
+}
@@ -0,0 +1,87 @@
+/*
+ * Copyright (c) 2025 Jeff Boody
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included
+ * in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+#ifndef lanczos_planFixed2D_H
+#define lanczos_planFixed2D_H
+
+#include <stdint.h>
+
+#include "lanczos_plan2D.h"
+#include "lanczos_planCache.h"
+#include "lanczos_planFixed1D.h"
+#include "lanczos_pool.h"
+#include "lanczos_workspace.h"
+
+// A separable 2D plan for the integer sample formats which
+// follows the column/row bands of lanczos_plan2D_t. The
+// horizontally resampled rows are kept in a ring buffer of
+// intermediate samples (int16 for UINT8 and int32 for
+// UINT16) and the vertical pass rounds and clamps the
+// output rows as they are stored such that the images are
+// never expanded to float.
+typedef struct
+{
+	int32_t                format;
+	lanczos_plan2D_t*      plan;
+	lanczos_planFixed1D_t* fx;
+	lanczos_planFixed1D_t* fy;
+
+	// optional workspace for the plans and the ring buffers
+	lanczos_workspace_t* ws;
+} lanczos_planFixed2D_t;
+
+// executeTile resamples the outputs [x0, x1)x[y0, y1) of
+// the images src and dst where ring (n=plany->taps*(x1 -
+// x0)*channels*fx->size bytes), rows (n=plany->taps) and
+// acc (n=(x1 - x0)*channels*fy->acc_size bytes) are
+// scratch buffers
+lanczos_planFixed2D_t* lanczos_planFixed2D_new(lanczos_planCache_t* cache,
+                                               lanczos_workspace_t* ws,
+                                               uint32_t flags,
+                                               int32_t a,
+                                               int32_t format,
+                                               int32_t src_w,
+                                               int32_t src_h,
+                                               int32_t dst_w,
+                                               int32_t dst_h);
+void                   lanczos_planFixed2D_delete(lanczos_planFixed2D_t** _self);
+int                    lanczos_planFixed2D_execute(lanczos_planFixed2D_t* self,
+                                                   lanczos_pool_t* pool,
+                                                   int32_t channels,
+                                                   const void* src,
+                                                   void* dst);
+void                   lanczos_planFixed2D_executeTile(lanczos_planFixed2D_t* self,
+                                                       int32_t channels,
+                                                       const void* src,
+                                                       void* dst,
+                                                       int32_t x0,
+                                                       int32_t x1,
+                                                       int32_t y0,
+                                                       int32_t y1,
+                                                       void* ring,
+                                                       const void** rows,
+                                                       void* acc);
+size_t                 lanczos_planFixed2D_workspace(lanczos_planFixed2D_t* self,
+                                                     lanczos_pool_t* pool,
+                                                     int32_t channels);
+
+#endif
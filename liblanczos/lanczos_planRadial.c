@@ -0,0 +1,745 @@
+/*
+ * Copyright (c) 2025 Jeff Boody
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included
+ * in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+
+#include <math.h>
+#include <stdlib.h>
+
+#define LOG_TAG "lanczos"
+#include "../../libcc/cc_log.h"
+#include "../../libcc/cc_memory.h"
+#include "lanczos_kernel.h"
+#include "lanczos_plan1D.h"
+#include "lanczos_planRadial.h"
+#include "lanczos_resample.h"
+
+typedef struct
+{
+	lanczos_planRadial_t* self;
+	int32_t               nch;
+	const float*          src;
+	float*                dst;
+	int32_t               band_h;
+	float*                scratch;
+} lanczos_planRadialTask_t;
+
+/*
+ * private
+ */
+
+static int32_t gcd(int32_t a, int32_t b)
+{
+	int32_t t;
+	while(b)
+	{
+		t = a%b;
+		a = b;
+		b = t;
+	}
+	return a;
+}
+
+static int32_t floorDiv(int64_t n, int64_t d)
+{
+	int64_t q = n/d;
+	if((n%d != 0) && ((n < 0) != (d < 0)))
+	{
+		--q;
+	}
+	return (int32_t) q;
+}
+
+static int32_t
+lanczos_planRadial_first(lanczos_planRadialAxis_t* self,
+                         int32_t j)
+{
+	ASSERT(self);
+
+	return (j/self->phases)*self->step +
+	       self->first[j%self->phases];
+}
+
+static int
+lanczos_planRadial_axis(lanczos_planRadialAxis_t* self,
+                        lanczos_workspace_t* ws,
+                        int32_t a, int32_t src_w,
+                        int32_t dst_w)
+{
+	ASSERT(self);
+
+	// see lanczos_plan1D_new
+	int32_t g = gcd(src_w, dst_w);
+	int32_t p = src_w/g;
+	int32_t q = dst_w/g;
+	if(q > LANCZOS_PLAN1D_MAX_PHASES)
+	{
+		self->phases = dst_w;
+		self->step   = 0;
+	}
+	else
+	{
+		self->phases = q;
+		self->step   = p;
+	}
+
+	double fs = 1.0;
+	if(p > q)
+	{
+		fs = ((double) p)/((double) q);
+	}
+
+	// Filter Scale
+	// the window of each output is computed as in
+	// lanczos_plan1D_window
+	int32_t taps = (int32_t) (2.0*fs*a) + 2;
+	self->first = (int32_t*)
+	              lanczos_workspace_calloc(ws, self->phases,
+	                                       sizeof(int32_t));
+	if(self->first == NULL)
+	{
+		LOGE("CALLOC failed");
+		return 0;
+	}
+
+	self->d2 = (float*)
+	           lanczos_workspace_calloc(ws, self->phases*taps,
+	                                    sizeof(float));
+	if(self->d2 == NULL)
+	{
+		LOGE("CALLOC failed");
+		goto fail_d2;
+	}
+
+	int32_t i;
+	int32_t i0;
+	int32_t i1;
+	int32_t j;
+	int32_t fl;
+	int32_t max_taps = 0;
+	int64_t n;
+	int64_t d = 2*((int64_t) q);
+	double  frac;
+	double  dx;
+	for(j = 0; j < self->phases; ++j)
+	{
+		n    = ((int64_t) 2*j + 1)*p - q;
+		fl   = floorDiv(n, d);
+		frac = ((double) (n - d*fl))/((double) d);
+		i0   = (int32_t) floor(-fs*a + 1.0 + frac);
+		i1   = (int32_t) floor(fs*a + frac);
+
+		self->first[j] = fl + i0;
+		for(i = 0; i < taps; ++i)
+		{
+			if(i0 + i <= i1)
+			{
+				dx = (i0 + i - frac)/fs;
+				self->d2[j*taps + i] = (float) (dx*dx);
+			}
+			else
+			{
+				self->d2[j*taps + i] = (float) (a*a);
+			}
+		}
+
+		if(i1 - i0 + 1 > max_taps)
+		{
+			max_taps = i1 - i0 + 1;
+		}
+	}
+
+	// compact the tap offsets to the maximum window size
+	for(j = 0; j < self->phases; ++j)
+	{
+		for(i = 0; i < max_taps; ++i)
+		{
+			self->d2[j*max_taps + i] = self->d2[j*taps + i];
+		}
+	}
+	self->taps = max_taps;
+
+	// the windows are monotonic so the interior outputs are
+	// a contiguous range
+	self->j0 = 0;
+	while((self->j0 < dst_w) &&
+	      (lanczos_planRadial_first(self, self->j0) < 0))
+	{
+		++self->j0;
+	}
+
+	self->j1 = dst_w;
+	while((self->j1 > self->j0) &&
+	      (lanczos_planRadial_first(self, self->j1 - 1) +
+	       self->taps > src_w))
+	{
+		--self->j1;
+	}
+
+	// success
+	return 1;
+
+	// failure
+	fail_d2:
+		lanczos_workspace_free(ws, self->first);
+	return 0;
+}
+
+static void
+lanczos_planRadial_axisFree(lanczos_planRadialAxis_t* self,
+                            lanczos_workspace_t* ws)
+{
+	ASSERT(self);
+
+	lanczos_workspace_free(ws, self->d2);
+	lanczos_workspace_free(ws, self->first);
+}
+
+static float
+lanczos_planRadial_L(lanczos_planRadial_t* self, float r2)
+{
+	ASSERT(self);
+
+	// linear interpolation of the squared radius table
+	float   f = r2*LANCZOS_PLANRADIAL_LUT_SCALE;
+	int32_t k = (int32_t) f;
+	float   t = f - (float) k;
+	return self->lut[k] + t*(self->lut[k + 1] - self->lut[k]);
+}
+
+static int lanczos_planRadial_lut(lanczos_planRadial_t* self)
+{
+	ASSERT(self);
+
+	// the squared radius is at most 2*a^2 since the padding
+	// taps of each axis are a^2
+	int32_t a = self->a;
+	self->lut_size = 2*a*a*LANCZOS_PLANRADIAL_LUT_SCALE + 2;
+	self->lut      = (float*)
+	                 lanczos_workspace_calloc(self->ws,
+	                                          self->lut_size,
+	                                          sizeof(float));
+	if(self->lut == NULL)
+	{
+		LOGE("CALLOC failed");
+		return 0;
+	}
+
+	int32_t k;
+	double  r2;
+	for(k = 0; k < self->lut_size; ++k)
+	{
+		r2 = ((double) k)/LANCZOS_PLANRADIAL_LUT_SCALE;
+		if(r2 < (double) (a*a))
+		{
+			self->lut[k] = lanczos_kernel_L((float) sqrt(r2),
+			                                (float) a);
+		}
+	}
+
+	return 1;
+}
+
+static void
+lanczos_planRadial_normalize(int32_t n, double sum, float* w)
+{
+	ASSERT(w);
+
+	// Preserving Flux Normalization
+	int32_t k;
+	for(k = 0; k < n; ++k)
+	{
+		w[k] = (float) (w[k]/sum);
+	}
+}
+
+static void
+lanczos_planRadial_evaluate(lanczos_planRadial_t* self,
+                            int32_t phx, int32_t phy,
+                            float* w)
+{
+	ASSERT(self);
+	ASSERT(w);
+
+	lanczos_planRadialAxis_t* x = &self->x;
+	lanczos_planRadialAxis_t* y = &self->y;
+
+	int32_t      i;
+	int32_t      j;
+	float        l;
+	double       sum = 0.0;
+	const float* d2x = &x->d2[phx*x->taps];
+	const float* d2y = &y->d2[phy*y->taps];
+	for(i = 0; i < y->taps; ++i)
+	{
+		for(j = 0; j < x->taps; ++j)
+		{
+			l = lanczos_planRadial_L(self, d2y[i] + d2x[j]);
+			w[i*x->taps + j] = l;
+			sum += l;
+		}
+	}
+	lanczos_planRadial_normalize(x->taps*y->taps, sum, w);
+}
+
+static int lanczos_planRadial_stencils(lanczos_planRadial_t* self)
+{
+	ASSERT(self);
+
+	lanczos_planRadialAxis_t* x = &self->x;
+	lanczos_planRadialAxis_t* y = &self->y;
+
+	// precompute the weights per phase pair when the
+	// resampling factors are rational
+	int64_t n = ((int64_t) x->taps)*y->taps;
+	int64_t size = n*x->phases*y->phases;
+	if((x->step == 0) || (y->step == 0) ||
+	   (size*sizeof(float) > LANCZOS_PLANRADIAL_STENCIL_BYTES))
+	{
+		return 1;
+	}
+
+	self->stencil = (float*)
+	                lanczos_workspace_calloc(self->ws, size,
+	                                         sizeof(float));
+	if(self->stencil == NULL)
+	{
+		LOGE("CALLOC failed");
+		return 0;
+	}
+
+	// the stencils are evaluated from the table such that
+	// the output does not depend on the stencil size
+	int32_t phx;
+	int32_t phy;
+	for(phy = 0; phy < y->phases; ++phy)
+	{
+		for(phx = 0; phx < x->phases; ++phx)
+		{
+			lanczos_planRadial_evaluate(self, phx, phy,
+			                            &self->stencil[(phy*x->phases + phx)*n]);
+		}
+	}
+
+	return 1;
+}
+
+static const float*
+lanczos_planRadial_weights(lanczos_planRadial_t* self,
+                           int32_t phx, int32_t phy,
+                           float* w)
+{
+	ASSERT(self);
+	ASSERT(w);
+
+	lanczos_planRadialAxis_t* x = &self->x;
+	lanczos_planRadialAxis_t* y = &self->y;
+
+	if(self->stencil)
+	{
+		return &self->stencil[(phy*x->phases + phx)*x->taps*y->taps];
+	}
+
+	lanczos_planRadial_evaluate(self, phx, phy, w);
+	return w;
+}
+
+// The interior kernels are specialized for the channel count
+// NCH as in lanczos_plan1D and resample the outputs [xa, xb)
+// of a row whose windows are known to be in range.
+#define LANCZOS_PLANRADIAL_KERNEL(SUFFIX, NCH)                  \
+static void                                                     \
+lanczos_planRadial_interior##SUFFIX(lanczos_planRadial_t* self, \
+                                    int32_t nch,                \
+                                    const float* s1,            \
+                                    float* s2,                  \
+                                    int32_t phy, int32_t fy,    \
+                                    int32_t xa, int32_t xb,     \
+                                    float* scratch)             \
+{                                                               \
+	ASSERT(self);                                               \
+	                                                            \
+	lanczos_planRadialAxis_t* x = &self->x;                     \
+	                                                            \
+	int32_t      ch;                                            \
+	int32_t      i;                                             \
+	int32_t      j;                                             \
+	int32_t      k;                                             \
+	int32_t      tx     = x->taps;                              \
+	int32_t      ty     = self->y.taps;                         \
+	size_t       stride = ((size_t) self->src_w)*NCH;           \
+	int32_t      phx    = xa%x->phases;                         \
+	int32_t      base   = (xa/x->phases)*x->step;               \
+	float        sum[NCH];                                      \
+	const float* w;                                             \
+	const float* src;                                           \
+	for(k = xa; k < xb; ++k)                                    \
+	{                                                           \
+		for(ch = 0; ch < NCH; ++ch)                             \
+		{                                                       \
+			sum[ch] = 0.0f;                                     \
+		}                                                       \
+		                                                        \
+		w   = lanczos_planRadial_weights(self, phx, phy,        \
+		                                 scratch);              \
+		src = &s1[fy*stride + NCH*(base + x->first[phx])];      \
+		for(i = 0; i < ty; ++i)                                 \
+		{                                                       \
+			for(j = 0; j < tx; ++j)                             \
+			{                                                   \
+				for(ch = 0; ch < NCH; ++ch)                     \
+				{                                               \
+					sum[ch] += src[NCH*j + ch]*w[j];            \
+				}                                               \
+			}                                                   \
+			src += stride;                                      \
+			w   += tx;                                          \
+		}                                                       \
+		                                                        \
+		for(ch = 0; ch < NCH; ++ch)                             \
+		{                                                       \
+			s2[NCH*k + ch] = sum[ch];                           \
+		}                                                       \
+		                                                        \
+		++phx;                                                  \
+		if(phx == x->phases)                                    \
+		{                                                       \
+			phx   = 0;                                          \
+			base += x->step;                                    \
+		}                                                       \
+	}                                                           \
+}
+
+LANCZOS_PLANRADIAL_KERNEL(1, 1)
+LANCZOS_PLANRADIAL_KERNEL(2, 2)
+LANCZOS_PLANRADIAL_KERNEL(3, 3)
+LANCZOS_PLANRADIAL_KERNEL(4, 4)
+LANCZOS_PLANRADIAL_KERNEL(N, nch)
+
+static void
+lanczos_planRadial_interior(lanczos_planRadial_t* self,
+                            int32_t nch, const float* s1,
+                            float* s2, int32_t phy, int32_t fy,
+                            int32_t xa, int32_t xb,
+                            float* scratch)
+{
+	ASSERT(self);
+
+	switch(nch)
+	{
+		case 1:
+			lanczos_planRadial_interior1(self, 1, s1, s2, phy, fy,
+			                             xa, xb, scratch);
+			break;
+		case 2:
+			lanczos_planRadial_interior2(self, 2, s1, s2, phy, fy,
+			                             xa, xb, scratch);
+			break;
+		case 3:
+			lanczos_planRadial_interior3(self, 3, s1, s2, phy, fy,
+			                             xa, xb, scratch);
+			break;
+		case 4:
+			lanczos_planRadial_interior4(self, 4, s1, s2, phy, fy,
+			                             xa, xb, scratch);
+			break;
+		default:
+			lanczos_planRadial_interiorN(self, nch, s1, s2, phy, fy,
+			                             xa, xb, scratch);
+	}
+}
+
+static void
+lanczos_planRadial_edge(lanczos_planRadial_t* self,
+                        int32_t nch, const float* s1,
+                        float* s2, int32_t phy, int32_t fy,
+                        int32_t xa, int32_t xb, float* scratch)
+{
+	ASSERT(self);
+
+	lanczos_planRadialAxis_t* x = &self->x;
+
+	// zero padding drops the out-of-range taps while
+	// clamping repeats the edge samples
+	int zero = self->flags & LANCZOS_FLAG_EDGE_ZERO_PADDING;
+
+	int32_t      ch;
+	int32_t      i;
+	int32_t      j;
+	int32_t      k;
+	int32_t      fx;
+	int32_t      sx;
+	int32_t      sy;
+	int32_t      tx = x->taps;
+	int32_t      ty = self->y.taps;
+	const float* w;
+	const float* src;
+	for(k = xa; k < xb; ++k)
+	{
+		for(ch = 0; ch < nch; ++ch)
+		{
+			s2[nch*k + ch] = 0.0f;
+		}
+
+		w  = lanczos_planRadial_weights(self, k%x->phases, phy,
+		                                scratch);
+		fx = lanczos_planRadial_first(x, k);
+		for(i = 0; i < ty; ++i)
+		{
+			sy = fy + i;
+			if((sy < 0) || (sy >= self->src_h))
+			{
+				if(zero)
+				{
+					continue;
+				}
+				sy = (sy < 0) ? 0 : self->src_h - 1;
+			}
+
+			for(j = 0; j < tx; ++j)
+			{
+				sx = fx + j;
+				if((sx < 0) || (sx >= self->src_w))
+				{
+					if(zero)
+					{
+						continue;
+					}
+					sx = (sx < 0) ? 0 : self->src_w - 1;
+				}
+
+				src = &s1[nch*(((size_t) sy)*self->src_w + sx)];
+				for(ch = 0; ch < nch; ++ch)
+				{
+					s2[nch*k + ch] += src[ch]*w[i*tx + j];
+				}
+			}
+		}
+	}
+}
+
+static void
+lanczos_planRadial_executeRow(lanczos_planRadial_t* self,
+                              int32_t nch, const float* src,
+                              float* dst, int32_t y,
+                              float* scratch)
+{
+	ASSERT(self);
+
+	lanczos_planRadialAxis_t* ay = &self->y;
+
+	int32_t phy = y%ay->phases;
+	int32_t fy  = lanczos_planRadial_first(ay, y);
+	int32_t x0  = self->x.j0;
+	int32_t x1  = self->x.j1;
+
+	// row offsets are size_t (e.g. 30000x20000 RGBA images
+	// have more than 2^31 samples)
+	float* s2 = &dst[((size_t) y)*self->dst_w*nch];
+
+	if((y < ay->j0) || (y >= ay->j1))
+	{
+		lanczos_planRadial_edge(self, nch, src, s2, phy, fy,
+		                        0, self->dst_w, scratch);
+		return;
+	}
+
+	lanczos_planRadial_edge(self, nch, src, s2, phy, fy,
+	                        0, x0, scratch);
+	lanczos_planRadial_interior(self, nch, src, s2, phy, fy,
+	                            x0, x1, scratch);
+	lanczos_planRadial_edge(self, nch, src, s2, phy, fy,
+	                        x1, self->dst_w, scratch);
+}
+
+static void
+lanczos_planRadial_task(void* arg, int32_t task, int32_t thread)
+{
+	ASSERT(arg);
+
+	lanczos_planRadialTask_t* t    = (lanczos_planRadialTask_t*) arg;
+	lanczos_planRadial_t*     self = t->self;
+
+	int32_t y;
+	int32_t y0 = task*t->band_h;
+	int32_t y1 = y0 + t->band_h;
+	if(y1 > self->dst_h)
+	{
+		y1 = self->dst_h;
+	}
+
+	float* scratch = &t->scratch[thread*self->x.taps*self->y.taps];
+	for(y = y0; y < y1; ++y)
+	{
+		lanczos_planRadial_executeRow(self, t->nch, t->src,
+		                              t->dst, y, scratch);
+	}
+}
+
+/*
+ * public
+ */
+
+lanczos_planRadial_t*
+lanczos_planRadial_new(lanczos_workspace_t* ws,
+                       uint32_t flags, int32_t a,
+                       int32_t src_w, int32_t src_h,
+                       int32_t dst_w, int32_t dst_h)
+{
+	if((a <= 0) || (src_w <= 0) || (src_h <= 0) ||
+	   (dst_w <= 0) || (dst_h <= 0))
+	{
+		LOGE("invalid a=%i, src=%ix%i, dst=%ix%i",
+		     a, src_w, src_h, dst_w, dst_h);
+		return NULL;
+	}
+
+	lanczos_planRadial_t* self;
+	self = (lanczos_planRadial_t*)
+	       lanczos_workspace_calloc(ws, 1,
+	                                sizeof(lanczos_planRadial_t));
+	if(self == NULL)
+	{
+		LOGE("CALLOC failed");
+		return NULL;
+	}
+
+	self->ws    = ws;
+	self->flags = flags;
+	self->a     = a;
+	self->src_w = src_w;
+	self->src_h = src_h;
+	self->dst_w = dst_w;
+	self->dst_h = dst_h;
+
+	if(lanczos_planRadial_axis(&self->x, ws, a,
+	                           src_w, dst_w) == 0)
+	{
+		goto fail_x;
+	}
+
+	if(lanczos_planRadial_axis(&self->y, ws, a,
+	                           src_h, dst_h) == 0)
+	{
+		goto fail_y;
+	}
+
+	if(lanczos_planRadial_lut(self) == 0)
+	{
+		goto fail_lut;
+	}
+
+	if(lanczos_planRadial_stencils(self) == 0)
+	{
+		goto fail_stencil;
+	}
+
+	// success
+	return self;
+
+	// failure
+	fail_stencil:
+		lanczos_workspace_free(ws, self->lut);
+	fail_lut:
+		lanczos_planRadial_axisFree(&self->y, ws);
+	fail_y:
+		lanczos_planRadial_axisFree(&self->x, ws);
+	fail_x:
+		lanczos_workspace_free(ws, self);
+	return NULL;
+}
+
+void lanczos_planRadial_delete(lanczos_planRadial_t** _self)
+{
+	ASSERT(_self);
+
+	lanczos_planRadial_t* self = *_self;
+	if(self)
+	{
+		lanczos_workspace_t* ws = self->ws;
+		lanczos_workspace_free(ws, self->stencil);
+		lanczos_workspace_free(ws, self->lut);
+		lanczos_planRadial_axisFree(&self->y, ws);
+		lanczos_planRadial_axisFree(&self->x, ws);
+		lanczos_workspace_free(ws, self);
+		*_self = NULL;
+	}
+}
+
+int lanczos_planRadial_execute(lanczos_planRadial_t* self,
+                               lanczos_pool_t* pool,
+                               int32_t channels,
+                               const float* src, float* dst)
+{
+	ASSERT(self);
+	ASSERT(src);
+	ASSERT(dst);
+
+	// partition the output rows into bands such that there
+	// are enough tasks to balance the threads
+	int32_t threads = lanczos_pool_threads(pool);
+	int32_t band_h  = self->dst_h;
+	if(threads > 1)
+	{
+		band_h = (self->dst_h + 4*threads - 1)/(4*threads);
+	}
+	int32_t bands = (self->dst_h + band_h - 1)/band_h;
+
+	// per-thread weights
+	float* scratch = (float*)
+	                 lanczos_workspace_calloc(self->ws,
+	                                          threads*self->x.taps*
+	                                          self->y.taps,
+	                                          sizeof(float));
+	if(scratch == NULL)
+	{
+		LOGE("CALLOC failed");
+		return 0;
+	}
+
+	lanczos_planRadialTask_t task =
+	{
+		.self    = self,
+		.nch     = channels,
+		.src     = src,
+		.dst     = dst,
+		.band_h  = band_h,
+		.scratch = scratch,
+	};
+
+	lanczos_pool_run(pool, bands, lanczos_planRadial_task, &task);
+
+	lanczos_workspace_free(self->ws, scratch);
+
+	return 1;
+}
+
+size_t lanczos_planRadial_workspace(lanczos_planRadial_t* self,
+                                    lanczos_pool_t* pool)
+{
+	ASSERT(self);
+
+	// see lanczos_planRadial_execute
+	int32_t threads = lanczos_pool_threads(pool);
+	return lanczos_workspace_bytes(threads*self->x.taps*
+	                               self->y.taps,
+	                               sizeof(float));
+}
@@ -0,0 +1,105 @@
+/*
+ * Copyright (c) 2025 Jeff Boody
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included
+ * in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+
+#ifndef lanczos_planRadial_H
+#define lanczos_planRadial_H
+
+#include <stdint.h>
+
+#include "lanczos_pool.h"
+#include "lanczos_workspace.h"
+
+// radial kernel table entries per unit of squared radius
+// the maximum absolute error of the linear interpolation is
+// less than 5e-7 for a in [2, 16] (1.1e-6 for a = 1)
+#define LANCZOS_PLANRADIAL_LUT_SCALE 1024
+
+// maximum size of the precomputed stencils
+#define LANCZOS_PLANRADIAL_STENCIL_BYTES 4194304
+
+// The source window of each output along one axis where
+// first(j) = (j/phases)*step + first[j%phases]. The squared
+// (scaled) tap offsets are padded to taps with a^2 such
+// that the padding taps have zero weight. Outputs in the
+// interior range [j0, j1) reference taps in range.
+typedef struct
+{
+	int32_t  phases;
+	int32_t  step;
+	int32_t  taps;
+	int32_t* first; // n=phases
+	float*   d2;    // n=phases*taps
+	int32_t  j0;
+	int32_t  j1;
+} lanczos_planRadialAxis_t;
+
+// An isotropic 2D plan evaluates the non-separable kernel
+// L(r) = sinc(r)*sinc(r/a) where r^2 = dx^2 + dy^2. The
+// kernel is tabulated by squared radius such that no sqrt or
+// trig functions are evaluated per tap. When both axes have
+// a rational resampling factor the normalized 2D weights are
+// precomputed per phase pair (stencils), otherwise they are
+// evaluated per output. Both are evaluated from the table
+// such that the output does not depend on whether the
+// stencils fit in LANCZOS_PLANRADIAL_STENCIL_BYTES.
+typedef struct
+{
+	// optional workspace
+	lanczos_workspace_t* ws;
+
+	uint32_t flags;
+	int32_t  a;
+	int32_t  src_w;
+	int32_t  src_h;
+	int32_t  dst_w;
+	int32_t  dst_h;
+
+	lanczos_planRadialAxis_t x;
+	lanczos_planRadialAxis_t y;
+
+	// L(sqrt(r2)) at r2 = k/LANCZOS_PLANRADIAL_LUT_SCALE
+	// for r2 in [0, 2*a^2]
+	int32_t lut_size;
+	float*  lut;
+
+	// optional stencils (y.phases*x.phases*y.taps*x.taps)
+	float* stencil;
+} lanczos_planRadial_t;
+
+lanczos_planRadial_t* lanczos_planRadial_new(lanczos_workspace_t* ws,
+                                             uint32_t flags,
+                                             int32_t a,
+                                             int32_t src_w,
+                                             int32_t src_h,
+                                             int32_t dst_w,
+                                             int32_t dst_h);
+void                  lanczos_planRadial_delete(lanczos_planRadial_t** _self);
+int                   lanczos_planRadial_execute(lanczos_planRadial_t* self,
+                                                 lanczos_pool_t* pool,
+                                                 int32_t channels,
+                                                 const float* src,
+                                                 float* dst);
+size_t                lanczos_planRadial_workspace(lanczos_planRadial_t* self,
+                                                   lanczos_pool_t* pool);
+
+#endif
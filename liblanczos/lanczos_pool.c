@@ -0,0 +1,286 @@
+/*
+ * Copyright (c) 2025 Jeff Boody
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included
+ * in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+
+#include <stdlib.h>
+
+#define LOG_TAG "lanczos"
+#include "../../libcc/cc_log.h"
+#include "../../libcc/cc_memory.h"
+#include "lanczos_pool.h"
+
+typedef struct
+{
+	lanczos_pool_t* pool;
+	int32_t         thread;
+} lanczos_poolThread_t;
+
+/*
+ * private
+ */
+
+static void
+lanczos_pool_work(lanczos_pool_t* self, int32_t thread)
+{
+	ASSERT(self);
+
+	// called with the mutex locked
+	int32_t task;
+	while(self->task_next < self->task_count)
+	{
+		task = self->task_next++;
+
+		pthread_mutex_unlock(&self->mutex);
+		self->fn(self->arg, task, thread);
+		pthread_mutex_lock(&self->mutex);
+
+		++self->task_done;
+		if(self->task_done == self->task_count)
+		{
+			pthread_cond_broadcast(&self->cond_done);
+		}
+	}
+}
+
+static void* lanczos_pool_thread(void* arg)
+{
+	ASSERT(arg);
+
+	lanczos_poolThread_t* pt   = (lanczos_poolThread_t*) arg;
+	lanczos_pool_t*       self = pt->pool;
+	int32_t               idx  = pt->thread;
+	FREE(pt);
+
+	pthread_mutex_lock(&self->mutex);
+
+	uint64_t generation = self->generation;
+	while(1)
+	{
+		while((self->shutdown == 0) &&
+		      (self->generation == generation))
+		{
+			pthread_cond_wait(&self->cond_work, &self->mutex);
+		}
+
+		if(self->shutdown)
+		{
+			break;
+		}
+
+		generation = self->generation;
+		lanczos_pool_work(self, idx);
+	}
+
+	pthread_mutex_unlock(&self->mutex);
+
+	return NULL;
+}
+
+static void lanczos_pool_stop(lanczos_pool_t* self,
+                              int32_t count)
+{
+	ASSERT(self);
+
+	pthread_mutex_lock(&self->mutex);
+	self->shutdown = 1;
+	pthread_cond_broadcast(&self->cond_work);
+	pthread_mutex_unlock(&self->mutex);
+
+	int32_t i;
+	for(i = 0; i < count; ++i)
+	{
+		pthread_join(self->threads[i], NULL);
+	}
+}
+
+/*
+ * public
+ */
+
+lanczos_pool_t* lanczos_pool_new(int32_t thread_count)
+{
+	if(thread_count < 0)
+	{
+		LOGE("invalid thread_count=%i", thread_count);
+		return NULL;
+	}
+
+	lanczos_pool_t* self;
+	self = (lanczos_pool_t*) CALLOC(1, sizeof(lanczos_pool_t));
+	if(self == NULL)
+	{
+		LOGE("CALLOC failed");
+		return NULL;
+	}
+
+	if(thread_count)
+	{
+		self->threads = (pthread_t*)
+		                CALLOC(thread_count, sizeof(pthread_t));
+		if(self->threads == NULL)
+		{
+			LOGE("CALLOC failed");
+			goto fail_threads;
+		}
+	}
+
+	if(pthread_mutex_init(&self->run_mutex, NULL) != 0)
+	{
+		LOGE("pthread_mutex_init failed");
+		goto fail_run_mutex;
+	}
+
+	if(pthread_mutex_init(&self->mutex, NULL) != 0)
+	{
+		LOGE("pthread_mutex_init failed");
+		goto fail_mutex;
+	}
+
+	if(pthread_cond_init(&self->cond_work, NULL) != 0)
+	{
+		LOGE("pthread_cond_init failed");
+		goto fail_cond_work;
+	}
+
+	if(pthread_cond_init(&self->cond_done, NULL) != 0)
+	{
+		LOGE("pthread_cond_init failed");
+		goto fail_cond_done;
+	}
+
+	int32_t               i;
+	lanczos_poolThread_t* pt;
+	for(i = 0; i < thread_count; ++i)
+	{
+		pt = (lanczos_poolThread_t*)
+		     CALLOC(1, sizeof(lanczos_poolThread_t));
+		if(pt == NULL)
+		{
+			LOGE("CALLOC failed");
+			goto fail_create;
+		}
+
+		pt->pool   = self;
+		pt->thread = i;
+		if(pthread_create(&self->threads[i], NULL,
+		                  lanczos_pool_thread, pt) != 0)
+		{
+			LOGE("pthread_create failed");
+			FREE(pt);
+			goto fail_create;
+		}
+	}
+
+	self->thread_count = thread_count;
+
+	// success
+	return self;
+
+	// failure
+	fail_create:
+		lanczos_pool_stop(self, i);
+		pthread_cond_destroy(&self->cond_done);
+	fail_cond_done:
+		pthread_cond_destroy(&self->cond_work);
+	fail_cond_work:
+		pthread_mutex_destroy(&self->mutex);
+	fail_mutex:
+		pthread_mutex_destroy(&self->run_mutex);
+	fail_run_mutex:
+		FREE(self->threads);
+	fail_threads:
+		FREE(self);
+	return NULL;
+}
+
+void lanczos_pool_delete(lanczos_pool_t** _self)
+{
+	ASSERT(_self);
+
+	lanczos_pool_t* self = *_self;
+	if(self)
+	{
+		lanczos_pool_stop(self, self->thread_count);
+		pthread_cond_destroy(&self->cond_done);
+		pthread_cond_destroy(&self->cond_work);
+		pthread_mutex_destroy(&self->mutex);
+		pthread_mutex_destroy(&self->run_mutex);
+		FREE(self->threads);
+		FREE(self);
+		*_self = NULL;
+	}
+}
+
+int32_t lanczos_pool_threads(lanczos_pool_t* self)
+{
+	// the calling thread is included
+	if(self == NULL)
+	{
+		return 1;
+	}
+
+	return self->thread_count + 1;
+}
+
+void lanczos_pool_run(lanczos_pool_t* self,
+                      int32_t task_count,
+                      lanczos_pool_fn fn, void* arg)
+{
+	ASSERT(fn);
+
+	// execute the tasks on the calling thread when no
+	// pool is provided
+	int32_t task;
+	if((self == NULL) || (self->thread_count == 0))
+	{
+		for(task = 0; task < task_count; ++task)
+		{
+			fn(arg, task, 0);
+		}
+		return;
+	}
+
+	pthread_mutex_lock(&self->run_mutex);
+	pthread_mutex_lock(&self->mutex);
+
+	self->fn         = fn;
+	self->arg        = arg;
+	self->task_count = task_count;
+	self->task_next  = 0;
+	self->task_done  = 0;
+	++self->generation;
+	pthread_cond_broadcast(&self->cond_work);
+
+	// the calling thread uses the last thread index
+	lanczos_pool_work(self, self->thread_count);
+
+	while(self->task_done < self->task_count)
+	{
+		pthread_cond_wait(&self->cond_done, &self->mutex);
+	}
+
+	self->fn  = NULL;
+	self->arg = NULL;
+
+	pthread_mutex_unlock(&self->mutex);
+	pthread_mutex_unlock(&self->run_mutex);
+}
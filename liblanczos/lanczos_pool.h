@@ -0,0 +1,70 @@
+/*
+ * Copyright (c) 2025 Jeff Boody
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included
+ * in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+
+#ifndef lanczos_pool_H
+#define lanczos_pool_H
+
+#include <pthread.h>
+#include <stdint.h>
+
+// task callback
+// thread is the index of the thread executing the task in
+// the range [0, lanczos_pool_threads()) which may be used to
+// select per-thread scratch memory
+typedef void (*lanczos_pool_fn)(void* arg, int32_t task,
+                                int32_t thread);
+
+// A persistent thread pool such that the thread startup
+// cost is not paid for each resampling call. The calling
+// thread also executes tasks so a pool with thread_count
+// workers runs thread_count + 1 tasks concurrently.
+typedef struct
+{
+	int32_t    thread_count;
+	pthread_t* threads;
+
+	// serializes concurrent calls to lanczos_pool_run
+	pthread_mutex_t run_mutex;
+
+	// current job
+	pthread_mutex_t mutex;
+	pthread_cond_t  cond_work;
+	pthread_cond_t  cond_done;
+	int             shutdown;
+	uint64_t        generation;
+	lanczos_pool_fn fn;
+	void*           arg;
+	int32_t         task_count;
+	int32_t         task_next;
+	int32_t         task_done;
+} lanczos_pool_t;
+
+lanczos_pool_t* lanczos_pool_new(int32_t thread_count);
+void            lanczos_pool_delete(lanczos_pool_t** _self);
+int32_t         lanczos_pool_threads(lanczos_pool_t* self);
+void            lanczos_pool_run(lanczos_pool_t* self,
+                                 int32_t task_count,
+                                 lanczos_pool_fn fn,
+                                 void* arg);
+
+#endif
@@ -0,0 +1,345 @@
+/*
+ * Copyright (c) 2025 Jeff Boody
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included
+ * in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+#include <stdlib.h>
+
+#define LOG_TAG "lanczos"
+#include "../../libcc/cc_log.h"
+#include "../../libcc/cc_memory.h"
+#include "lanczos_pyramid2D.h"
+#include "lanczos_resample.h"
+
+typedef struct
+{
+	lanczos_pyramid2D_t* self;
+	const float*         src;
+	float**              dst;
+	int32_t              ring_size; // per thread
+	int32_t              rows_size; // per thread
+	float*               ring;
+	const float**        ring_rows;
+} lanczos_pyramid2DTask_t;
+
+/*
+ * private
+ */
+
+static void
+lanczos_pyramid2D_task(void* arg, int32_t task, int32_t thread)
+{
+	ASSERT(arg);
+
+	lanczos_pyramid2DTask_t* t    = (lanczos_pyramid2DTask_t*) arg;
+	lanczos_pyramid2D_t*     self = t->self;
+
+	// find the level of the task
+	int32_t l = self->level_count - 1;
+	while(self->levels[l].task0 > task)
+	{
+		--l;
+	}
+
+	lanczos_pyramid2DLevel_t* level = &self->levels[l];
+
+	int32_t band = task - level->task0;
+	int32_t x0   = (band%level->bands_x)*level->band_w;
+	int32_t y0   = (band/level->bands_x)*level->band_h;
+	int32_t x1   = x0 + level->band_w;
+	int32_t y1   = y0 + level->band_h;
+	if(x1 > level->w)
+	{
+		x1 = level->w;
+	}
+	if(y1 > level->h)
+	{
+		y1 = level->h;
+	}
+
+	lanczos_plan2D_executeTile(level->plan, self->channels,
+	                           t->src, t->dst[l],
+	                           x0, x1, y0, y1,
+	                           &t->ring[thread*t->ring_size],
+	                           &t->ring_rows[thread*t->rows_size]);
+}
+
+/*
+ * public
+ */
+
+lanczos_pyramid2D_t*
+lanczos_pyramid2D_new(lanczos_planCache_t* cache,
+                      uint32_t flags, int32_t a,
+                      int32_t channels,
+                      int32_t src_w, int32_t src_h,
+                      int32_t levels)
+{
+	if((channels <= 0) || (src_w <= 0) || (src_h <= 0) ||
+	   (levels < 0) || (levels > LANCZOS_PYRAMID2D_MAX_LEVELS) ||
+	   (flags & LANCZOS_FLAG_MULTIDIM_2D_ISOTROPIC))
+	{
+		LOGE("invalid channels=%i, src=%ix%i, levels=%i, flags=0x%X",
+		     channels, src_w, src_h, levels, flags);
+		return NULL;
+	}
+
+	// the full pyramid ends at 1x1
+	if(levels == 0)
+	{
+		while(((src_w >> levels) > 1) || ((src_h >> levels) > 1))
+		{
+			++levels;
+		}
+
+		if(levels == 0)
+		{
+			LOGE("invalid src=%ix%i", src_w, src_h);
+			return NULL;
+		}
+	}
+
+	lanczos_pyramid2D_t* self;
+	self = (lanczos_pyramid2D_t*)
+	       CALLOC(1, sizeof(lanczos_pyramid2D_t));
+	if(self == NULL)
+	{
+		LOGE("CALLOC failed");
+		return NULL;
+	}
+
+	self->flags    = flags;
+	self->channels = channels;
+	self->src_w    = src_w;
+	self->src_h    = src_h;
+	self->cache    = cache;
+
+	self->levels = (lanczos_pyramid2DLevel_t*)
+	               CALLOC(levels, sizeof(lanczos_pyramid2DLevel_t));
+	if(self->levels == NULL)
+	{
+		LOGE("CALLOC failed");
+		goto fail_levels;
+	}
+
+	int32_t                   l;
+	lanczos_pyramid2DLevel_t* level;
+	for(l = 0; l < levels; ++l)
+	{
+		level         = &self->levels[l];
+		level->w      = src_w >> (l + 1);
+		level->h      = src_h >> (l + 1);
+		level->w      = (level->w < 1) ? 1 : level->w;
+		level->h      = (level->h < 1) ? 1 : level->h;
+		level->offset = self->size;
+		self->size   += ((size_t) level->w)*level->h*channels;
+
+		level->plan = lanczos_plan2D_new(cache, NULL, flags, a,
+		                                 src_w, src_h,
+		                                 level->w, level->h);
+		if(level->plan == NULL)
+		{
+			goto fail_plan;
+		}
+		++self->level_count;
+
+		level->band_w = lanczos_plan2D_bandWidth(level->plan,
+		                                         channels);
+	}
+
+	// success
+	return self;
+
+	// failure
+	fail_plan:
+	{
+		for(l = 0; l < self->level_count; ++l)
+		{
+			lanczos_plan2D_delete(&self->levels[l].plan);
+		}
+		FREE(self->levels);
+	}
+	fail_levels:
+		FREE(self);
+	return NULL;
+}
+
+void lanczos_pyramid2D_delete(lanczos_pyramid2D_t** _self)
+{
+	ASSERT(_self);
+
+	lanczos_pyramid2D_t* self = *_self;
+	if(self)
+	{
+		int32_t l;
+		for(l = 0; l < self->level_count; ++l)
+		{
+			lanczos_plan2D_delete(&self->levels[l].plan);
+		}
+		FREE(self->buffer);
+		FREE(self->levels);
+		FREE(self);
+		*_self = NULL;
+	}
+}
+
+int lanczos_pyramid2D_execute(lanczos_pyramid2D_t* self,
+                              lanczos_pool_t* pool,
+                              const float* src, float** dst)
+{
+	ASSERT(self);
+	ASSERT(src);
+
+	int32_t nch     = self->channels;
+	int32_t threads = lanczos_pool_threads(pool);
+
+	// output buffers
+	int32_t l;
+	float*  buffers[LANCZOS_PYRAMID2D_MAX_LEVELS];
+	if(dst == NULL)
+	{
+		if(self->buffer == NULL)
+		{
+			self->buffer = (float*)
+			               CALLOC(self->size, sizeof(float));
+			if(self->buffer == NULL)
+			{
+				LOGE("CALLOC failed");
+				return 0;
+			}
+		}
+
+		for(l = 0; l < self->level_count; ++l)
+		{
+			buffers[l] = &self->buffer[self->levels[l].offset];
+		}
+		dst = buffers;
+	}
+
+	// partition each level into bands as in
+	// lanczos_plan2D_execute where the tasks of the largest
+	// levels are scheduled first and the per-thread ring
+	// buffers are sized for the largest ring of the levels
+	int32_t                   rows;
+	int32_t                   bands_y;
+	int32_t                   ring_size = 0;
+	int32_t                   rows_size = 0;
+	lanczos_pyramid2DLevel_t* level;
+	self->task_count = 0;
+	for(l = 0; l < self->level_count; ++l)
+	{
+		level          = &self->levels[l];
+		rows           = level->plan->plany->taps;
+		level->bands_x = (level->w + level->band_w - 1)/
+		                 level->band_w;
+		level->band_h  = level->h;
+		bands_y        = 1;
+		if(threads > 1)
+		{
+			bands_y       = (4*threads + level->bands_x - 1)/
+			                level->bands_x;
+			level->band_h = (level->h + bands_y - 1)/bands_y;
+			if(level->band_h < LANCZOS_PLAN2D_BAND_ROWS)
+			{
+				level->band_h = LANCZOS_PLAN2D_BAND_ROWS;
+			}
+			bands_y = (level->h + level->band_h - 1)/level->band_h;
+		}
+
+		level->task0      = self->task_count;
+		self->task_count += level->bands_x*bands_y;
+
+		if(rows*level->band_w*nch > ring_size)
+		{
+			ring_size = rows*level->band_w*nch;
+		}
+		if(rows > rows_size)
+		{
+			rows_size = rows;
+		}
+	}
+
+	float* ring = (float*)
+	              CALLOC(threads*ring_size, sizeof(float));
+	if(ring == NULL)
+	{
+		LOGE("CALLOC failed");
+		return 0;
+	}
+
+	const float** ring_rows = (const float**)
+	                          CALLOC(threads*rows_size,
+	                                 sizeof(float*));
+	if(ring_rows == NULL)
+	{
+		LOGE("CALLOC failed");
+		goto fail_ring_rows;
+	}
+
+	lanczos_pyramid2DTask_t task =
+	{
+		.self      = self,
+		.src       = src,
+		.dst       = dst,
+		.ring_size = ring_size,
+		.rows_size = rows_size,
+		.ring      = ring,
+		.ring_rows = ring_rows,
+	};
+
+	lanczos_pool_run(pool, self->task_count,
+	                 lanczos_pyramid2D_task, &task);
+
+	FREE(ring_rows);
+	FREE(ring);
+
+	// success
+	return 1;
+
+	// failure
+	fail_ring_rows:
+		FREE(ring);
+	return 0;
+}
+
+float* lanczos_pyramid2D_level(lanczos_pyramid2D_t* self,
+                               int32_t level,
+                               int32_t* _w, int32_t* _h)
+{
+	ASSERT(self);
+	ASSERT((level >= 1) && (level <= self->level_count));
+
+	lanczos_pyramid2DLevel_t* l = &self->levels[level - 1];
+	if(_w)
+	{
+		*_w = l->w;
+	}
+	if(_h)
+	{
+		*_h = l->h;
+	}
+
+	if(self->buffer == NULL)
+	{
+		return NULL;
+	}
+
+	return &self->buffer[l->offset];
+}
@@ -0,0 +1,111 @@
+/*
+ * Copyright (c) 2025 Jeff Boody
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included
+ * in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+#ifndef lanczos_pyramid2D_H
+#define lanczos_pyramid2D_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "lanczos_plan2D.h"
+#include "lanczos_planCache.h"
+#include "lanczos_pool.h"
+
+// maximum number of levels
+#define LANCZOS_PYRAMID2D_MAX_LEVELS 32
+
+typedef struct
+{
+	int32_t           w;
+	int32_t           h;
+	size_t            offset; // samples (contiguous buffer)
+	lanczos_plan2D_t* plan;
+
+	// column and row bands
+	int32_t band_w;
+	int32_t band_h;
+	int32_t bands_x;
+	int32_t task0; // first task of the level
+} lanczos_pyramid2DLevel_t;
+
+// A mipmap pyramid generator where every level l is
+// resampled from the base image (level 0) rather than from
+// level l - 1 such that the resampling errors do not
+// accumulate. The level sizes are (src_w >> l)x(src_h >> l)
+// (at least one) such that the levels of a power-of-two
+// image are exact integer downsamples by D = 2^l which use
+// the single phase (D*2*a coefficients) of the polyphase
+// path. The plans of each level are computed once by new
+// and are shared by the axes of square images (and across
+// pyramids by the optional plan cache). The column and row
+// bands of all levels are scheduled as a single job such
+// that the levels and bands run in parallel on the thread
+// pool.
+//
+// The outputs are written to caller-provided buffers (dst
+// n=levels) or when dst is NULL to one contiguous buffer
+// which is allocated by the first execute and owned by the
+// pyramid (see level). The bands are partitioned by
+// execute per the thread count of the pool such that a
+// pyramid may not be executed concurrently.
+typedef struct
+{
+	uint32_t flags;
+	int32_t  channels;
+	int32_t  src_w;
+	int32_t  src_h;
+
+	// levels [1, level_count]
+	int32_t                   level_count;
+	lanczos_pyramid2DLevel_t* levels; // n=level_count
+	int32_t                   task_count;
+
+	// optional plan cache
+	lanczos_planCache_t* cache;
+
+	// contiguous buffer of the levels
+	size_t size;
+	float* buffer;
+} lanczos_pyramid2D_t;
+
+// levels is the number of levels below the base or zero
+// for the full pyramid down to 1x1
+// level returns the contiguous buffer of the level (or
+// NULL) and its size
+lanczos_pyramid2D_t* lanczos_pyramid2D_new(lanczos_planCache_t* cache,
+                                           uint32_t flags,
+                                           int32_t a,
+                                           int32_t channels,
+                                           int32_t src_w,
+                                           int32_t src_h,
+                                           int32_t levels);
+void                 lanczos_pyramid2D_delete(lanczos_pyramid2D_t** _self);
+int                  lanczos_pyramid2D_execute(lanczos_pyramid2D_t* self,
+                                               lanczos_pool_t* pool,
+                                               const float* src,
+                                               float** dst);
+float*               lanczos_pyramid2D_level(lanczos_pyramid2D_t* self,
+                                             int32_t level,
+                                             int32_t* _w,
+                                             int32_t* _h);
+
+#endif
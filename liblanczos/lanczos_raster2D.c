@@ -0,0 +1,461 @@
+/*
+ * Copyright (c) 2025 Jeff Boody
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included
+ * in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+
+#include <fcntl.h>
+#include <stdlib.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#define LOG_TAG "lanczos"
+#include "../../libcc/cc_log.h"
+#include "../../libcc/cc_memory.h"
+#include "../../libcc/cc_timestamp.h"
+#include "lanczos_raster2D.h"
+
+typedef struct
+{
+	lanczos_raster2D_t* self;
+	int32_t             band;
+} lanczos_raster2DTask_t;
+
+/*
+ * private
+ */
+
+static int
+lanczos_raster2D_align(size_t size, size_t* _offset,
+                       size_t* _length)
+{
+	ASSERT(_offset);
+	ASSERT(_length);
+
+	// align the range to the pages since madvise and msync
+	// require a page aligned address
+	size_t page   = (size_t) sysconf(_SC_PAGESIZE);
+	size_t offset = *_offset;
+	size_t end    = offset + *_length;
+	if(end > size)
+	{
+		end = size;
+	}
+	offset = (offset/page)*page;
+	if(offset >= end)
+	{
+		return 0;
+	}
+
+	*_offset = offset;
+	*_length = end - offset;
+	return 1;
+}
+
+static void
+lanczos_raster2D_advise(float* base, size_t size,
+                        size_t offset, size_t length,
+                        int advice)
+{
+	ASSERT(base);
+
+	if(lanczos_raster2D_align(size, &offset, &length))
+	{
+		madvise(((char*) base) + offset, length, advice);
+	}
+}
+
+static int
+lanczos_raster2D_sync(float* base, size_t size,
+                      size_t offset, size_t length)
+{
+	ASSERT(base);
+
+	if(lanczos_raster2D_align(size, &offset, &length))
+	{
+		return msync(((char*) base) + offset, length,
+		             MS_ASYNC) == 0;
+	}
+	return 1;
+}
+
+static void
+lanczos_raster2D_band(lanczos_raster2D_t* self, int32_t band,
+                      int32_t* _y0, int32_t* _y1,
+                      int32_t* _i0, int32_t* _i1)
+{
+	ASSERT(self);
+	ASSERT(_y0);
+	ASSERT(_y1);
+	ASSERT(_i0);
+	ASSERT(_i1);
+
+	// the output rows [y0, y1) of a band and their source
+	// footprint which is a contiguous range of rows [i0, i1)
+	int32_t y0 = band*self->tile_h;
+	int32_t y1 = y0 + self->tile_h;
+	if(y1 > self->param->dst_h)
+	{
+		y1 = self->param->dst_h;
+	}
+	lanczos_plan1D_footprint(self->plan->plany, y0, y1,
+	                         _i0, _i1);
+	*_y0 = y0;
+	*_y1 = y1;
+}
+
+static void
+lanczos_raster2D_prefetch(lanczos_raster2D_t* self,
+                          int32_t band)
+{
+	ASSERT(self);
+
+	if(band >= self->tiles_y)
+	{
+		return;
+	}
+
+	int32_t y0;
+	int32_t y1;
+	int32_t i0;
+	int32_t i1;
+	lanczos_raster2D_band(self, band, &y0, &y1, &i0, &i1);
+
+	size_t stride = ((size_t) self->param->src_w)*
+	                self->param->channels*sizeof(float);
+	lanczos_raster2D_advise(self->src, self->src_size,
+	                        i0*stride, (i1 - i0)*stride,
+	                        MADV_WILLNEED);
+}
+
+static void
+lanczos_raster2D_task(void* arg, int32_t task, int32_t thread)
+{
+	ASSERT(arg);
+
+	lanczos_raster2DTask_t*  t     = (lanczos_raster2DTask_t*) arg;
+	lanczos_raster2D_t*      self  = t->self;
+	lanczos_paramRaster2D_t* param = self->param;
+
+	// serpentine order
+	int32_t tx = task;
+	if(t->band%2)
+	{
+		tx = self->tiles_x - 1 - task;
+	}
+
+	int32_t rows = self->plan->plany->taps;
+	int32_t x0   = tx*self->tile_w;
+	int32_t y0   = t->band*self->tile_h;
+	int32_t x1   = x0 + self->tile_w;
+	int32_t y1   = y0 + self->tile_h;
+	if(x1 > param->dst_w)
+	{
+		x1 = param->dst_w;
+	}
+	if(y1 > param->dst_h)
+	{
+		y1 = param->dst_h;
+	}
+
+	size_t n = ((size_t) rows)*self->tile_w*param->channels;
+	lanczos_plan2D_executeTile(self->plan, param->channels,
+	                           self->src, self->dst,
+	                           x0, x1, y0, y1,
+	                           &self->ring[thread*n],
+	                           &self->rows[thread*rows]);
+}
+
+/*
+ * public
+ */
+
+lanczos_raster2D_t*
+lanczos_raster2D_new(lanczos_paramRaster2D_t* param)
+{
+	ASSERT(param);
+	ASSERT(param->src_fname);
+	ASSERT(param->dst_fname);
+
+	if((param->channels <= 0) ||
+	   (param->tile_w < 0) || (param->tile_h < 0) ||
+	   (param->flags & LANCZOS_FLAG_MULTIDIM_2D_ISOTROPIC))
+	{
+		LOGE("invalid channels=%i, tile=%ix%i, flags=0x%X",
+		     param->channels, param->tile_w, param->tile_h,
+		     param->flags);
+		return NULL;
+	}
+
+	lanczos_raster2D_t* self;
+	self = (lanczos_raster2D_t*)
+	       CALLOC(1, sizeof(lanczos_raster2D_t));
+	if(self == NULL)
+	{
+		LOGE("CALLOC failed");
+		return NULL;
+	}
+
+	self->param  = param;
+	self->tile_w = param->tile_w ? param->tile_w :
+	                               LANCZOS_RASTER2D_TILE;
+	self->tile_h = param->tile_h ? param->tile_h :
+	                               LANCZOS_RASTER2D_TILE;
+
+	self->plan = lanczos_plan2D_new(param->cache, NULL,
+	                                param->flags, param->a,
+	                                param->src_w, param->src_h,
+	                                param->dst_w, param->dst_h);
+	if(self->plan == NULL)
+	{
+		goto fail_plan;
+	}
+
+	if(self->tile_w > param->dst_w)
+	{
+		self->tile_w = param->dst_w;
+	}
+	if(self->tile_h > param->dst_h)
+	{
+		self->tile_h = param->dst_h;
+	}
+	self->tiles_x = (param->dst_w + self->tile_w - 1)/
+	                self->tile_w;
+	self->tiles_y = (param->dst_h + self->tile_h - 1)/
+	                self->tile_h;
+
+	size_t sample = ((size_t) param->channels)*sizeof(float);
+	self->src_size = ((size_t) param->src_w)*param->src_h*sample;
+	self->dst_size = ((size_t) param->dst_w)*param->dst_h*sample;
+
+	// map the source
+	self->src_fd = open(param->src_fname, O_RDONLY);
+	if(self->src_fd < 0)
+	{
+		LOGE("open %s failed", param->src_fname);
+		goto fail_src_fd;
+	}
+
+	struct stat st;
+	if((fstat(self->src_fd, &st) != 0) ||
+	   (((size_t) st.st_size) < self->src_size))
+	{
+		LOGE("invalid %s", param->src_fname);
+		goto fail_src;
+	}
+
+	self->src = (float*)
+	            mmap(NULL, self->src_size, PROT_READ,
+	                 MAP_SHARED, self->src_fd, 0);
+	if(self->src == MAP_FAILED)
+	{
+		LOGE("mmap %s failed", param->src_fname);
+		goto fail_src;
+	}
+
+	// the tiles access the source rows out of order so the
+	// readahead is replaced by the prefetch of each band
+	madvise(self->src, self->src_size, MADV_RANDOM);
+
+	// map the destination
+	self->dst_fd = open(param->dst_fname,
+	                    O_RDWR | O_CREAT | O_TRUNC, 0644);
+	if(self->dst_fd < 0)
+	{
+		LOGE("open %s failed", param->dst_fname);
+		goto fail_dst_fd;
+	}
+
+	if(ftruncate(self->dst_fd, (off_t) self->dst_size) != 0)
+	{
+		LOGE("ftruncate %s failed", param->dst_fname);
+		goto fail_dst;
+	}
+
+	self->dst = (float*)
+	            mmap(NULL, self->dst_size, PROT_READ | PROT_WRITE,
+	                 MAP_SHARED, self->dst_fd, 0);
+	if(self->dst == MAP_FAILED)
+	{
+		LOGE("mmap %s failed", param->dst_fname);
+		goto fail_dst;
+	}
+
+	int32_t threads = lanczos_pool_threads(param->pool);
+	int32_t rows    = self->plan->plany->taps;
+
+	self->ring = (float*)
+	             CALLOC(((size_t) threads)*rows*self->tile_w*
+	                    param->channels, sizeof(float));
+	if(self->ring == NULL)
+	{
+		LOGE("CALLOC failed");
+		goto fail_ring;
+	}
+
+	self->rows = (const float**)
+	             CALLOC(threads*rows, sizeof(const float*));
+	if(self->rows == NULL)
+	{
+		LOGE("CALLOC failed");
+		goto fail_rows;
+	}
+
+	// success
+	return self;
+
+	// failure
+	fail_rows:
+		FREE(self->ring);
+	fail_ring:
+		munmap(self->dst, self->dst_size);
+	fail_dst:
+		close(self->dst_fd);
+	fail_dst_fd:
+		munmap(self->src, self->src_size);
+	fail_src:
+		close(self->src_fd);
+	fail_src_fd:
+		lanczos_plan2D_delete(&self->plan);
+	fail_plan:
+		FREE(self);
+	return NULL;
+}
+
+void lanczos_raster2D_delete(lanczos_raster2D_t** _self)
+{
+	ASSERT(_self);
+
+	lanczos_raster2D_t* self = *_self;
+	if(self)
+	{
+		FREE(self->rows);
+		FREE(self->ring);
+		munmap(self->dst, self->dst_size);
+		close(self->dst_fd);
+		munmap(self->src, self->src_size);
+		close(self->src_fd);
+		lanczos_plan2D_delete(&self->plan);
+		FREE(self);
+		*_self = NULL;
+	}
+}
+
+int lanczos_raster2D_resample(lanczos_raster2D_t* self)
+{
+	ASSERT(self);
+
+	lanczos_paramRaster2D_t* param = self->param;
+
+	double t0         = cc_timestamp();
+	size_t sample     = ((size_t) param->channels)*sizeof(float);
+	size_t src_stride = ((size_t) param->src_w)*sample;
+	size_t dst_stride = ((size_t) param->dst_w)*sample;
+	size_t src_bytes  = 0;
+
+	int32_t band;
+	int32_t tx;
+	int32_t x0;
+	int32_t x1;
+	int32_t y0;
+	int32_t y1;
+	int32_t i0;
+	int32_t i1;
+	int32_t k0;
+	int32_t k1;
+	int32_t n0;
+	int32_t n1;
+	lanczos_raster2D_prefetch(self, 0);
+	for(band = 0; band < self->tiles_y; ++band)
+	{
+		// prefetch the next band while the tiles of the
+		// current band are resampled
+		lanczos_raster2D_prefetch(self, band + 1);
+
+		lanczos_raster2DTask_t task =
+		{
+			.self = self,
+			.band = band,
+		};
+		lanczos_pool_run(param->pool, self->tiles_x,
+		                 lanczos_raster2D_task, &task);
+
+		// source footprint of the tiles
+		lanczos_raster2D_band(self, band, &y0, &y1, &i0, &i1);
+		for(tx = 0; tx < self->tiles_x; ++tx)
+		{
+			x0 = tx*self->tile_w;
+			x1 = x0 + self->tile_w;
+			if(x1 > param->dst_w)
+			{
+				x1 = param->dst_w;
+			}
+			lanczos_plan1D_footprint(self->plan->planx,
+			                         x0, x1, &k0, &k1);
+			src_bytes += ((size_t) (i1 - i0))*(k1 - k0)*sample;
+		}
+
+		// write back the completed rows
+		if(lanczos_raster2D_sync(self->dst, self->dst_size,
+		                         y0*dst_stride,
+		                         (y1 - y0)*dst_stride) == 0)
+		{
+			LOGE("msync %s failed", param->dst_fname);
+			return 0;
+		}
+		lanczos_raster2D_advise(self->dst, self->dst_size,
+		                        y0*dst_stride,
+		                        (y1 - y0)*dst_stride,
+		                        MADV_DONTNEED);
+
+		// release the source rows which are not shared
+		// with the next band
+		n0 = i1;
+		if(band + 1 < self->tiles_y)
+		{
+			lanczos_raster2D_band(self, band + 1,
+			                      &y0, &y1, &n0, &n1);
+		}
+		if(n0 > i0)
+		{
+			lanczos_raster2D_advise(self->src, self->src_size,
+			                        i0*src_stride,
+			                        (n0 - i0)*src_stride,
+			                        MADV_DONTNEED);
+		}
+	}
+
+	if(msync(self->dst, self->dst_size, MS_SYNC) != 0)
+	{
+		LOGE("msync %s failed", param->dst_fname);
+		return 0;
+	}
+
+	if(param->stats)
+	{
+		param->stats->tiles     = self->tiles_x*self->tiles_y;
+		param->stats->src_bytes = src_bytes;
+		param->stats->dst_bytes = self->dst_size;
+		param->stats->seconds   = cc_timestamp() - t0;
+	}
+
+	return 1;
+}
@@ -0,0 +1,75 @@
+/*
+ * Copyright (c) 2025 Jeff Boody
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included
+ * in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+
+#ifndef lanczos_raster2D_H
+#define lanczos_raster2D_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "lanczos_plan2D.h"
+#include "lanczos_resample.h"
+
+// default tile size
+#define LANCZOS_RASTER2D_TILE 512
+
+// An out-of-core driver of the 2D separable plans for raw
+// rasters which are larger than memory. The source and
+// destination files are memory mapped and the output is
+// resampled in tiles such that each tile only touches its
+// source footprint (the support window of its outputs
+// including the fs*a halo). The tiles are processed in bands
+// of rows where the tiles of a band run in parallel and the
+// bands alternate direction (serpentine order) such that the
+// pages of the halo shared by consecutive tiles and bands are
+// still in the page cache. The footprint of the next band is
+// prefetched with madvise while the pages of the completed
+// bands are released.
+typedef struct
+{
+	lanczos_paramRaster2D_t* param;
+	lanczos_plan2D_t*        plan;
+
+	int32_t tile_w;
+	int32_t tile_h;
+	int32_t tiles_x;
+	int32_t tiles_y;
+
+	// memory maps
+	int    src_fd;
+	int    dst_fd;
+	size_t src_size;
+	size_t dst_size;
+	float* src;
+	float* dst;
+
+	// per-thread scratch
+	float*        ring; // n=threads*plany->taps*tile_w*channels
+	const float** rows; // n=threads*plany->taps
+} lanczos_raster2D_t;
+
+lanczos_raster2D_t* lanczos_raster2D_new(lanczos_paramRaster2D_t* param);
+void                lanczos_raster2D_delete(lanczos_raster2D_t** _self);
+int                 lanczos_raster2D_resample(lanczos_raster2D_t* self);
+
+#endif
@@ -26,104 +26,134 @@
 #include <string.h>
 
 #define LOG_TAG "lanczos"
-#include "../../libcc/cc_list.h"
 #include "../../libcc/cc_log.h"
 #include "../../libcc/cc_memory.h"
+#include "lanczos_grid2D.h"
+#include "lanczos_kernel.h"
+#include "lanczos_plan1D.h"
+#include "lanczos_plan2D.h"
+#include "lanczos_planFixed1D.h"
+#include "lanczos_planFixed2D.h"
+#include "lanczos_planRadial.h"
+#include "lanczos_raster2D.h"
 #include "lanczos_resample.h"
 
+// density compensation threshold
+#define LANCZOS_IRREGULAR_EPSILON 1e-6f
+
+// minimum samples per output for the scatter engine
+#define LANCZOS_IRREGULAR_SCATTER_DENSITY 8
+
+// The bins are stored in a compressed (CSR) layout where
+// the samples of bin j are index[k] for k in
+// [start[j], start[j + 1]) and jf[k] is the mapped grid
+// coordinate mapjf(xi) of the sample. A sample index i >= 0
+// refers to src[i] while empty bins (holes) hold a single
+// synthesized sample i < 0 which refers to holes[-1 - i]
+// and is located at the center of the bin. The density
+// compensation weight of each bin is stored in vk.
 typedef struct
 {
-	int32_t     bin_count;
-	cc_list_t** bins;
-	cc_list_t*  holes;
+	lanczos_workspace_t* ws;
+
+	int32_t  bin_count;
+	int32_t  hole_count;
+	int32_t* start; // n=bin_count + 1
+	int32_t* index; // n=start[bin_count]
+	float*   jf;    // n=start[bin_count]
+	float*   holes; // n=hole_count*(1 + channels) : {x,val}
+	float*   vk;    // n=bin_count
 } lanczos_irregularState_t;
 
-/*
- * private
- */
-
-static float sinc(float x)
+// The scatter engine accumulates the contribution of each
+// sample into the cells and outputs that it supports rather
+// than gathering the samples for each output. The samples
+// are partitioned into one contiguous range per thread and
+// each task accumulates into private arrays
+// (n=threads*bin_count) which are reduced in sample order
+// after each pass such that the results do not depend on
+// the scheduling of the tasks. The extreme samples of each
+// bin (imin/imax) are used to fill holes whose samples are
+// stored per bin.
+typedef struct
 {
-	if(x == 0.0f)
-	{
-		return 1.0f;
-	}
-
-	return sinf(M_PI*x)/(M_PI*x);
-}
-
-static float L(float x, float a)
+	lanczos_paramIrregular1D_t* param;
+	lanczos_kernel_t            kernel;
+	int32_t                     bin_count;
+	int32_t                     threads;
+	int32_t*                    count; // per-task
+	int32_t*                    imin;  // per-task
+	int32_t*                    imax;  // per-task
+	float*                      sum;   // per-task
+	float*                      num;   // per-task (channels)
+	float*                      vk;
+	float*                      holes;
+} lanczos_irregularScatter_t;
+
+// The sorted path streams over the bins of sorted samples
+// where the samples of bin m are src[k] for k in
+// [start[m], end[m]) such that only a ring of the bin
+// boundaries (n=3a + 1) and a ring of the density weights
+// and hole samples (n=2a + 1) are stored.
+typedef struct
 {
-	if((-a < x) && (x < a))
-	{
-		return sinc(x)*sinc(x/a);
-	}
+	int32_t  bins_size;
+	int32_t  vk_size;
+	int32_t* start; // n=bins_size
+	int32_t* end;   // n=bins_size
+	float*   vk;    // n=vk_size
+	float*   holes; // n=vk_size*(1 + channels) : {x,val}
+} lanczos_irregularSorted_t;
 
-	return 0.0f;
-}
+/*
+ * private
+ */
 
 static void
 lanczos_irregularState_discard(lanczos_irregularState_t* state)
 {
 	ASSERT(state);
 
-	cc_listIter_t* iter;
-	if(state->holes)
-	{
-		iter = cc_list_head(state->holes);
-		while(iter)
-		{
-			FREE((float*) cc_list_remove(state->holes, &iter));
-		}
-		cc_list_delete(&state->holes);
-	}
-
-	int32_t i;
-	if(state->bins)
-	{
-		for(i = 0; i < state->bin_count; ++i)
-		{
-			cc_list_delete(&state->bins[i]);
-		}
-		FREE(state->bins);
-		state->bins = NULL;
-		state->bin_count = 0;
-	}
+	lanczos_workspace_free(state->ws, state->vk);
+	lanczos_workspace_free(state->ws, state->holes);
+	lanczos_workspace_free(state->ws, state->jf);
+	lanczos_workspace_free(state->ws, state->index);
+	lanczos_workspace_free(state->ws, state->start);
+	state->vk         = NULL;
+	state->holes      = NULL;
+	state->jf         = NULL;
+	state->index      = NULL;
+	state->start      = NULL;
+	state->hole_count = 0;
+	state->bin_count  = 0;
 }
 
 static int
 lanczos_irregularState_init(lanczos_irregularState_t* state,
+                            lanczos_workspace_t* ws,
                             int32_t bin_count)
 {
 	ASSERT(state);
 
-	// create holes
-	state->holes = cc_list_new();
-	if(state->holes == NULL)
+	state->ws    = ws;
+	state->start = (int32_t*)
+	               lanczos_workspace_calloc(ws, bin_count + 1,
+	                                        sizeof(int32_t));
+	if(state->start == NULL)
 	{
+		LOGE("CALLOC failed");
 		return 0;
 	}
 
-	// create bins
-	state->bins = (cc_list_t**)
-	              CALLOC(bin_count, sizeof(cc_list_t*));
-	if(state->bins == NULL)
+	state->vk = (float*)
+	            lanczos_workspace_calloc(state->ws, bin_count,
+	                                     sizeof(float));
+	if(state->vk == NULL)
 	{
 		LOGE("CALLOC failed");
 		goto failure;
 	}
 
-	// create bin lists
-	int32_t i;
-	for(i = 0; i < bin_count; ++i)
-	{
-		state->bins[i] = cc_list_new();
-		if(state->bins[i] == NULL)
-		{
-			goto failure;
-		}
-	}
-
 	state->bin_count = bin_count;
 
 	// success
@@ -135,206 +165,55 @@ lanczos_irregularState_init(lanczos_irregularState_t* state,
 	return 0;
 }
 
-static int
-lanczos_resample_regular1DFast(lanczos_paramRegular1D_t* param,
-                               int32_t phases, int32_t N,
-                               int32_t fs)
+static const float*
+lanczos_irregularState_sample(lanczos_irregularState_t* state,
+                              const float* src, size_t stride,
+                              int32_t k)
 {
-	ASSERT(param);
-
-	float* lcoef = (float*) CALLOC(N, sizeof(float));
-	if(lcoef == NULL)
-	{
-		LOGE("CALLOC failed");
-		return 0;
-	}
-
-	float* wj = (float*) CALLOC(phases, sizeof(float));
-	if(wj == NULL)
-	{
-		LOGE("CALLOC failed");
-		goto fail_wj;
-	}
-
-	float xj;
-	float x;
-	float step = ((float) param->src_w)/
-	             ((float) param->dst_w);
-
-	// precompute Lanczos kernel coefficients and
-	// normalizing weights
-	int32_t i;
-	int32_t j;
-	int32_t idx = 0;
-	int32_t i0  = -((int32_t) fs*param->a) + 1;
-	int32_t i1  = (int32_t) fs*param->a;
-	for(j = 0; j < phases; ++j)
-	{
-		xj    = (j + 0.5f)*step - 0.5f;
-		wj[j] = 0.0f;
-		for(i = i0; i <= i1; ++i)
-		{
-			if(idx >= N)
-			{
-				LOGE("invalid idx=%i, N=%u", idx, N);
-				goto fail_precompute;
-			}
-
-			x          = (i - xj + floorf(xj))/fs;
-			lcoef[idx] = L(x, param->a);
-			wj[j]     += lcoef[idx];
-			++idx;
-		}
-	}
+	ASSERT(state);
+	ASSERT(src);
 
-	if(idx != N)
+	int32_t i = state->index[k];
+	if(i >= 0)
 	{
-		LOGE("invalid idx=%i, N=%u", idx, N);
-		goto fail_precompute;
-	}
-
-	// commpute s2[j]
-	int32_t ch;
-	int32_t nch = param->channels;
-	int32_t ii;
-	int32_t jj;
-	int32_t s1x;
-	float   sum;
-	float*  s1 = param->src;
-	float*  s2 = param->dst;
-	for(ch = 0; ch < nch; ++ch)
-	{
-		// reset idx
-		idx = 0;
-
-		for(j = 0; j < param->dst_w; ++j)
-		{
-			sum = 0.0f;
-			jj  = j%phases;
-			xj  = (j + 0.5f)*step - 0.5f;
-			for(i = i0; i <= i1; ++i)
-			{
-				// Edge Handling
-				s1x = ((int32_t) floorf(xj)) + i;
-				if(param->flags & LANCZOS_FLAG_EDGE_ZERO_PADDING)
-				{
-					// Zero Padding
-					if((s1x < 0) || (s1x >= (param->src_w - 1)))
-					{
-						++idx;
-						continue;
-					}
-				}
-				else
-				{
-					// Clamping
-					if(s1x < 0)
-					{
-						s1x = 0;
-					}
-					else if(s1x >= param->src_w)
-					{
-						s1x = param->src_w - 1;
-					}
-				}
-
-				ii   = idx%N;
-				sum += s1[nch*s1x + ch]*lcoef[ii];
-				++idx;
-			}
-
-			// Preserving Flux Normalization
-			s2[nch*j + ch] = sum/wj[jj];
-		}
+		return &src[stride*i];
 	}
-
-	FREE(wj);
-	FREE(lcoef);
-
-	// success
-	return 1;
-
-	// failure
-	fail_precompute:
-		FREE(wj);
-	fail_wj:
-		FREE(lcoef);
-	return 0;
+	return &state->holes[stride*(-1 - i)];
 }
 
-static int
-lanczos_resample_regular1DSlow(lanczos_paramRegular1D_t* param)
+static float
+lanczos_resample_jf1D(lanczos_paramIrregular1D_t* param,
+                      float xi)
 {
 	ASSERT(param);
 
-	float fs = 1.0f;
-	if(param->dst_w < param->src_w)
-	{
-		fs = ((float) param->src_w)/((float) param->dst_w);
-	}
-
-	float step = ((float) param->src_w)/
-	             ((float) param->dst_w);
+	// compute xi2jf
+	float n2 = (float) param->dst_w;
+	float x0 = param->src_x0;
+	float x1 = param->src_x1;
+	return n2*(xi - x0)/(x1 - x0);
+}
 
-	// commpute s2[j]
-	int32_t ch;
-	int32_t nch = param->channels;
-	int32_t j;
-	int32_t i;
-	int32_t i0;
-	int32_t i1;
-	int32_t s1x;
-	float   sum;
-	float   xj;
-	float   wj;
-	float   lcoef;
-	float*  s1 = param->src;
-	float*  s2 = param->dst;
-	for(ch = 0; ch < nch; ++ch)
-	{
-		for(j = 0; j < param->dst_w; ++j)
-		{
-			sum = 0.0f;
-			wj  = 0.0f;
-			xj  = (j + 0.5f)*step - 0.5f;
-			i0 = (int32_t) floorf(-fs*param->a + 1 + (xj - floorf(xj)));
-			i1 = (int32_t) floorf(fs*param->a + (xj - floorf(xj)));
-			for(i = i0; i <= i1; ++i)
-			{
-				// Edge Handling
-				s1x = ((int32_t) floorf(xj)) + i;
-				if(param->flags & LANCZOS_FLAG_EDGE_ZERO_PADDING)
-				{
-					// Zero Padding
-					if((s1x < 0) || (s1x >= (param->src_w - 1)))
-					{
-						continue;
-					}
-				}
-				else
-				{
-					// Clamping
-					if(s1x < 0)
-					{
-						s1x = 0;
-					}
-					else if(s1x >= param->src_w)
-					{
-						s1x = param->src_w - 1;
-					}
-				}
+static int32_t
+lanczos_resample_bin1D(lanczos_paramIrregular1D_t* param,
+                       int32_t bin_count, float xi,
+                       float* _jf)
+{
+	ASSERT(param);
+	ASSERT(_jf);
 
-				lcoef = L((i - xj + floor(xj))/fs, param->a);
-				sum  += s1[nch*s1x + ch]*lcoef;
-				wj   += lcoef;
-			}
+	float jf = lanczos_resample_jf1D(param, xi);
+	*_jf     = jf;
 
-			// Preserving Flux Normalization
-			s2[nch*j + ch] = sum/wj;
-		}
+	// discard samples outside bin range
+	// shift j to allow for support samples outside (x0..x1)
+	int32_t ja = ((int32_t) floorf(jf)) + param->a;
+	if((ja < 0) || (ja >= bin_count))
+	{
+		return -1;
 	}
 
-	return 1;
+	return ja;
 }
 
 static int
@@ -344,127 +223,153 @@ lanczos_resample_binningPass1D(lanczos_paramIrregular1D_t* param,
 	ASSERT(param);
 	ASSERT(state);
 
-	int32_t src_stride = 1 + param->channels;
+	size_t   src_stride = 1 + param->channels;
+	int32_t  bin_count  = state->bin_count;
+	int32_t* start      = state->start;
 
-	// binning pass
+	// count the samples per bin
 	int32_t i;
 	int32_t ja;
-	float   xi;
 	float   jf;
-	float   n2 = (float) param->dst_w;
-	float   a  = (float) param->a;
-	float   x0 = param->src_x0;
-	float   x1 = param->src_x1;
 	for(i = 0; i < param->src_count; ++i)
 	{
-		// compute xi2jf
-		xi = param->src[src_stride*i + 0];
-		jf = n2*(xi - x0)/(x1 - x0);
-
-		// discard samples outside bin range
-		// shift j to allow for support samples outside (x0..x1)
-		ja = ((int32_t) floorf(jf)) + a;
-		if((ja < 0) || (ja >= state->bin_count))
+		ja = lanczos_resample_bin1D(param, bin_count,
+		                            param->src[src_stride*i],
+		                            &jf);
+		if(ja >= 0)
 		{
-			continue;
+			++start[ja + 1];
 		}
+	}
 
-		// store dat in list
-		if(cc_list_append(state->bins[ja], NULL,
-		                  &param->src[src_stride*i]) == NULL)
+	// reserve one sample for each hole
+	int32_t count = 0;
+	state->hole_count = 0;
+	for(ja = 0; ja < bin_count; ++ja)
+	{
+		if(start[ja + 1] == 0)
 		{
-			return 0;
+			++state->hole_count;
+			++count;
 		}
+		count += start[ja + 1];
 	}
 
-	return 1;
-}
-
-static int
-lanczos_resample_fillHole1D(lanczos_paramIrregular1D_t* param,
-                            lanczos_irregularState_t* state,
-                            int32_t ja)
-{
-	ASSERT(param);
-	ASSERT(state);
-
-	int32_t channels   = param->channels;
-	int32_t src_stride = 1 + channels;
-
-	float* dat = (float*) CALLOC(src_stride, sizeof(float));
-	if(dat == NULL)
+	state->index = (int32_t*)
+	               lanczos_workspace_calloc(state->ws, count,
+	                                        sizeof(int32_t));
+	if(state->index == NULL)
 	{
 		LOGE("CALLOC failed");
 		return 0;
 	}
 
-	// compute jf2xi
-	float x0 = param->src_x0;
-	float x1 = param->src_x1;
-	float n2 = param->dst_w;
-	float jf = ((float) (ja - param->a)) + 0.5f;
-	float xi = x0 + (x1 - x0)*jf/n2;
-	dat[0]   = xi;
-
-	cc_listIter_t* dat_iter;
-	dat_iter = cc_list_append(state->holes, NULL, dat);
-	if(dat_iter == NULL)
+	state->jf = (float*)
+	            lanczos_workspace_calloc(state->ws, count,
+	                                     sizeof(float));
+	if(state->jf == NULL)
 	{
-		goto fail_holes;
+		LOGE("CALLOC failed");
+		return 0;
 	}
 
-	if(cc_list_append(state->bins[ja], NULL, dat) == NULL)
+	if(state->hole_count)
 	{
-		goto fail_bins;
+		state->holes = (float*)
+		               lanczos_workspace_calloc(state->ws,
+		                                        state->hole_count*src_stride,
+		                                        sizeof(float));
+		if(state->holes == NULL)
+		{
+			LOGE("CALLOC failed");
+			return 0;
+		}
 	}
 
-	if(param->flags & LANCZOS_FLAG_NODATA_ZERO)
+	// prefix sum where start[ja] is used as the insertion
+	// point of the scatter and is restored afterwards
+	// the hole samples are inserted at the bin center
+	int32_t h = 0;
+	for(ja = 0; ja < bin_count; ++ja)
 	{
-		return 1;
+		if(start[ja + 1] == 0)
+		{
+			state->index[start[ja]] = -1 - h;
+			state->jf[start[ja]]    = ((float) (ja - param->a)) +
+			                          0.5f;
+			start[ja + 1] = start[ja] + 1;
+			++start[ja];
+			++h;
+			continue;
+		}
+		start[ja + 1] += start[ja];
 	}
 
-	// find the nearest sample in each direction
-	cc_listIter_t* iter;
-	int32_t jj;
-	int32_t a   = param->a;
-	float*  x0p = NULL;
-	float*  x1p = NULL;
-	float*  xp;
-	for(jj = ja - 1; jj >= ja - a; --jj)
+	// scatter the sample indices
+	for(i = 0; i < param->src_count; ++i)
 	{
-		if(x0p || (jj < 0))
+		ja = lanczos_resample_bin1D(param, bin_count,
+		                            param->src[src_stride*i],
+		                            &jf);
+		if(ja >= 0)
 		{
-			break;
+			state->jf[start[ja]]      = jf;
+			state->index[start[ja]++] = i;
 		}
+	}
 
-		iter = cc_list_head(state->bins[jj]);
-		while(iter)
-		{
-			xp = (float*) cc_list_peekIter(iter);
-			if((x0p == NULL) || (xp[0] > x0p[0]))
-			{
-				x0p = xp;
-			}
-			iter = cc_list_next(iter);
-		}
+	for(ja = bin_count; ja > 0; --ja)
+	{
+		start[ja] = start[ja - 1];
 	}
-	for(jj = ja + 1; jj <= ja + a; ++jj)
+	start[0] = 0;
+
+	return 1;
+}
+
+static const float*
+lanczos_resample_extreme1D(lanczos_paramIrregular1D_t* param,
+                           lanczos_irregularState_t* state,
+                           int32_t ja, int max)
+{
+	ASSERT(param);
+	ASSERT(state);
+
+	size_t  src_stride = 1 + param->channels;
+
+	// find the sample with the min or max position
+	int32_t      k;
+	const float* xp;
+	const float* xe = NULL;
+	for(k = state->start[ja]; k < state->start[ja + 1]; ++k)
 	{
-		if(x1p || (jj >= state->bin_count))
+		xp = lanczos_irregularState_sample(state, param->src,
+		                                   src_stride, k);
+		if((xe == NULL) ||
+		   (max && (xp[0] > xe[0])) ||
+		   ((max == 0) && (xp[0] < xe[0])))
 		{
-			break;
+			xe = xp;
 		}
+	}
 
-		iter = cc_list_head(state->bins[jj]);
-		while(iter)
-		{
-			xp = (float*) cc_list_peekIter(iter);
-			if((x1p == NULL) || (xp[0] < x1p[0]))
-			{
-				x1p = xp;
-			}
-			iter = cc_list_next(iter);
-		}
+	return xe;
+}
+
+static void
+lanczos_resample_fillHole1D(lanczos_paramIrregular1D_t* param,
+                            float* dat, const float* x0p,
+                            const float* x1p)
+{
+	ASSERT(param);
+	ASSERT(dat);
+
+	int32_t channels = param->channels;
+	float   xi       = dat[0];
+
+	if(param->flags & LANCZOS_FLAG_NODATA_ZERO)
+	{
+		return;
 	}
 
 	// try LINEAR (default)
@@ -478,7 +383,7 @@ lanczos_resample_fillHole1D(lanczos_paramIrregular1D_t* param,
 		{
 			dat[ch] = x0p[ch] + s*(x1p[ch] - x0p[ch]);
 		}
-		return 1;
+		return;
 	}
 
 	// determine NEAREST and fallthrough to copy
@@ -496,16 +401,6 @@ lanczos_resample_fillHole1D(lanczos_paramIrregular1D_t* param,
 	{
 		memcpy(&dat[1], &x1p[1], channels*sizeof(float));
 	}
-
-	// success
-	return 1;
-
-	// failure
-	fail_bins:
-		cc_list_remove(state->holes, &dat_iter);
-	fail_holes:
-		FREE(dat);
-	return 0;
 }
 
 static int
@@ -515,105 +410,959 @@ lanczos_resample_holePass1D(lanczos_paramIrregular1D_t* param,
 	ASSERT(param);
 	ASSERT(state);
 
-	int32_t ja;
-	for(ja = 0; ja < state->bin_count; ++ja)
+	int32_t  a          = param->a;
+	int32_t  bin_count  = state->bin_count;
+	size_t   src_stride = 1 + param->channels;
+	int32_t* start      = state->start;
+
+	// The hole samples are filled in a single sweep where
+	// the left neighbor of a hole is the max sample of the
+	// previous bin (which may be a filled hole) and the right
+	// neighbor is the min sample of the next populated bin
+	// within the support radius. The next populated bin only
+	// moves forward so the sweep is O(bins + samples).
+	int32_t      ja;
+	int32_t      k;
+	int32_t      next = 0;
+	float        x0   = param->src_x0;
+	float        x1   = param->src_x1;
+	float        n2   = param->dst_w;
+	float        jf;
+	float*       dat;
+	const float* x0p  = NULL;
+	const float* x1p  = NULL;
+	for(ja = 0; ja < bin_count; ++ja)
 	{
-		if(cc_list_size(state->bins[ja]) > 0)
+		k = state->index[start[ja]];
+		if(k >= 0)
 		{
+			x0p = lanczos_resample_extreme1D(param, state, ja, 1);
 			continue;
 		}
 
-		if(lanczos_resample_fillHole1D(param, state, ja) == 0)
+		// compute jf2xi
+		dat    = &state->holes[src_stride*(-1 - k)];
+		jf     = ((float) (ja - a)) + 0.5f;
+		dat[0] = x0 + (x1 - x0)*jf/n2;
+
+		// advance to the next populated bin
+		if(next <= ja)
 		{
-			return 0;
+			next = ja + 1;
+			while((next < bin_count) &&
+			      (state->index[start[next]] < 0))
+			{
+				++next;
+			}
+			x1p = NULL;
+			if(next < bin_count)
+			{
+				x1p = lanczos_resample_extreme1D(param, state,
+				                                 next, 0);
+			}
 		}
+
+		lanczos_resample_fillHole1D(param, dat, x0p,
+		                            (next - ja <= a) ? x1p : NULL);
+		x0p = dat;
 	}
 
 	return 1;
 }
 
-static int
-lanczos_resample_resamplePass1D(lanczos_paramIrregular1D_t* param,
-                                lanczos_irregularState_t* state)
+static float
+lanczos_resample_density1D(lanczos_paramIrregular1D_t* param,
+                           lanczos_irregularState_t* state,
+                           lanczos_kernel_t* kernel,
+                           int32_t ja)
 {
 	ASSERT(param);
 	ASSERT(state);
+	ASSERT(kernel);
+
+	int32_t a  = param->a;
+	int32_t m0 = (ja - a < 0) ? 0 : ja - a;
+	int32_t m1 = (ja + a >= state->bin_count) ?
+	             state->bin_count - 1 : ja + a;
+
+	// sum the kernel for the samples within the support
+	// radius of the cell center
+	int32_t k;
+	int32_t k0  = state->start[m0];
+	int32_t k1  = state->start[m1 + 1];
+	float   c   = ((float) (ja - a)) + 0.5f;
+	float   sum = 0.0f;
+	for(k = k0; k < k1; ++k)
+	{
+		sum += lanczos_kernel_eval(kernel, state->jf[k] - c);
+	}
 
-	// TODO - lanczos_resample_resamplePass1D
-	return 0;
+	if(fabsf(sum) > LANCZOS_IRREGULAR_EPSILON)
+	{
+		return 1.0f/sum;
+	}
+	return 0.0f;
 }
 
-/*
- * public
- */
-
-int lanczos_resample_regular1D(lanczos_paramRegular1D_t* param)
+static int
+lanczos_resample_resamplePass1D(lanczos_paramIrregular1D_t* param,
+                                lanczos_irregularState_t* state)
 {
 	ASSERT(param);
-	ASSERT(param->src);
-	ASSERT(param->dst);
+	ASSERT(state);
 
-	// detect resampling fast paths
-	if(param->dst_w >= param->src_w)
+	lanczos_kernel_t kernel;
+	if(lanczos_kernel_init(&kernel, param->flags, param->a) == 0)
 	{
-		if((param->dst_w % param->src_w) == 0)
-		{
-			// Upsampling (Fast Path)
-			// Resampling Factor: S = n2/n1
-			// Total Coefficients: N = S*2*a
-			// Filter Scale: 1
-			int32_t S  = param->dst_w/param->src_w;
-			int32_t N  = S*2*param->a;
-			int32_t fs = 1;
-			return lanczos_resample_regular1DFast(param, S, N, fs);
-		}
+		return 0;
+	}
+
+	// Density Compensation
+	// the weight of each cell is computed once and is reused
+	// by every output whose support covers the cell
+	int32_t ja;
+	for(ja = 0; ja < state->bin_count; ++ja)
+	{
+		state->vk[ja] = lanczos_resample_density1D(param, state,
+		                                           &kernel, ja);
 	}
-	else if((param->src_w % param->dst_w) == 0)
+
+	// Irregular Interpolation and Normalization
+	// output j is the center of bin j + a and each sample is
+	// applied to all channels
+	int32_t      a          = param->a;
+	int32_t      channels   = param->channels;
+	size_t       src_stride = 1 + channels;
+	int32_t*     start      = state->start;
+	int32_t      ch;
+	int32_t      j;
+	int32_t      k;
+	int32_t      m;
+	float        c;
+	float        w;
+	float        wj;
+	float*       s2;
+	const float* s1;
+	for(j = 0; j < param->dst_w; ++j)
 	{
-		// Downsampling (Fast Path)
-		// Resampling Factor: S = 1/D = n2/n1
-		// Total Coefficients: N = D*2*a
-		// Filter Scale: fs = n1/n2
-		int32_t D  = param->src_w/param->dst_w;
-		int32_t N  = D*2*param->a;
-		int32_t fs = D;
-		return lanczos_resample_regular1DFast(param, 1, N, fs);
+		s2 = &param->dst[channels*j];
+		for(ch = 0; ch < channels; ++ch)
+		{
+			s2[ch] = 0.0f;
+		}
+
+		ja = j + a;
+		c  = ((float) j) + 0.5f;
+		wj = 0.0f;
+		for(m = ja - a; m <= ja + a; ++m)
+		{
+			for(k = start[m]; k < start[m + 1]; ++k)
+			{
+				w   = state->vk[m]*
+				      lanczos_kernel_eval(&kernel,
+				                          state->jf[k] - c);
+				s1  = lanczos_irregularState_sample(state,
+				                                    param->src,
+				                                    src_stride, k);
+				wj += w;
+				for(ch = 0; ch < channels; ++ch)
+				{
+					s2[ch] += w*s1[ch + 1];
+				}
+			}
+		}
+
+		if(fabsf(wj) > LANCZOS_IRREGULAR_EPSILON)
+		{
+			w = 1.0f/wj;
+			for(ch = 0; ch < channels; ++ch)
+			{
+				s2[ch] *= w;
+			}
+		}
+		else
+		{
+			for(ch = 0; ch < channels; ++ch)
+			{
+				s2[ch] = 0.0f;
+			}
+		}
 	}
 
-	// Arbitrary Resampling (Slow Path)
-	return lanczos_resample_regular1DSlow(param);
+	return 1;
 }
 
-int lanczos_resample_regular2D(lanczos_paramRegular2D_t* param)
+static void
+lanczos_irregularScatter_discard(lanczos_irregularScatter_t* self)
 {
-	ASSERT(param);
-	ASSERT(param->src);
-	ASSERT(param->dst);
-
-	// TODO - lanczos_resample_regular2D
-	return 0;
+	ASSERT(self);
+
+	lanczos_workspace_t* ws = self->param->ws;
+	lanczos_workspace_free(ws, self->holes);
+	lanczos_workspace_free(ws, self->vk);
+	lanczos_workspace_free(ws, self->num);
+	lanczos_workspace_free(ws, self->sum);
+	lanczos_workspace_free(ws, self->imax);
+	lanczos_workspace_free(ws, self->imin);
+	lanczos_workspace_free(ws, self->count);
 }
 
-int lanczos_resample_irregular1D(lanczos_paramIrregular1D_t* param)
+static int
+lanczos_irregularScatter_init(lanczos_irregularScatter_t* self,
+                              lanczos_paramIrregular1D_t* param,
+                              int32_t bin_count)
 {
+	ASSERT(self);
 	ASSERT(param);
-	ASSERT(param->src);
-	ASSERT(param->dst);
 
-	int32_t bin_count = param->dst_w + 2*param->a;
+	int32_t threads  = lanczos_pool_threads(param->pool);
+	int32_t channels = param->channels;
+	int32_t n        = threads*bin_count;
 
-	lanczos_irregularState_t state = { 0 };
-	if(lanczos_irregularState_init(&state, bin_count) == 0)
+	self->param     = param;
+	self->bin_count = bin_count;
+	self->threads   = threads;
+
+	if(lanczos_kernel_init(&self->kernel, param->flags,
+	                       param->a) == 0)
 	{
 		return 0;
 	}
 
-	if((lanczos_resample_binningPass1D(param, &state) == 0) ||
-	   (lanczos_resample_holePass1D(param, &state) == 0)    ||
-	   (lanczos_resample_resamplePass1D(param, &state) == 0))
+	lanczos_workspace_t* ws = param->ws;
+	self->count = (int32_t*)
+	              lanczos_workspace_calloc(ws, n,
+	                                       sizeof(int32_t));
+	self->imin  = (int32_t*)
+	              lanczos_workspace_calloc(ws, n,
+	                                       sizeof(int32_t));
+	self->imax  = (int32_t*)
+	              lanczos_workspace_calloc(ws, n,
+	                                       sizeof(int32_t));
+	self->sum   = (float*)
+	              lanczos_workspace_calloc(ws, n,
+	                                       sizeof(float));
+	self->num   = (float*)
+	              lanczos_workspace_calloc(ws, n*channels,
+	                                       sizeof(float));
+	self->vk    = (float*)
+	              lanczos_workspace_calloc(ws, bin_count,
+	                                       sizeof(float));
+	self->holes = (float*)
+	              lanczos_workspace_calloc(ws,
+	                                       bin_count*(1 + channels),
+	                                       sizeof(float));
+	if((self->count == NULL) || (self->imin == NULL) ||
+	   (self->imax  == NULL) || (self->sum  == NULL) ||
+	   (self->num   == NULL) || (self->vk   == NULL) ||
+	   (self->holes == NULL))
 	{
-		goto failure;
-	}
+		LOGE("CALLOC failed");
+		lanczos_irregularScatter_discard(self);
+		return 0;
+	}
+
+	return 1;
+}
+
+static void
+lanczos_irregularScatter_range(lanczos_irregularScatter_t* self,
+                               int32_t task,
+                               int32_t* _i0, int32_t* _i1)
+{
+	ASSERT(self);
+	ASSERT(_i0);
+	ASSERT(_i1);
+
+	// the fixed partition of the samples keeps the order of
+	// the float sums independent of the thread scheduling
+	int64_t n = self->param->src_count;
+	*_i0 = (int32_t) ((task*n)/self->threads);
+	*_i1 = (int32_t) (((task + 1)*n)/self->threads);
+}
+
+static void
+lanczos_irregularScatter_density(void* arg, int32_t task,
+                                 int32_t thread)
+{
+	ASSERT(arg);
+
+	lanczos_irregularScatter_t* self  = (lanczos_irregularScatter_t*) arg;
+	lanczos_paramIrregular1D_t* param = self->param;
+
+	int32_t  a          = param->a;
+	int32_t  bin_count  = self->bin_count;
+	size_t   src_stride = 1 + param->channels;
+	int32_t* count      = &self->count[task*bin_count];
+	int32_t* imin       = &self->imin[task*bin_count];
+	int32_t* imax       = &self->imax[task*bin_count];
+	float*   sum        = &self->sum[task*bin_count];
+
+	int32_t i0;
+	int32_t i1;
+	lanczos_irregularScatter_range(self, task, &i0, &i1);
+
+	// accumulate the sample counts, the extreme samples and
+	// the density of the cells supported by each sample
+	int32_t i;
+	int32_t k;
+	int32_t k0;
+	int32_t k1;
+	int32_t m;
+	float   jf;
+	float   xi;
+	for(i = i0; i < i1; ++i)
+	{
+		xi = param->src[src_stride*i];
+		m  = lanczos_resample_bin1D(param, bin_count, xi, &jf);
+		if(m < 0)
+		{
+			continue;
+		}
+
+		if(count[m] == 0)
+		{
+			imin[m] = i;
+			imax[m] = i;
+		}
+		else if(xi < param->src[src_stride*imin[m]])
+		{
+			imin[m] = i;
+		}
+		else if(xi > param->src[src_stride*imax[m]])
+		{
+			imax[m] = i;
+		}
+		++count[m];
+
+		k0 = (m - a < 0) ? 0 : m - a;
+		k1 = (m + a >= bin_count) ? bin_count - 1 : m + a;
+		for(k = k0; k <= k1; ++k)
+		{
+			sum[k] += lanczos_kernel_eval(&self->kernel,
+			                              jf - ((float) (k - a)) -
+			                              0.5f);
+		}
+	}
+}
+
+static void
+lanczos_irregularScatter_resample(void* arg, int32_t task,
+                                  int32_t thread)
+{
+	ASSERT(arg);
+
+	lanczos_irregularScatter_t* self  = (lanczos_irregularScatter_t*) arg;
+	lanczos_paramIrregular1D_t* param = self->param;
+
+	int32_t a          = param->a;
+	int32_t channels   = param->channels;
+	int32_t bin_count  = self->bin_count;
+	size_t  src_stride = 1 + channels;
+	float*  wj         = &self->sum[task*bin_count];
+	float*  num        = &self->num[task*bin_count*channels];
+
+	int32_t i0;
+	int32_t i1;
+	lanczos_irregularScatter_range(self, task, &i0, &i1);
+
+	// accumulate the weighted sample into the outputs
+	// j = k - a whose support covers the sample
+	int32_t      ch;
+	int32_t      i;
+	int32_t      j;
+	int32_t      j0;
+	int32_t      j1;
+	int32_t      m;
+	float        jf;
+	float        w;
+	const float* s1;
+	for(i = i0; i < i1; ++i)
+	{
+		s1 = &param->src[src_stride*i];
+		m  = lanczos_resample_bin1D(param, bin_count, s1[0], &jf);
+		if(m < 0)
+		{
+			continue;
+		}
+
+		j0 = (m - 2*a < 0) ? 0 : m - 2*a;
+		j1 = (m >= param->dst_w) ? param->dst_w - 1 : m;
+		for(j = j0; j <= j1; ++j)
+		{
+			w = self->vk[m]*
+			    lanczos_kernel_eval(&self->kernel,
+			                        jf - ((float) j) - 0.5f);
+			wj[j] += w;
+			for(ch = 0; ch < channels; ++ch)
+			{
+				num[channels*j + ch] += w*s1[ch + 1];
+			}
+		}
+	}
+}
+
+static void
+lanczos_irregularScatter_holes(lanczos_irregularScatter_t* self)
+{
+	ASSERT(self);
+
+	lanczos_paramIrregular1D_t* param = self->param;
+
+	int32_t  a          = param->a;
+	int32_t  bin_count  = self->bin_count;
+	size_t   src_stride = 1 + param->channels;
+	int32_t* count      = self->count;
+	float*   sum        = self->sum;
+
+	// fill the holes as in lanczos_resample_holePass1D
+	// where the hole samples are located at the bin center
+	int32_t      ja;
+	int32_t      k;
+	int32_t      k0;
+	int32_t      k1;
+	int32_t      next = 0;
+	float        x0   = param->src_x0;
+	float        x1   = param->src_x1;
+	float        n2   = param->dst_w;
+	float        jf;
+	float*       dat;
+	const float* x0p  = NULL;
+	const float* x1p  = NULL;
+	for(ja = 0; ja < bin_count; ++ja)
+	{
+		if(count[ja])
+		{
+			x0p = &param->src[src_stride*self->imax[ja]];
+			continue;
+		}
+
+		// compute jf2xi
+		dat    = &self->holes[src_stride*ja];
+		jf     = ((float) (ja - a)) + 0.5f;
+		dat[0] = x0 + (x1 - x0)*jf/n2;
+
+		// advance to the next populated bin
+		if(next <= ja)
+		{
+			next = ja + 1;
+			while((next < bin_count) && (count[next] == 0))
+			{
+				++next;
+			}
+			x1p = NULL;
+			if(next < bin_count)
+			{
+				x1p = &param->src[src_stride*self->imin[next]];
+			}
+		}
+
+		lanczos_resample_fillHole1D(param, dat, x0p,
+		                            (next - ja <= a) ? x1p : NULL);
+		x0p = dat;
+
+		// accumulate the density of the hole
+		k0 = (ja - a < 0) ? 0 : ja - a;
+		k1 = (ja + a >= bin_count) ? bin_count - 1 : ja + a;
+		for(k = k0; k <= k1; ++k)
+		{
+			sum[k] += lanczos_kernel_eval(&self->kernel,
+			                              (float) (ja - k));
+		}
+	}
+}
+
+static int
+lanczos_resample_scatter1D(lanczos_paramIrregular1D_t* param,
+                           int32_t bin_count)
+{
+	ASSERT(param);
+
+	lanczos_irregularScatter_t self = { 0 };
+	if(lanczos_irregularScatter_init(&self, param,
+	                                 bin_count) == 0)
+	{
+		return 0;
+	}
+
+	int32_t a          = param->a;
+	int32_t channels   = param->channels;
+	size_t  src_stride = 1 + channels;
+	int32_t tasks      = self.threads;
+
+	// Density Compensation
+	lanczos_pool_run(param->pool, tasks,
+	                 lanczos_irregularScatter_density, &self);
+
+	// reduce the per-task accumulators in sample order where
+	// the ties of imin/imax keep the first sample as in the
+	// single threaded case
+	int32_t i;
+	int32_t ja;
+	int32_t t;
+	int32_t n;
+	for(t = 1; t < self.threads; ++t)
+	{
+		n = t*bin_count;
+		for(ja = 0; ja < bin_count; ++ja)
+		{
+			i = n + ja;
+			self.sum[ja] += self.sum[i];
+			if(self.count[i] == 0)
+			{
+				continue;
+			}
+
+			if((self.count[ja] == 0) ||
+			   (param->src[src_stride*self.imin[i]] <
+			    param->src[src_stride*self.imin[ja]]))
+			{
+				self.imin[ja] = self.imin[i];
+			}
+
+			if((self.count[ja] == 0) ||
+			   (param->src[src_stride*self.imax[i]] >
+			    param->src[src_stride*self.imax[ja]]))
+			{
+				self.imax[ja] = self.imax[i];
+			}
+
+			self.count[ja] += self.count[i];
+		}
+	}
+
+	lanczos_irregularScatter_holes(&self);
+
+	for(ja = 0; ja < bin_count; ++ja)
+	{
+		if(fabsf(self.sum[ja]) > LANCZOS_IRREGULAR_EPSILON)
+		{
+			self.vk[ja] = 1.0f/self.sum[ja];
+		}
+	}
+
+	// Irregular Interpolation
+	memset(self.sum, 0,
+	       self.threads*bin_count*sizeof(float));
+	lanczos_pool_run(param->pool, tasks,
+	                 lanczos_irregularScatter_resample, &self);
+
+	// reduce the per-task accumulators
+	int32_t ch;
+	int32_t dst_w = param->dst_w;
+	for(t = 1; t < self.threads; ++t)
+	{
+		n = t*bin_count;
+		for(i = 0; i < dst_w; ++i)
+		{
+			self.sum[i] += self.sum[n + i];
+		}
+
+		n *= channels;
+		for(i = 0; i < dst_w*channels; ++i)
+		{
+			self.num[i] += self.num[n + i];
+		}
+	}
+
+	// accumulate the hole samples
+	int32_t      j;
+	int32_t      j0;
+	int32_t      j1;
+	float        w;
+	const float* s1;
+	for(ja = 0; ja < bin_count; ++ja)
+	{
+		if(self.count[ja])
+		{
+			continue;
+		}
+
+		s1 = &self.holes[src_stride*ja];
+		j0 = (ja - 2*a < 0) ? 0 : ja - 2*a;
+		j1 = (ja >= dst_w) ? dst_w - 1 : ja;
+		for(j = j0; j <= j1; ++j)
+		{
+			w = self.vk[ja]*
+			    lanczos_kernel_eval(&self.kernel,
+			                        (float) (ja - a - j));
+			self.sum[j] += w;
+			for(ch = 0; ch < channels; ++ch)
+			{
+				self.num[channels*j + ch] += w*s1[ch + 1];
+			}
+		}
+	}
+
+	// Normalization
+	float* s2;
+	for(j = 0; j < dst_w; ++j)
+	{
+		s2 = &param->dst[channels*j];
+		w  = 0.0f;
+		if(fabsf(self.sum[j]) > LANCZOS_IRREGULAR_EPSILON)
+		{
+			w = 1.0f/self.sum[j];
+		}
+
+		for(ch = 0; ch < channels; ++ch)
+		{
+			s2[ch] = w*self.num[channels*j + ch];
+		}
+	}
+
+	lanczos_irregularScatter_discard(&self);
+
+	return 1;
+}
+
+static int
+lanczos_resample_isSorted1D(lanczos_paramIrregular1D_t* param)
+{
+	ASSERT(param);
+
+	// the bins are only in sample order when xi2jf is
+	// increasing
+	if(param->src_x1 <= param->src_x0)
+	{
+		return 0;
+	}
+
+	if(param->flags & LANCZOS_FLAG_SRC_SORTED)
+	{
+		return 1;
+	}
+
+	int32_t      i;
+	size_t       src_stride = 1 + param->channels;
+	const float* src        = param->src;
+	for(i = 1; i < param->src_count; ++i)
+	{
+		// also rejects NaN
+		if((src[src_stride*i] >= src[src_stride*(i - 1)]) == 0)
+		{
+			return 0;
+		}
+	}
+
+	return 1;
+}
+
+static void
+lanczos_irregularSorted_discard(lanczos_irregularSorted_t* self,
+                                lanczos_workspace_t* ws)
+{
+	ASSERT(self);
+
+	lanczos_workspace_free(ws, self->holes);
+	lanczos_workspace_free(ws, self->vk);
+	lanczos_workspace_free(ws, self->end);
+	lanczos_workspace_free(ws, self->start);
+}
+
+static int
+lanczos_irregularSorted_init(lanczos_irregularSorted_t* self,
+                             lanczos_paramIrregular1D_t* param)
+{
+	ASSERT(self);
+	ASSERT(param);
+
+	lanczos_workspace_t* ws = param->ws;
+
+	int32_t a      = param->a;
+	int32_t stride = 1 + param->channels;
+
+	self->bins_size = 3*a + 1;
+	self->vk_size   = 2*a + 1;
+
+	self->start = (int32_t*)
+	              lanczos_workspace_calloc(ws, self->bins_size,
+	                                       sizeof(int32_t));
+	self->end   = (int32_t*)
+	              lanczos_workspace_calloc(ws, self->bins_size,
+	                                       sizeof(int32_t));
+	self->vk    = (float*)
+	              lanczos_workspace_calloc(ws, self->vk_size,
+	                                       sizeof(float));
+	self->holes = (float*)
+	              lanczos_workspace_calloc(ws,
+	                                       self->vk_size*stride,
+	                                       sizeof(float));
+	if((self->start == NULL) || (self->end   == NULL) ||
+	   (self->vk    == NULL) || (self->holes == NULL))
+	{
+		LOGE("CALLOC failed");
+		lanczos_irregularSorted_discard(self, ws);
+		return 0;
+	}
+
+	return 1;
+}
+
+static float
+lanczos_resample_sortedDensity1D(lanczos_paramIrregular1D_t* param,
+                                 lanczos_kernel_t* kernel,
+                                 lanczos_irregularSorted_t* sorted,
+                                 int32_t bin_count, int32_t ja)
+{
+	ASSERT(param);
+	ASSERT(kernel);
+	ASSERT(sorted);
+
+	int32_t a          = param->a;
+	size_t  src_stride = 1 + param->channels;
+	int32_t m0         = (ja - a < 0) ? 0 : ja - a;
+	int32_t m1         = (ja + a >= bin_count) ?
+	                     bin_count - 1 : ja + a;
+
+	// sum the kernel in bin order as in
+	// lanczos_resample_density1D where an empty bin holds a
+	// hole at the bin center
+	int32_t k;
+	int32_t k0;
+	int32_t k1;
+	int32_t m;
+	float   c   = ((float) (ja - a)) + 0.5f;
+	float   sum = 0.0f;
+	float   jf;
+	for(m = m0; m <= m1; ++m)
+	{
+		k0 = sorted->start[m%sorted->bins_size];
+		k1 = sorted->end[m%sorted->bins_size];
+		if(k0 == k1)
+		{
+			jf   = ((float) (m - a)) + 0.5f;
+			sum += lanczos_kernel_eval(kernel, jf - c);
+			continue;
+		}
+
+		for(k = k0; k < k1; ++k)
+		{
+			jf   = lanczos_resample_jf1D(param,
+			                             param->src[src_stride*k]);
+			sum += lanczos_kernel_eval(kernel, jf - c);
+		}
+	}
+
+	if(fabsf(sum) > LANCZOS_IRREGULAR_EPSILON)
+	{
+		return 1.0f/sum;
+	}
+	return 0.0f;
+}
+
+static int
+lanczos_resample_sorted1D(lanczos_paramIrregular1D_t* param,
+                          int32_t bin_count)
+{
+	ASSERT(param);
+
+	int32_t a          = param->a;
+	int32_t channels   = param->channels;
+	size_t  src_stride = 1 + channels;
+
+	lanczos_kernel_t kernel;
+	if(lanczos_kernel_init(&kernel, param->flags, a) == 0)
+	{
+		return 0;
+	}
+
+	lanczos_irregularSorted_t sorted = { 0 };
+	if(lanczos_irregularSorted_init(&sorted, param) == 0)
+	{
+		return 0;
+	}
+
+	// The step s finds the samples of bin s with a single
+	// forward pointer, fills the hole and computes the
+	// density of bin s - a (whose support and the next
+	// populated bin within the support radius are known)
+	// and resamples the output s - 3a whose support window
+	// is the contiguous range of samples of the bins
+	// [s - 3a, s - a].
+	int32_t      ch;
+	int32_t      h;
+	int32_t      i     = 0;
+	int32_t      j;
+	int32_t      k;
+	int32_t      k0;
+	int32_t      k1;
+	int32_t      m;
+	int32_t      r;
+	int32_t      s;
+	int32_t      steps = bin_count + 3*a;
+	int32_t      R     = sorted.bins_size;
+	int32_t      V     = sorted.vk_size;
+	float        x0    = param->src_x0;
+	float        x1    = param->src_x1;
+	float        n2    = param->dst_w;
+	float        c;
+	float        jf;
+	float        w;
+	float        wj;
+	float*       dat;
+	float*       s2;
+	const float* s1;
+	const float* x0p   = NULL;
+	const float* x1p;
+	for(s = 0; s < steps; ++s)
+	{
+		// find the bin boundaries where floor(jf) + a < s is
+		// equivalent to jf < s - a and the samples outside of
+		// the bin range are skipped
+		if(s < bin_count)
+		{
+			r = s%R;
+			while((i < param->src_count) &&
+			      (lanczos_resample_jf1D(param,
+			                             param->src[src_stride*i]) <
+			       (float) (s - a)))
+			{
+				++i;
+			}
+			sorted.start[r] = i;
+
+			while((i < param->src_count) &&
+			      (lanczos_resample_jf1D(param,
+			                             param->src[src_stride*i]) <
+			       (float) (s + 1 - a)))
+			{
+				++i;
+			}
+			sorted.end[r] = i;
+		}
+
+		// fill the holes as in lanczos_resample_holePass1D
+		// where the extreme samples of a bin are its first
+		// and last samples
+		h = s - a;
+		if((h >= 0) && (h < bin_count))
+		{
+			k0 = sorted.start[h%R];
+			k1 = sorted.end[h%R];
+			if(k0 < k1)
+			{
+				x0p = &param->src[src_stride*(k1 - 1)];
+			}
+			else
+			{
+				// compute jf2xi
+				dat    = &sorted.holes[src_stride*(h%V)];
+				jf     = ((float) (h - a)) + 0.5f;
+				dat[0] = x0 + (x1 - x0)*jf/n2;
+
+				// next populated bin within the support radius
+				x1p = NULL;
+				for(m = h + 1; m <= h + a; ++m)
+				{
+					if(m >= bin_count)
+					{
+						break;
+					}
+
+					k0 = sorted.start[m%R];
+					if(k0 < sorted.end[m%R])
+					{
+						x1p = &param->src[src_stride*k0];
+						break;
+					}
+				}
+
+				lanczos_resample_fillHole1D(param, dat, x0p, x1p);
+				x0p = dat;
+			}
+
+			// Density Compensation
+			sorted.vk[h%V] =
+				lanczos_resample_sortedDensity1D(param, &kernel,
+				                                 &sorted,
+				                                 bin_count, h);
+		}
+
+		// Irregular Interpolation and Normalization
+		// output j is the center of bin j + a
+		j = s - 3*a;
+		if((j < 0) || (j >= param->dst_w))
+		{
+			continue;
+		}
+
+		s2 = &param->dst[channels*j];
+		for(ch = 0; ch < channels; ++ch)
+		{
+			s2[ch] = 0.0f;
+		}
+
+		c  = ((float) j) + 0.5f;
+		wj = 0.0f;
+		for(m = j; m <= j + 2*a; ++m)
+		{
+			k0 = sorted.start[m%R];
+			k1 = sorted.end[m%R];
+			if(k0 == k1)
+			{
+				s1  = &sorted.holes[src_stride*(m%V)];
+				jf  = ((float) (m - a)) + 0.5f;
+				w   = sorted.vk[m%V]*
+				      lanczos_kernel_eval(&kernel, jf - c);
+				wj += w;
+				for(ch = 0; ch < channels; ++ch)
+				{
+					s2[ch] += w*s1[ch + 1];
+				}
+				continue;
+			}
+
+			for(k = k0; k < k1; ++k)
+			{
+				s1  = &param->src[src_stride*k];
+				jf  = lanczos_resample_jf1D(param, s1[0]);
+				w   = sorted.vk[m%V]*
+				      lanczos_kernel_eval(&kernel, jf - c);
+				wj += w;
+				for(ch = 0; ch < channels; ++ch)
+				{
+					s2[ch] += w*s1[ch + 1];
+				}
+			}
+		}
+
+		w = 0.0f;
+		if(fabsf(wj) > LANCZOS_IRREGULAR_EPSILON)
+		{
+			w = 1.0f/wj;
+		}
+
+		for(ch = 0; ch < channels; ++ch)
+		{
+			s2[ch] *= w;
+		}
+	}
+
+	lanczos_irregularSorted_discard(&sorted, param->ws);
+
+	return 1;
+}
+
+static int
+lanczos_resample_binning1D(lanczos_paramIrregular1D_t* param,
+                           int32_t bin_count)
+{
+	ASSERT(param);
+
+	lanczos_irregularState_t state = { 0 };
+	if(lanczos_irregularState_init(&state, param->ws,
+	                               bin_count) == 0)
+	{
+		return 0;
+	}
+
+	if((lanczos_resample_binningPass1D(param, &state) == 0) ||
+	   (lanczos_resample_holePass1D(param, &state) == 0)    ||
+	   (lanczos_resample_resamplePass1D(param, &state) == 0))
+	{
+		goto failure;
+	}
 
 	lanczos_irregularState_discard(&state);
 
@@ -626,12 +1375,482 @@ int lanczos_resample_irregular1D(lanczos_paramIrregular1D_t* param)
 	return 0;
 }
 
+/*
+ * public
+ */
+
+int lanczos_resample_regular1D(lanczos_paramRegular1D_t* param)
+{
+	ASSERT(param);
+	ASSERT(param->src);
+	ASSERT(param->dst);
+
+	if((param->format < LANCZOS_FORMAT_FLOAT32) ||
+	   (param->format > LANCZOS_FORMAT_BFLOAT16))
+	{
+		LOGE("invalid format=%i", param->format);
+		return 0;
+	}
+
+	size_t mark = lanczos_workspace_mark(param->ws);
+
+	lanczos_plan1D_t* plan;
+	if(param->cache)
+	{
+		plan = lanczos_planCache_acquire(param->cache,
+		                                 param->flags, param->a,
+		                                 param->src_w,
+		                                 param->dst_w);
+	}
+	else
+	{
+		plan = lanczos_plan1D_new(param->ws, param->flags,
+		                          param->a, param->src_w,
+		                          param->dst_w);
+	}
+
+	if(plan == NULL)
+	{
+		lanczos_workspace_reset(param->ws, mark);
+		return 0;
+	}
+
+	int ret = 0;
+	if(param->format == LANCZOS_FORMAT_FLOAT32)
+	{
+		ret = lanczos_plan1D_execute(plan, param->channels,
+		                             param->src, param->dst);
+	}
+	else if((param->format == LANCZOS_FORMAT_FLOAT16) ||
+	        (param->format == LANCZOS_FORMAT_BFLOAT16))
+	{
+		ret = lanczos_plan1D_executeHalf(plan, param->ws,
+		                                 param->format,
+		                                 param->channels,
+		                                 param->src, param->dst);
+	}
+	else
+	{
+		lanczos_planFixed1D_t* fixed;
+		fixed = lanczos_planFixed1D_new(param->ws, plan,
+		                                param->format);
+		if(fixed)
+		{
+			lanczos_planFixed1D_execute(fixed, param->channels,
+			                            param->src, param->dst);
+			lanczos_planFixed1D_delete(&fixed);
+			ret = 1;
+		}
+	}
+
+	if(param->cache)
+	{
+		lanczos_planCache_release(param->cache, &plan);
+	}
+	else
+	{
+		lanczos_plan1D_delete(&plan);
+	}
+
+	lanczos_workspace_reset(param->ws, mark);
+
+	return ret;
+}
+
+int lanczos_resample_regular2D(lanczos_paramRegular2D_t* param)
+{
+	ASSERT(param);
+	ASSERT(param->src);
+	ASSERT(param->dst);
+
+	if((param->format < LANCZOS_FORMAT_FLOAT32) ||
+	   (param->format > LANCZOS_FORMAT_BFLOAT16))
+	{
+		LOGE("invalid format=%i", param->format);
+		return 0;
+	}
+
+	size_t mark = lanczos_workspace_mark(param->ws);
+
+	int ret = 0;
+	if((param->format == LANCZOS_FORMAT_UINT8) ||
+	   (param->format == LANCZOS_FORMAT_UINT16))
+	{
+		lanczos_planFixed2D_t* fixed;
+		fixed = lanczos_planFixed2D_new(param->cache, param->ws,
+		                                param->flags, param->a,
+		                                param->format,
+		                                param->src_w, param->src_h,
+		                                param->dst_w, param->dst_h);
+		if(fixed)
+		{
+			ret = lanczos_planFixed2D_execute(fixed, param->pool,
+			                                  param->channels,
+			                                  param->src,
+			                                  param->dst);
+			lanczos_planFixed2D_delete(&fixed);
+		}
+
+		lanczos_workspace_reset(param->ws, mark);
+
+		return ret;
+	}
+	else if(param->flags & LANCZOS_FLAG_MULTIDIM_2D_ISOTROPIC)
+	{
+		if(param->format != LANCZOS_FORMAT_FLOAT32)
+		{
+			LOGE("invalid format=%i, flags=0x%X",
+			     param->format, param->flags);
+			return 0;
+		}
+
+		lanczos_planRadial_t* radial;
+		radial = lanczos_planRadial_new(param->ws, param->flags,
+		                                param->a,
+		                                param->src_w, param->src_h,
+		                                param->dst_w, param->dst_h);
+		if(radial)
+		{
+			ret = lanczos_planRadial_execute(radial, param->pool,
+			                                 param->channels,
+			                                 param->src,
+			                                 param->dst);
+			lanczos_planRadial_delete(&radial);
+		}
+
+		lanczos_workspace_reset(param->ws, mark);
+
+		return ret;
+	}
+
+	// 2D Separable (default)
+	lanczos_plan2D_t* plan;
+	plan = lanczos_plan2D_new(param->cache, param->ws,
+	                          param->flags, param->a,
+	                          param->src_w, param->src_h,
+	                          param->dst_w, param->dst_h);
+	if(plan)
+	{
+		if(param->format == LANCZOS_FORMAT_FLOAT32)
+		{
+			ret = lanczos_plan2D_execute(plan, param->pool,
+			                             param->channels,
+			                             param->src, param->dst);
+		}
+		else
+		{
+			ret = lanczos_plan2D_executeHalf(plan, param->pool,
+			                                 param->format,
+			                                 param->channels,
+			                                 param->src,
+			                                 param->dst);
+		}
+		lanczos_plan2D_delete(&plan);
+	}
+
+	lanczos_workspace_reset(param->ws, mark);
+
+	return ret;
+}
+
+int lanczos_resample_irregular1D(lanczos_paramIrregular1D_t* param)
+{
+	ASSERT(param);
+	ASSERT(param->src);
+	ASSERT(param->dst);
+
+	size_t mark = lanczos_workspace_mark(param->ws);
+
+	int32_t bin_count = param->dst_w + 2*param->a;
+
+	// the scatter engine is cheaper for dense inputs since
+	// it avoids binning the samples and is parallel while
+	// sorted inputs are already in bin order
+	int ret;
+	int dense = param->src_count >=
+	            LANCZOS_IRREGULAR_SCATTER_DENSITY*param->dst_w;
+	if(dense && (lanczos_pool_threads(param->pool) > 1))
+	{
+		ret = lanczos_resample_scatter1D(param, bin_count);
+	}
+	else if(lanczos_resample_isSorted1D(param))
+	{
+		ret = lanczos_resample_sorted1D(param, bin_count);
+	}
+	else if(dense)
+	{
+		ret = lanczos_resample_scatter1D(param, bin_count);
+	}
+	else
+	{
+		ret = lanczos_resample_binning1D(param, bin_count);
+	}
+
+	lanczos_workspace_reset(param->ws, mark);
+
+	return ret;
+}
+
 int lanczos_resample_irregular2D(lanczos_paramIrregular2D_t* param)
 {
 	ASSERT(param);
 	ASSERT(param->src);
 	ASSERT(param->dst);
 
-	// TODO - lanczos_resample_irregular2D
-	return 0;
+	size_t mark = lanczos_workspace_mark(param->ws);
+
+	int ret = 0;
+	lanczos_grid2D_t* grid = lanczos_grid2D_new(param);
+	if(grid)
+	{
+		ret = lanczos_grid2D_resample(grid, param);
+		lanczos_grid2D_delete(&grid);
+	}
+
+	lanczos_workspace_reset(param->ws, mark);
+
+	return ret;
+}
+
+int lanczos_resample_raster2D(lanczos_paramRaster2D_t* param)
+{
+	ASSERT(param);
+
+	lanczos_raster2D_t* raster = lanczos_raster2D_new(param);
+	if(raster == NULL)
+	{
+		return 0;
+	}
+
+	int ret = lanczos_raster2D_resample(raster);
+	lanczos_raster2D_delete(&raster);
+
+	return ret;
+}
+
+size_t
+lanczos_resample_regular1DWorkspace(lanczos_paramRegular1D_t* param)
+{
+	ASSERT(param);
+
+	// cached plans are allocated from the heap and the
+	// plan execution is allocation free
+	if(param->cache &&
+	   (param->format == LANCZOS_FORMAT_FLOAT32))
+	{
+		return 0;
+	}
+
+	// measure the plan construction
+	lanczos_workspace_t ws;
+	lanczos_workspace_init(&ws, NULL, 0);
+
+	lanczos_plan1D_t* plan;
+	if(param->cache)
+	{
+		plan = lanczos_planCache_acquire(param->cache,
+		                                 param->flags, param->a,
+		                                 param->src_w,
+		                                 param->dst_w);
+	}
+	else
+	{
+		plan = lanczos_plan1D_new(&ws, param->flags, param->a,
+		                          param->src_w, param->dst_w);
+	}
+
+	if(plan == NULL)
+	{
+		return 0;
+	}
+
+	// measure the fixed-point plan construction or add the
+	// conversion scratch buffers
+	if((param->format == LANCZOS_FORMAT_UINT8) ||
+	   (param->format == LANCZOS_FORMAT_UINT16))
+	{
+		lanczos_planFixed1D_t* fixed;
+		fixed = lanczos_planFixed1D_new(&ws, plan,
+		                                param->format);
+		lanczos_planFixed1D_delete(&fixed);
+	}
+	else if(param->format != LANCZOS_FORMAT_FLOAT32)
+	{
+		ws.offset += lanczos_plan1D_workspaceHalf(plan,
+		                                          param->channels);
+	}
+
+	if(param->cache)
+	{
+		lanczos_planCache_release(param->cache, &plan);
+	}
+	else
+	{
+		lanczos_plan1D_delete(&plan);
+	}
+
+	return lanczos_workspace_size(ws.offset);
+}
+
+size_t
+lanczos_resample_regular2DWorkspace(lanczos_paramRegular2D_t* param)
+{
+	ASSERT(param);
+
+	// measure the plan construction and add the execution
+	// scratch buffers
+	lanczos_workspace_t ws;
+	lanczos_workspace_init(&ws, NULL, 0);
+
+	if((param->format == LANCZOS_FORMAT_UINT8) ||
+	   (param->format == LANCZOS_FORMAT_UINT16))
+	{
+		lanczos_planFixed2D_t* fixed;
+		fixed = lanczos_planFixed2D_new(param->cache, &ws,
+		                                param->flags, param->a,
+		                                param->format,
+		                                param->src_w, param->src_h,
+		                                param->dst_w, param->dst_h);
+		if(fixed == NULL)
+		{
+			return 0;
+		}
+
+		ws.offset += lanczos_planFixed2D_workspace(fixed,
+		                                           param->pool,
+		                                           param->channels);
+		lanczos_planFixed2D_delete(&fixed);
+
+		return lanczos_workspace_size(ws.offset);
+	}
+	else if(param->flags & LANCZOS_FLAG_MULTIDIM_2D_ISOTROPIC)
+	{
+		lanczos_planRadial_t* radial;
+		radial = lanczos_planRadial_new(&ws, param->flags,
+		                                param->a,
+		                                param->src_w, param->src_h,
+		                                param->dst_w, param->dst_h);
+		if(radial == NULL)
+		{
+			return 0;
+		}
+
+		ws.offset += lanczos_planRadial_workspace(radial,
+		                                          param->pool);
+		lanczos_planRadial_delete(&radial);
+
+		return lanczos_workspace_size(ws.offset);
+	}
+
+	lanczos_plan2D_t* plan;
+	plan = lanczos_plan2D_new(param->cache, &ws,
+	                          param->flags, param->a,
+	                          param->src_w, param->src_h,
+	                          param->dst_w, param->dst_h);
+	if(plan == NULL)
+	{
+		return 0;
+	}
+
+	if(param->format == LANCZOS_FORMAT_FLOAT32)
+	{
+		ws.offset += lanczos_plan2D_workspace(plan, param->pool,
+		                                      param->channels);
+	}
+	else
+	{
+		ws.offset += lanczos_plan2D_workspaceHalf(plan,
+		                                          param->pool,
+		                                          param->channels);
+	}
+	lanczos_plan2D_delete(&plan);
+
+	return lanczos_workspace_size(ws.offset);
+}
+
+size_t
+lanczos_resample_irregular1DWorkspace(lanczos_paramIrregular1D_t* param)
+{
+	ASSERT(param);
+
+	// upper bound of the binning, sorted and scatter paths
+	// where each bin holds at most one hole
+	size_t  bin_count = param->dst_w + 2*param->a;
+	size_t  count     = param->src_count + bin_count;
+	size_t  stride    = 1 + param->channels;
+	size_t  n         = lanczos_pool_threads(param->pool)*
+	                    bin_count;
+	size_t  binning;
+	size_t  sorted;
+	size_t  scatter;
+
+	binning = lanczos_workspace_bytes(bin_count + 1,
+	                                  sizeof(int32_t)) +
+	          lanczos_workspace_bytes(bin_count, sizeof(float)) +
+	          lanczos_workspace_bytes(count, sizeof(int32_t)) +
+	          lanczos_workspace_bytes(count, sizeof(float)) +
+	          lanczos_workspace_bytes(bin_count*stride,
+	                                  sizeof(float));
+
+	sorted = 2*lanczos_workspace_bytes(3*param->a + 1,
+	                                   sizeof(int32_t)) +
+	         lanczos_workspace_bytes(2*param->a + 1,
+	                                 sizeof(float)) +
+	         lanczos_workspace_bytes((2*param->a + 1)*stride,
+	                                 sizeof(float));
+
+	scatter = 3*lanczos_workspace_bytes(n, sizeof(int32_t)) +
+	          lanczos_workspace_bytes(n, sizeof(float)) +
+	          lanczos_workspace_bytes(n*param->channels,
+	                                  sizeof(float)) +
+	          lanczos_workspace_bytes(bin_count, sizeof(float)) +
+	          lanczos_workspace_bytes(bin_count*stride,
+	                                  sizeof(float));
+
+	size_t size = binning;
+	if(sorted > size)
+	{
+		size = sorted;
+	}
+	if(scatter > size)
+	{
+		size = scatter;
+	}
+	return lanczos_workspace_size(size);
+}
+
+size_t
+lanczos_resample_irregular2DWorkspace(lanczos_paramIrregular2D_t* param)
+{
+	ASSERT(param);
+
+	// upper bound of the grid where each cell holds at most
+	// one hole
+	size_t cells  = (param->dst_w + 2*param->a)*
+	                (param->dst_h + 2*param->a);
+	size_t stride = 2 + param->channels;
+	size_t size;
+
+	size = lanczos_workspace_bytes(1, sizeof(lanczos_grid2D_t)) +
+	       lanczos_workspace_bytes(cells + 1, sizeof(int32_t)) +
+	       lanczos_workspace_bytes(cells, sizeof(float)) +
+	       lanczos_workspace_bytes(cells*stride, sizeof(float));
+
+	if(param->flags & LANCZOS_FLAG_INDEX_ADAPTIVE)
+	{
+		size_t count = param->src_count;
+		size += lanczos_workspace_bytes(count, sizeof(int32_t)) +
+		        lanczos_workspace_bytes(2*count, sizeof(float)) +
+		        lanczos_workspace_bytes(count, sizeof(int32_t)) +
+		        lanczos_workspace_bytes(cells, sizeof(int32_t)) +
+		        lanczos_kdtree2D_workspace(param->src_count);
+	}
+	else
+	{
+		size_t count = param->src_count + cells;
+		size += lanczos_workspace_bytes(count, sizeof(int32_t)) +
+		        lanczos_workspace_bytes(2*count, sizeof(float));
+	}
+
+	return lanczos_workspace_size(size);
 }
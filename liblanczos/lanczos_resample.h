@@ -26,6 +26,10 @@
 
 #include <stdint.h>
 
+#include "lanczos_planCache.h"
+#include "lanczos_pool.h"
+#include "lanczos_workspace.h"
+
 // Edge Handling
 // default: CLAMPING
 #define LANCZOS_FLAG_EDGE_ZERO_PADDING 0x0001
@@ -43,6 +47,49 @@
 #define LANCZOS_FLAG_NODATA_LINEAR   0x0400
 #define LANCZOS_FLAG_NODATA_MASK     0x0700
 
+// SIMD Kernels
+// default: best SIMD kernels supported by the CPU
+// SCALAR selects the scalar reference kernels
+#define LANCZOS_FLAG_SCALAR 0x1000
+
+// Kernel Evaluation
+// default: exact kernel
+// KERNEL_LUT evaluates the kernel from a table with 1024
+// entries per unit (or 4096 entries per unit for
+// KERNEL_LUT_4096) using linear (or cubic for
+// KERNEL_LUT_CUBIC) interpolation
+// see lanczos_kernel.h for the maximum error
+#define LANCZOS_FLAG_KERNEL_LUT       0x2000
+#define LANCZOS_FLAG_KERNEL_LUT_4096  0x4000
+#define LANCZOS_FLAG_KERNEL_LUT_CUBIC 0x8000
+
+// Irregular 2D Spatial Index
+// default: uniform grid of cells
+// INDEX_ADAPTIVE selects a k-d tree whose query time does
+// not depend on the clustering of the samples
+#define LANCZOS_FLAG_INDEX_ADAPTIVE 0x10000
+
+// Irregular 1D Source Order
+// default: detected by an O(n) check
+// SRC_SORTED asserts that the samples are sorted by x such
+// that they are resampled in place without binning
+#define LANCZOS_FLAG_SRC_SORTED 0x20000
+
+// Sample Formats (regular data)
+// default: FLOAT32
+// UINT8 and UINT16 samples are resampled with fixed-point
+// coefficients and integer accumulation where the outputs
+// are rounded and clamped to the range of the format
+// see lanczos_planFixed1D.h for the precision
+// FLOAT16 (IEEE half) and BFLOAT16 samples are converted to
+// float as they are loaded, accumulated in float and
+// rounded to nearest even as they are stored
+#define LANCZOS_FORMAT_FLOAT32  0
+#define LANCZOS_FORMAT_UINT8    1
+#define LANCZOS_FORMAT_UINT16   2
+#define LANCZOS_FORMAT_FLOAT16  3
+#define LANCZOS_FORMAT_BFLOAT16 4
+
 typedef struct
 {
 	uint32_t flags;
@@ -50,8 +97,17 @@ typedef struct
 	int32_t  channels;
 	int32_t  src_w;
 	int32_t  dst_w;
-	float*   src; // n=src_w*channels
-	float*   dst; // n=dst_w*channels
+	void*    src; // n=src_w*channels
+	void*    dst; // n=dst_w*channels
+
+	// optional plan cache
+	lanczos_planCache_t* cache;
+
+	// optional workspace
+	lanczos_workspace_t* ws;
+
+	// optional sample format of src and dst
+	int32_t format;
 } lanczos_paramRegular1D_t;
 
 typedef struct
@@ -63,8 +119,21 @@ typedef struct
 	int32_t  src_h;
 	int32_t  dst_w;
 	int32_t  dst_h;
-	float* src; // n=src_w*src_h*channels
-	float* dst; // n=dst_w*dst_h*channels
+	void*    src; // n=src_w*src_h*channels
+	void*    dst; // n=dst_w*dst_h*channels
+
+	// optional plan cache
+	lanczos_planCache_t* cache;
+
+	// optional thread pool
+	lanczos_pool_t* pool;
+
+	// optional workspace
+	lanczos_workspace_t* ws;
+
+	// optional sample format of src and dst
+	// (2D separable only)
+	int32_t format;
 } lanczos_paramRegular2D_t;
 
 typedef struct
@@ -78,6 +147,12 @@ typedef struct
 	int32_t  dst_w;
 	float*   src; // n=src_count*(1 + channels) : {x,val}
 	float*   dst; // n=dst_w*channels
+
+	// optional thread pool
+	lanczos_pool_t* pool;
+
+	// optional workspace
+	lanczos_workspace_t* ws;
 } lanczos_paramIrregular1D_t;
 
 typedef struct
@@ -94,11 +169,63 @@ typedef struct
 	int32_t  dst_h;
 	float*   src; // n=src_count*(2+channels) : {x,y,val}
 	float*   dst; // n=dst_w*dst_h*channels
+
+	// optional thread pool
+	lanczos_pool_t* pool;
+
+	// optional workspace
+	lanczos_workspace_t* ws;
 } lanczos_paramIrregular2D_t;
 
+// I/O statistics of lanczos_resample_raster2D
+typedef struct
+{
+	int32_t  tiles;
+	uint64_t src_bytes; // source footprint of the tiles
+	uint64_t dst_bytes;
+	double   seconds;
+} lanczos_raster2DStats_t;
+
+// raw rasters of float samples (row-major, interleaved
+// channels) which may be larger than memory
+typedef struct
+{
+	uint32_t    flags;
+	int32_t     a;
+	int32_t     channels;
+	int32_t     src_w;
+	int32_t     src_h;
+	int32_t     dst_w;
+	int32_t     dst_h;
+	const char* src_fname;
+	const char* dst_fname;
+
+	// optional tile size
+	int32_t tile_w;
+	int32_t tile_h;
+
+	// optional plan cache
+	lanczos_planCache_t* cache;
+
+	// optional thread pool
+	lanczos_pool_t* pool;
+
+	// optional I/O statistics
+	lanczos_raster2DStats_t* stats;
+} lanczos_paramRaster2D_t;
+
 int lanczos_resample_regular1D(lanczos_paramRegular1D_t* param);
 int lanczos_resample_regular2D(lanczos_paramRegular2D_t* param);
 int lanczos_resample_irregular1D(lanczos_paramIrregular1D_t* param);
 int lanczos_resample_irregular2D(lanczos_paramIrregular2D_t* param);
+int lanczos_resample_raster2D(lanczos_paramRaster2D_t* param);
+
+// workspace size required by a resampling call (e.g. the
+// size of param->ws) for the param geometry, flags, cache
+// and pool
+size_t lanczos_resample_regular1DWorkspace(lanczos_paramRegular1D_t* param);
+size_t lanczos_resample_regular2DWorkspace(lanczos_paramRegular2D_t* param);
+size_t lanczos_resample_irregular1DWorkspace(lanczos_paramIrregular1D_t* param);
+size_t lanczos_resample_irregular2DWorkspace(lanczos_paramIrregular2D_t* param);
 
 #endif
@@ -0,0 +1,1511 @@
+/*
+ * Copyright (c) 2025 Jeff Boody
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included
+ * in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+
+#include <pthread.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define LOG_TAG "lanczos"
+#include "../../libcc/cc_log.h"
+#include "lanczos_resample.h"
+#include "lanczos_simd.h"
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+	#define LANCZOS_SIMD_X86
+	#include <immintrin.h>
+#endif
+
+typedef void (*lanczos_simd_horizontalFn)(lanczos_plan1D_t* plan,
+                                          const float* s1,
+                                          float* s2,
+                                          int32_t ja,
+                                          int32_t jb);
+
+typedef void (*lanczos_simd_verticalFn)(int32_t n, int32_t taps,
+                                        const float* coef,
+                                        const float** s1,
+                                        float* s2);
+
+typedef void (*lanczos_simd_horizontalU8Fn)(lanczos_planFixed1D_t* plan,
+                                            const uint8_t* s1,
+                                            int16_t* s2,
+                                            int32_t ja,
+                                            int32_t jb);
+
+typedef void (*lanczos_simd_verticalU8Fn)(int32_t n, int32_t taps,
+                                          const int16_t* coef,
+                                          const int16_t** s1,
+                                          uint8_t* s2);
+
+typedef void (*lanczos_simd_loadHalfFn)(int32_t n,
+                                        const uint16_t* src,
+                                        float* dst);
+
+typedef void (*lanczos_simd_storeHalfFn)(int32_t n,
+                                         const float* src,
+                                         uint16_t* dst);
+
+typedef struct
+{
+	int level;
+
+	// indexed by the channel count minus one
+	lanczos_simd_horizontalFn horizontal[4];
+	lanczos_simd_verticalFn   vertical;
+
+	// fixed-point kernels (UINT8)
+	lanczos_simd_horizontalU8Fn horizontalU8[4];
+	lanczos_simd_verticalU8Fn   verticalU8;
+
+	// conversion kernels (FLOAT16 and BFLOAT16)
+	lanczos_simd_loadHalfFn  loadF16;
+	lanczos_simd_storeHalfFn storeF16;
+	lanczos_simd_loadHalfFn  loadBF16;
+	lanczos_simd_storeHalfFn storeBF16;
+} lanczos_simd_t;
+
+static pthread_once_t lanczos_simd_once = PTHREAD_ONCE_INIT;
+static lanczos_simd_t lanczos_simd;
+
+/*
+ * scalar
+ */
+
+static void
+lanczos_simd_verticalScalar(int32_t n, int32_t taps,
+                            const float* coef,
+                            const float** s1, float* s2)
+{
+	ASSERT(coef);
+	ASSERT(s1);
+	ASSERT(s2);
+
+	int32_t x;
+	int32_t k;
+	float   sum;
+	for(x = 0; x < n; ++x)
+	{
+		sum = 0.0f;
+		for(k = 0; k < taps; ++k)
+		{
+			sum += s1[k][x]*coef[k];
+		}
+		s2[x] = sum;
+	}
+}
+
+static void
+lanczos_simd_verticalU8Tail(int32_t x, int32_t n, int32_t taps,
+                            const int16_t* coef,
+                            const int16_t** s1, uint8_t* s2)
+{
+	ASSERT(coef);
+	ASSERT(s1);
+	ASSERT(s2);
+
+	int32_t shift = LANCZOS_PLANFIXED1D_BITS8 +
+	                LANCZOS_PLANFIXED1D_FRAC8;
+
+	// resamples the outputs [x, n) which remain after the
+	// vector loop
+	int32_t k;
+	int32_t sum;
+	for(; x < n; ++x)
+	{
+		sum = 1 << (shift - 1);
+		for(k = 0; k < taps; ++k)
+		{
+			sum += coef[k]*s1[k][x];
+		}
+		sum >>= shift;
+		sum = (sum < 0) ? 0 : sum;
+		sum = (sum > UINT8_MAX) ? UINT8_MAX : sum;
+		s2[x] = (uint8_t) sum;
+	}
+}
+
+static float lanczos_simd_f16ToFloat(uint16_t h)
+{
+	uint32_t sign = ((uint32_t) (h & 0x8000)) << 16;
+	uint32_t e    = (h >> 10) & 0x1F;
+	uint32_t m    = h & 0x3FF;
+	uint32_t bits = sign;
+	if(e == 0x1F)
+	{
+		// infinity or quiet NaN
+		bits |= 0x7F800000 | (m ? 0x400000 | (m << 13) : 0);
+	}
+	else if(e)
+	{
+		bits |= ((e + 112) << 23) | (m << 13);
+	}
+	else if(m)
+	{
+		// normalize the subnormal
+		e = 113;
+		while((m & 0x400) == 0)
+		{
+			m <<= 1;
+			--e;
+		}
+		bits |= (e << 23) | ((m & 0x3FF) << 13);
+	}
+
+	float f;
+	memcpy(&f, &bits, sizeof(float));
+	return f;
+}
+
+static uint16_t lanczos_simd_floatToF16(float f)
+{
+	uint32_t x;
+	memcpy(&x, &f, sizeof(float));
+
+	uint32_t sign = (x >> 16) & 0x8000;
+	int32_t  e    = (int32_t) ((x >> 23) & 0xFF) - 112;
+	uint32_t m    = x & 0x7FFFFF;
+	if(e == 143)
+	{
+		// infinity or quiet NaN
+		return (uint16_t) (sign | 0x7C00 | (m ? 0x200 | (m >> 13) : 0));
+	}
+	else if(e >= 0x1F)
+	{
+		// overflow
+		return (uint16_t) (sign | 0x7C00);
+	}
+	else if(e < -10)
+	{
+		// underflow
+		return (uint16_t) sign;
+	}
+
+	// round to nearest even where the carry may propagate
+	// into the exponent
+	uint32_t shift = 13;
+	uint32_t h     = (((uint32_t) e) << 10) | (m >> 13);
+	if(e <= 0)
+	{
+		// subnormal
+		m    |= 0x800000;
+		shift = 14 - e;
+		h     = m >> shift;
+	}
+
+	uint32_t rem  = m & ((1 << shift) - 1);
+	uint32_t half = 1 << (shift - 1);
+	if((rem > half) || ((rem == half) && (h & 1)))
+	{
+		++h;
+	}
+	return (uint16_t) (sign | h);
+}
+
+static void
+lanczos_simd_loadF16Scalar(int32_t n, const uint16_t* src,
+                           float* dst)
+{
+	ASSERT(src);
+	ASSERT(dst);
+
+	int32_t x;
+	for(x = 0; x < n; ++x)
+	{
+		dst[x] = lanczos_simd_f16ToFloat(src[x]);
+	}
+}
+
+static void
+lanczos_simd_storeF16Scalar(int32_t n, const float* src,
+                            uint16_t* dst)
+{
+	ASSERT(src);
+	ASSERT(dst);
+
+	int32_t x;
+	for(x = 0; x < n; ++x)
+	{
+		dst[x] = lanczos_simd_floatToF16(src[x]);
+	}
+}
+
+static void
+lanczos_simd_loadBF16Scalar(int32_t n, const uint16_t* src,
+                            float* dst)
+{
+	ASSERT(src);
+	ASSERT(dst);
+
+	// bfloat16 is the upper half of a float
+	int32_t  x;
+	uint32_t bits;
+	for(x = 0; x < n; ++x)
+	{
+		bits = ((uint32_t) src[x]) << 16;
+		memcpy(&dst[x], &bits, sizeof(float));
+	}
+}
+
+static void
+lanczos_simd_storeBF16Scalar(int32_t n, const float* src,
+                             uint16_t* dst)
+{
+	ASSERT(src);
+	ASSERT(dst);
+
+	// round to nearest even and keep NaN quiet
+	int32_t  x;
+	uint32_t bits;
+	for(x = 0; x < n; ++x)
+	{
+		memcpy(&bits, &src[x], sizeof(float));
+		if((bits & 0x7FFFFFFF) > 0x7F800000)
+		{
+			dst[x] = (uint16_t) ((bits >> 16) | 0x40);
+			continue;
+		}
+
+		bits  += 0x7FFF + ((bits >> 16) & 1);
+		dst[x] = (uint16_t) (bits >> 16);
+	}
+}
+
+#ifdef LANCZOS_SIMD_X86
+
+/*
+ * SSE4
+ */
+
+__attribute__((target("sse4.1")))
+static inline float lanczos_simd_hsum128(__m128 v)
+{
+	v = _mm_add_ps(v, _mm_movehl_ps(v, v));
+	v = _mm_add_ss(v, _mm_shuffle_ps(v, v, 0x1));
+	return _mm_cvtss_f32(v);
+}
+
+__attribute__((target("sse4.1")))
+static void
+lanczos_simd_horizontal1SSE4(lanczos_plan1D_t* plan,
+                             const float* s1, float* s2,
+                             int32_t ja, int32_t jb)
+{
+	ASSERT(plan);
+
+	int32_t      j;
+	int32_t      k;
+	int32_t      taps = plan->taps;
+	int32_t      n4   = taps & ~3;
+	int32_t      r    = ja%plan->phases;
+	int32_t      base = (ja/plan->phases)*plan->step;
+	float        sum;
+	__m128       acc;
+	const float* coef;
+	const float* src;
+	for(j = ja; j < jb; ++j)
+	{
+		coef = &plan->coef[r*taps];
+		src  = &s1[base + plan->first[r]];
+		acc  = _mm_setzero_ps();
+		for(k = 0; k < n4; k += 4)
+		{
+			acc = _mm_add_ps(acc,
+			                 _mm_mul_ps(_mm_loadu_ps(&src[k]),
+			                            _mm_loadu_ps(&coef[k])));
+		}
+
+		sum = lanczos_simd_hsum128(acc);
+		for(; k < taps; ++k)
+		{
+			sum += src[k]*coef[k];
+		}
+		s2[j - ja] = sum;
+
+		++r;
+		if(r == plan->phases)
+		{
+			r     = 0;
+			base += plan->step;
+		}
+	}
+}
+
+__attribute__((target("sse4.1")))
+static void
+lanczos_simd_horizontal4SSE4(lanczos_plan1D_t* plan,
+                             const float* s1, float* s2,
+                             int32_t ja, int32_t jb)
+{
+	ASSERT(plan);
+
+	int32_t      j;
+	int32_t      k;
+	int32_t      taps = plan->taps;
+	int32_t      r    = ja%plan->phases;
+	int32_t      base = (ja/plan->phases)*plan->step;
+	__m128       acc;
+	const float* coef;
+	const float* src;
+	for(j = ja; j < jb; ++j)
+	{
+		coef = &plan->coef[r*taps];
+		src  = &s1[4*(base + plan->first[r])];
+		acc  = _mm_setzero_ps();
+		for(k = 0; k < taps; ++k)
+		{
+			acc = _mm_add_ps(acc,
+			                 _mm_mul_ps(_mm_loadu_ps(&src[4*k]),
+			                            _mm_set1_ps(coef[k])));
+		}
+		_mm_storeu_ps(&s2[4*(j - ja)], acc);
+
+		++r;
+		if(r == plan->phases)
+		{
+			r     = 0;
+			base += plan->step;
+		}
+	}
+}
+
+__attribute__((target("sse4.1")))
+static void
+lanczos_simd_verticalSSE4(int32_t n, int32_t taps,
+                          const float* coef,
+                          const float** s1, float* s2)
+{
+	ASSERT(coef);
+	ASSERT(s1);
+	ASSERT(s2);
+
+	int32_t x;
+	int32_t k;
+	__m128  acc;
+	for(x = 0; x + 4 <= n; x += 4)
+	{
+		acc = _mm_setzero_ps();
+		for(k = 0; k < taps; ++k)
+		{
+			acc = _mm_add_ps(acc,
+			                 _mm_mul_ps(_mm_loadu_ps(&s1[k][x]),
+			                            _mm_set1_ps(coef[k])));
+		}
+		_mm_storeu_ps(&s2[x], acc);
+	}
+
+	float sum;
+	for(; x < n; ++x)
+	{
+		sum = 0.0f;
+		for(k = 0; k < taps; ++k)
+		{
+			sum += s1[k][x]*coef[k];
+		}
+		s2[x] = sum;
+	}
+}
+
+__attribute__((target("sse4.1")))
+static inline __m128i
+lanczos_simd_pairU8SSE4(const int16_t* coef, int32_t k)
+{
+	// broadcast the coefficients {coef[k], coef[k + 1]} to
+	// the int16 pairs of _mm_madd_epi16
+	return _mm_set1_epi32((int32_t) (((uint32_t) (uint16_t) coef[k]) |
+	                                 (((uint32_t) (uint16_t) coef[k + 1]) << 16)));
+}
+
+__attribute__((target("sse4.1")))
+static void
+lanczos_simd_horizontalU8x1SSE4(lanczos_planFixed1D_t* plan,
+                                const uint8_t* s1, int16_t* s2,
+                                int32_t ja, int32_t jb)
+{
+	ASSERT(plan);
+
+	int32_t shift = LANCZOS_PLANFIXED1D_BITS8 -
+	                LANCZOS_PLANFIXED1D_FRAC8;
+	int32_t round = 1 << (shift - 1);
+
+	int32_t        j;
+	int32_t        k;
+	int32_t        count;
+	int32_t        sum;
+	int32_t        p4;
+	__m128i        acc;
+	const int16_t* coef;
+	const uint8_t* src;
+	for(j = ja; j < jb; ++j)
+	{
+		count = plan->count[j];
+		coef  = &plan->coef16[j*plan->taps];
+		src   = &s1[plan->first[j]];
+		acc   = _mm_setzero_si128();
+		for(k = 0; k + 8 <= count; k += 8)
+		{
+			acc = _mm_add_epi32(acc,
+			                    _mm_madd_epi16(_mm_cvtepu8_epi16(_mm_loadl_epi64((const __m128i*) &src[k])),
+			                                   _mm_loadu_si128((const __m128i*) &coef[k])));
+		}
+
+		if(k + 4 <= count)
+		{
+			memcpy(&p4, &src[k], sizeof(int32_t));
+			acc = _mm_add_epi32(acc,
+			                    _mm_mullo_epi32(_mm_cvtepu8_epi32(_mm_cvtsi32_si128(p4)),
+			                                    _mm_cvtepi16_epi32(_mm_loadl_epi64((const __m128i*) &coef[k]))));
+			k += 4;
+		}
+
+		acc = _mm_add_epi32(acc, _mm_shuffle_epi32(acc, 0x4E));
+		acc = _mm_add_epi32(acc, _mm_shuffle_epi32(acc, 0xB1));
+		sum = _mm_cvtsi128_si32(acc) + round;
+		for(; k < count; ++k)
+		{
+			sum += coef[k]*src[k];
+		}
+		sum >>= shift;
+
+		// saturate the intermediate sample
+		if(sum < INT16_MIN)
+		{
+			sum = INT16_MIN;
+		}
+		else if(sum > INT16_MAX)
+		{
+			sum = INT16_MAX;
+		}
+		s2[j - ja] = (int16_t) sum;
+	}
+}
+
+__attribute__((target("sse4.1")))
+static void
+lanczos_simd_horizontalU8x3SSE4(lanczos_planFixed1D_t* plan,
+                                const uint8_t* s1, int16_t* s2,
+                                int32_t ja, int32_t jb)
+{
+	ASSERT(plan);
+
+	int32_t shift = LANCZOS_PLANFIXED1D_BITS8 -
+	                LANCZOS_PLANFIXED1D_FRAC8;
+
+	// interleave the channels of two samples
+	// {r0, r1, g0, g1, b0, b1, 0, 0}
+	__m128i shuf = _mm_setr_epi8(0, -1, 3, -1, 1, -1, 4, -1,
+	                             2, -1, 5, -1, -1, -1, -1, -1);
+	__m128i round = _mm_set1_epi32(1 << (shift - 1));
+
+	int32_t        j;
+	int32_t        k;
+	int32_t        count;
+	__m128i        acc;
+	__m128i        p;
+	const int16_t* coef;
+	const uint8_t* src;
+	for(j = ja; j < jb; ++j)
+	{
+		count = plan->count[j];
+		coef  = &plan->coef16[j*plan->taps];
+		src   = &s1[3*plan->first[j]];
+		acc   = round;
+
+		// the 8 byte loads must remain inside the window
+		for(k = 0; k + 3 <= count; k += 2)
+		{
+			p   = _mm_shuffle_epi8(_mm_loadl_epi64((const __m128i*) &src[3*k]),
+			                       shuf);
+			acc = _mm_add_epi32(acc,
+			                    _mm_madd_epi16(p,
+			                                   lanczos_simd_pairU8SSE4(coef, k)));
+		}
+
+		for(; k < count; ++k)
+		{
+			p   = _mm_setr_epi32(src[3*k], src[3*k + 1],
+			                     src[3*k + 2], 0);
+			acc = _mm_add_epi32(acc,
+			                    _mm_mullo_epi32(p, _mm_set1_epi32(coef[k])));
+		}
+
+		acc = _mm_packs_epi32(_mm_srai_epi32(acc, shift), acc);
+		s2[3*(j - ja)]     = (int16_t) _mm_extract_epi16(acc, 0);
+		s2[3*(j - ja) + 1] = (int16_t) _mm_extract_epi16(acc, 1);
+		s2[3*(j - ja) + 2] = (int16_t) _mm_extract_epi16(acc, 2);
+	}
+}
+
+__attribute__((target("sse4.1")))
+static void
+lanczos_simd_horizontalU8x4SSE4(lanczos_planFixed1D_t* plan,
+                                const uint8_t* s1, int16_t* s2,
+                                int32_t ja, int32_t jb)
+{
+	ASSERT(plan);
+
+	int32_t shift = LANCZOS_PLANFIXED1D_BITS8 -
+	                LANCZOS_PLANFIXED1D_FRAC8;
+
+	// interleave the channels of two samples
+	// {r0, r1, g0, g1, b0, b1, a0, a1}
+	__m128i shuf = _mm_setr_epi8(0, -1, 4, -1, 1, -1, 5, -1,
+	                             2, -1, 6, -1, 3, -1, 7, -1);
+	__m128i round = _mm_set1_epi32(1 << (shift - 1));
+
+	int32_t        j;
+	int32_t        k;
+	int32_t        count;
+	int32_t        p4;
+	__m128i        acc;
+	__m128i        p;
+	const int16_t* coef;
+	const uint8_t* src;
+	for(j = ja; j < jb; ++j)
+	{
+		count = plan->count[j];
+		coef  = &plan->coef16[j*plan->taps];
+		src   = &s1[4*plan->first[j]];
+		acc   = round;
+		for(k = 0; k + 2 <= count; k += 2)
+		{
+			p   = _mm_shuffle_epi8(_mm_loadl_epi64((const __m128i*) &src[4*k]),
+			                       shuf);
+			acc = _mm_add_epi32(acc,
+			                    _mm_madd_epi16(p,
+			                                   lanczos_simd_pairU8SSE4(coef, k)));
+		}
+
+		if(k < count)
+		{
+			memcpy(&p4, &src[4*k], sizeof(int32_t));
+			p   = _mm_cvtepu8_epi32(_mm_cvtsi32_si128(p4));
+			acc = _mm_add_epi32(acc,
+			                    _mm_mullo_epi32(p, _mm_set1_epi32(coef[k])));
+		}
+
+		acc = _mm_packs_epi32(_mm_srai_epi32(acc, shift), acc);
+		_mm_storel_epi64((__m128i*) &s2[4*(j - ja)], acc);
+	}
+}
+
+__attribute__((target("sse4.1")))
+static void
+lanczos_simd_verticalU8SSE4(int32_t n, int32_t taps,
+                            const int16_t* coef,
+                            const int16_t** s1, uint8_t* s2)
+{
+	ASSERT(coef);
+	ASSERT(s1);
+	ASSERT(s2);
+
+	int32_t shift = LANCZOS_PLANFIXED1D_BITS8 +
+	                LANCZOS_PLANFIXED1D_FRAC8;
+	int32_t round = 1 << (shift - 1);
+
+	// interleave the rows k and k + 1 such that each
+	// _mm_madd_epi16 applies two taps
+	int32_t x;
+	int32_t k;
+	__m128i acc0;
+	__m128i acc1;
+	__m128i a;
+	__m128i b;
+	__m128i c;
+	for(x = 0; x + 8 <= n; x += 8)
+	{
+		acc0 = _mm_set1_epi32(round);
+		acc1 = acc0;
+		for(k = 0; k < taps; k += 2)
+		{
+			a = _mm_loadu_si128((const __m128i*) &s1[k][x]);
+			if(k + 1 < taps)
+			{
+				b = _mm_loadu_si128((const __m128i*) &s1[k + 1][x]);
+				c = lanczos_simd_pairU8SSE4(coef, k);
+			}
+			else
+			{
+				b = _mm_setzero_si128();
+				c = _mm_set1_epi32((uint16_t) coef[k]);
+			}
+			acc0 = _mm_add_epi32(acc0,
+			                     _mm_madd_epi16(_mm_unpacklo_epi16(a, b), c));
+			acc1 = _mm_add_epi32(acc1,
+			                     _mm_madd_epi16(_mm_unpackhi_epi16(a, b), c));
+		}
+
+		// round and clamp into the output range
+		a = _mm_packs_epi32(_mm_srai_epi32(acc0, shift),
+		                    _mm_srai_epi32(acc1, shift));
+		_mm_storel_epi64((__m128i*) &s2[x], _mm_packus_epi16(a, a));
+	}
+
+	lanczos_simd_verticalU8Tail(x, n, taps, coef, s1, s2);
+}
+
+/*
+ * AVX2
+ */
+
+__attribute__((target("avx2,fma")))
+static inline __m256i lanczos_simd_mask256(int32_t n)
+{
+	return _mm256_cmpgt_epi32(_mm256_set1_epi32(n),
+	                          _mm256_setr_epi32(0, 1, 2, 3,
+	                                            4, 5, 6, 7));
+}
+
+__attribute__((target("avx2,fma")))
+static inline float lanczos_simd_hsum256(__m256 v)
+{
+	__m128 lo = _mm256_castps256_ps128(v);
+	__m128 hi = _mm256_extractf128_ps(v, 1);
+	return lanczos_simd_hsum128(_mm_add_ps(lo, hi));
+}
+
+__attribute__((target("avx2,fma")))
+static void
+lanczos_simd_horizontal1AVX2(lanczos_plan1D_t* plan,
+                             const float* s1, float* s2,
+                             int32_t ja, int32_t jb)
+{
+	ASSERT(plan);
+
+	int32_t      j;
+	int32_t      k;
+	int32_t      taps = plan->taps;
+	int32_t      n8   = taps & ~7;
+	int32_t      r    = ja%plan->phases;
+	int32_t      base = (ja/plan->phases)*plan->step;
+	__m256i      mask = lanczos_simd_mask256(taps - n8);
+	__m256       acc;
+	const float* coef;
+	const float* src;
+	for(j = ja; j < jb; ++j)
+	{
+		coef = &plan->coef[r*taps];
+		src  = &s1[base + plan->first[r]];
+		acc  = _mm256_setzero_ps();
+		for(k = 0; k < n8; k += 8)
+		{
+			acc = _mm256_fmadd_ps(_mm256_loadu_ps(&src[k]),
+			                      _mm256_loadu_ps(&coef[k]),
+			                      acc);
+		}
+
+		// masked loads never touch memory past the window
+		if(k < taps)
+		{
+			acc = _mm256_fmadd_ps(_mm256_maskload_ps(&src[k], mask),
+			                      _mm256_maskload_ps(&coef[k], mask),
+			                      acc);
+		}
+		s2[j - ja] = lanczos_simd_hsum256(acc);
+
+		++r;
+		if(r == plan->phases)
+		{
+			r     = 0;
+			base += plan->step;
+		}
+	}
+}
+
+__attribute__((target("avx2,fma")))
+static void
+lanczos_simd_horizontal4AVX2(lanczos_plan1D_t* plan,
+                             const float* s1, float* s2,
+                             int32_t ja, int32_t jb)
+{
+	ASSERT(plan);
+
+	int32_t      j;
+	int32_t      k;
+	int32_t      taps = plan->taps;
+	int32_t      r    = ja%plan->phases;
+	int32_t      base = (ja/plan->phases)*plan->step;
+	__m128       acc;
+	const float* coef;
+	const float* src;
+	for(j = ja; j < jb; ++j)
+	{
+		coef = &plan->coef[r*taps];
+		src  = &s1[4*(base + plan->first[r])];
+		acc  = _mm_setzero_ps();
+		for(k = 0; k < taps; ++k)
+		{
+			acc = _mm_fmadd_ps(_mm_loadu_ps(&src[4*k]),
+			                   _mm_broadcast_ss(&coef[k]), acc);
+		}
+		_mm_storeu_ps(&s2[4*(j - ja)], acc);
+
+		++r;
+		if(r == plan->phases)
+		{
+			r     = 0;
+			base += plan->step;
+		}
+	}
+}
+
+// handles 2 or 3 channels with masked loads and stores
+// which never touch the channels of neighboring samples
+__attribute__((target("avx2,fma")))
+static void
+lanczos_simd_horizontalMaskAVX2(lanczos_plan1D_t* plan,
+                                int32_t nch,
+                                const float* s1, float* s2,
+                                int32_t ja, int32_t jb)
+{
+	ASSERT(plan);
+
+	int32_t      j;
+	int32_t      k;
+	int32_t      taps = plan->taps;
+	int32_t      r    = ja%plan->phases;
+	int32_t      base = (ja/plan->phases)*plan->step;
+	__m128i      mask = _mm_cmpgt_epi32(_mm_set1_epi32(nch),
+	                                    _mm_setr_epi32(0, 1, 2, 3));
+	__m128       acc;
+	const float* coef;
+	const float* src;
+	for(j = ja; j < jb; ++j)
+	{
+		coef = &plan->coef[r*taps];
+		src  = &s1[nch*(base + plan->first[r])];
+		acc  = _mm_setzero_ps();
+		for(k = 0; k < taps; ++k)
+		{
+			acc = _mm_fmadd_ps(_mm_maskload_ps(&src[nch*k], mask),
+			                   _mm_broadcast_ss(&coef[k]), acc);
+		}
+		_mm_maskstore_ps(&s2[nch*(j - ja)], mask, acc);
+
+		++r;
+		if(r == plan->phases)
+		{
+			r     = 0;
+			base += plan->step;
+		}
+	}
+}
+
+__attribute__((target("avx2,fma")))
+static void
+lanczos_simd_horizontal2AVX2(lanczos_plan1D_t* plan,
+                             const float* s1, float* s2,
+                             int32_t ja, int32_t jb)
+{
+	lanczos_simd_horizontalMaskAVX2(plan, 2, s1, s2, ja, jb);
+}
+
+__attribute__((target("avx2,fma")))
+static void
+lanczos_simd_horizontal3AVX2(lanczos_plan1D_t* plan,
+                             const float* s1, float* s2,
+                             int32_t ja, int32_t jb)
+{
+	lanczos_simd_horizontalMaskAVX2(plan, 3, s1, s2, ja, jb);
+}
+
+__attribute__((target("avx2,fma")))
+static void
+lanczos_simd_verticalAVX2(int32_t n, int32_t taps,
+                          const float* coef,
+                          const float** s1, float* s2)
+{
+	ASSERT(coef);
+	ASSERT(s1);
+	ASSERT(s2);
+
+	int32_t x;
+	int32_t k;
+	__m256  acc;
+	__m256  c;
+	for(x = 0; x + 8 <= n; x += 8)
+	{
+		acc = _mm256_setzero_ps();
+		for(k = 0; k < taps; ++k)
+		{
+			c   = _mm256_broadcast_ss(&coef[k]);
+			acc = _mm256_fmadd_ps(_mm256_loadu_ps(&s1[k][x]),
+			                      c, acc);
+		}
+		_mm256_storeu_ps(&s2[x], acc);
+	}
+
+	if(x < n)
+	{
+		__m256i mask = lanczos_simd_mask256(n - x);
+		acc = _mm256_setzero_ps();
+		for(k = 0; k < taps; ++k)
+		{
+			c   = _mm256_broadcast_ss(&coef[k]);
+			acc = _mm256_fmadd_ps(_mm256_maskload_ps(&s1[k][x], mask),
+			                      c, acc);
+		}
+		_mm256_maskstore_ps(&s2[x], mask, acc);
+	}
+}
+
+__attribute__((target("avx2,fma")))
+static void
+lanczos_simd_verticalU8AVX2(int32_t n, int32_t taps,
+                            const int16_t* coef,
+                            const int16_t** s1, uint8_t* s2)
+{
+	ASSERT(coef);
+	ASSERT(s1);
+	ASSERT(s2);
+
+	int32_t shift = LANCZOS_PLANFIXED1D_BITS8 +
+	                LANCZOS_PLANFIXED1D_FRAC8;
+
+	// see lanczos_simd_verticalU8SSE4
+	// the unpack and pack instructions operate within the
+	// 128-bit lanes such that the packed outputs remain in
+	// order
+	int32_t x;
+	int32_t k;
+	__m256i acc0;
+	__m256i acc1;
+	__m256i a;
+	__m256i b;
+	__m256i c;
+	for(x = 0; x + 16 <= n; x += 16)
+	{
+		acc0 = _mm256_set1_epi32(1 << (shift - 1));
+		acc1 = acc0;
+		for(k = 0; k < taps; k += 2)
+		{
+			a = _mm256_loadu_si256((const __m256i*) &s1[k][x]);
+			if(k + 1 < taps)
+			{
+				b = _mm256_loadu_si256((const __m256i*) &s1[k + 1][x]);
+				c = _mm256_broadcastsi128_si256(lanczos_simd_pairU8SSE4(coef, k));
+			}
+			else
+			{
+				b = _mm256_setzero_si256();
+				c = _mm256_set1_epi32((uint16_t) coef[k]);
+			}
+			acc0 = _mm256_add_epi32(acc0,
+			                        _mm256_madd_epi16(_mm256_unpacklo_epi16(a, b), c));
+			acc1 = _mm256_add_epi32(acc1,
+			                        _mm256_madd_epi16(_mm256_unpackhi_epi16(a, b), c));
+		}
+
+		a = _mm256_packs_epi32(_mm256_srai_epi32(acc0, shift),
+		                       _mm256_srai_epi32(acc1, shift));
+		a = _mm256_permute4x64_epi64(_mm256_packus_epi16(a, a), 0x08);
+		_mm_storeu_si128((__m128i*) &s2[x], _mm256_castsi256_si128(a));
+	}
+
+	lanczos_simd_verticalU8Tail(x, n, taps, coef, s1, s2);
+}
+
+__attribute__((target("avx,f16c")))
+static void
+lanczos_simd_loadF16C(int32_t n, const uint16_t* src,
+                      float* dst)
+{
+	ASSERT(src);
+	ASSERT(dst);
+
+	int32_t x;
+	for(x = 0; x + 8 <= n; x += 8)
+	{
+		_mm256_storeu_ps(&dst[x],
+		                 _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*) &src[x])));
+	}
+	lanczos_simd_loadF16Scalar(n - x, &src[x], &dst[x]);
+}
+
+__attribute__((target("avx,f16c")))
+static void
+lanczos_simd_storeF16C(int32_t n, const float* src,
+                       uint16_t* dst)
+{
+	ASSERT(src);
+	ASSERT(dst);
+
+	int32_t x;
+	for(x = 0; x + 8 <= n; x += 8)
+	{
+		_mm_storeu_si128((__m128i*) &dst[x],
+		                 _mm256_cvtps_ph(_mm256_loadu_ps(&src[x]),
+		                                 _MM_FROUND_TO_NEAREST_INT));
+	}
+	lanczos_simd_storeF16Scalar(n - x, &src[x], &dst[x]);
+}
+
+__attribute__((target("avx2,fma")))
+static void
+lanczos_simd_loadBF16AVX2(int32_t n, const uint16_t* src,
+                          float* dst)
+{
+	ASSERT(src);
+	ASSERT(dst);
+
+	int32_t x;
+	__m256i v;
+	for(x = 0; x + 8 <= n; x += 8)
+	{
+		v = _mm256_cvtepu16_epi32(_mm_loadu_si128((const __m128i*) &src[x]));
+		_mm256_storeu_ps(&dst[x],
+		                 _mm256_castsi256_ps(_mm256_slli_epi32(v, 16)));
+	}
+	lanczos_simd_loadBF16Scalar(n - x, &src[x], &dst[x]);
+}
+
+__attribute__((target("avx2,fma")))
+static void
+lanczos_simd_storeBF16AVX2(int32_t n, const float* src,
+                           uint16_t* dst)
+{
+	ASSERT(src);
+	ASSERT(dst);
+
+	// see lanczos_simd_storeBF16Scalar
+	int32_t x;
+	__m256  f;
+	__m256i v;
+	__m256i r;
+	__m256i nan;
+	__m256i bias = _mm256_set1_epi32(0x7FFF);
+	__m256i one  = _mm256_set1_epi32(1);
+	__m256i quiet = _mm256_set1_epi32(0x400000);
+	for(x = 0; x + 8 <= n; x += 8)
+	{
+		f   = _mm256_loadu_ps(&src[x]);
+		v   = _mm256_castps_si256(f);
+		r   = _mm256_and_si256(_mm256_srli_epi32(v, 16), one);
+		r   = _mm256_add_epi32(v, _mm256_add_epi32(bias, r));
+		nan = _mm256_castps_si256(_mm256_cmp_ps(f, f, _CMP_UNORD_Q));
+		r   = _mm256_blendv_epi8(r, _mm256_or_si256(v, quiet), nan);
+		r   = _mm256_srli_epi32(r, 16);
+
+		// the pack operates within the 128-bit lanes
+		r = _mm256_permute4x64_epi64(_mm256_packus_epi32(r, r), 0x08);
+		_mm_storeu_si128((__m128i*) &dst[x],
+		                 _mm256_castsi256_si128(r));
+	}
+	lanczos_simd_storeBF16Scalar(n - x, &src[x], &dst[x]);
+}
+
+/*
+ * AVX-512
+ */
+
+__attribute__((target("avx512f")))
+static void
+lanczos_simd_horizontal1AVX512(lanczos_plan1D_t* plan,
+                               const float* s1, float* s2,
+                               int32_t ja, int32_t jb)
+{
+	ASSERT(plan);
+
+	int32_t      j;
+	int32_t      k;
+	int32_t      taps = plan->taps;
+	int32_t      n16  = taps & ~15;
+	int32_t      r    = ja%plan->phases;
+	int32_t      base = (ja/plan->phases)*plan->step;
+	__mmask16    mask = (__mmask16) ((1u << (taps - n16)) - 1);
+	__m512       acc;
+	const float* coef;
+	const float* src;
+	for(j = ja; j < jb; ++j)
+	{
+		coef = &plan->coef[r*taps];
+		src  = &s1[base + plan->first[r]];
+		acc  = _mm512_setzero_ps();
+		for(k = 0; k < n16; k += 16)
+		{
+			acc = _mm512_fmadd_ps(_mm512_loadu_ps(&src[k]),
+			                      _mm512_loadu_ps(&coef[k]),
+			                      acc);
+		}
+
+		// masked loads never touch memory past the window
+		if(k < taps)
+		{
+			acc = _mm512_fmadd_ps(_mm512_maskz_loadu_ps(mask, &src[k]),
+			                      _mm512_maskz_loadu_ps(mask, &coef[k]),
+			                      acc);
+		}
+		s2[j - ja] = _mm512_reduce_add_ps(acc);
+
+		++r;
+		if(r == plan->phases)
+		{
+			r     = 0;
+			base += plan->step;
+		}
+	}
+}
+
+// each 512-bit register holds 4 taps of 4 lanes where the
+// channels of a tap are expanded into its lanes and the
+// lanes of the taps are summed by the reduction
+__attribute__((target("avx512f")))
+static inline __m128 lanczos_simd_hsum4x512(__m512 v)
+{
+	__m128 a = _mm_add_ps(_mm512_castps512_ps128(v),
+	                      _mm512_extractf32x4_ps(v, 1));
+	__m128 b = _mm_add_ps(_mm512_extractf32x4_ps(v, 2),
+	                      _mm512_extractf32x4_ps(v, 3));
+	return _mm_add_ps(a, b);
+}
+
+__attribute__((target("avx512f")))
+static void
+lanczos_simd_horizontal4AVX512(lanczos_plan1D_t* plan,
+                               const float* s1, float* s2,
+                               int32_t ja, int32_t jb)
+{
+	ASSERT(plan);
+
+	int32_t      j;
+	int32_t      k;
+	int32_t      taps  = plan->taps;
+	int32_t      n4    = taps & ~3;
+	int32_t      r     = ja%plan->phases;
+	int32_t      base  = (ja/plan->phases)*plan->step;
+	__mmask16    mask  = (__mmask16) ((1u << (4*(taps - n4))) - 1);
+	__mmask16    cmask = (__mmask16) ((1u << (taps - n4)) - 1);
+	__m512i      idx   = _mm512_setr_epi32(0, 0, 0, 0, 1, 1, 1, 1,
+	                                       2, 2, 2, 2, 3, 3, 3, 3);
+	__m512       acc;
+	__m512       c;
+	const float* coef;
+	const float* src;
+	for(j = ja; j < jb; ++j)
+	{
+		coef = &plan->coef[r*taps];
+		src  = &s1[4*(base + plan->first[r])];
+		acc  = _mm512_setzero_ps();
+		for(k = 0; k < n4; k += 4)
+		{
+			c   = _mm512_permutexvar_ps(idx,
+			                            _mm512_castps128_ps512(_mm_loadu_ps(&coef[k])));
+			acc = _mm512_fmadd_ps(_mm512_loadu_ps(&src[4*k]), c,
+			                      acc);
+		}
+
+		// masked loads never touch memory past the window
+		if(k < taps)
+		{
+			c   = _mm512_permutexvar_ps(idx,
+			                            _mm512_maskz_loadu_ps(cmask, &coef[k]));
+			acc = _mm512_fmadd_ps(_mm512_maskz_loadu_ps(mask, &src[4*k]),
+			                      c, acc);
+		}
+		_mm_storeu_ps(&s2[4*(j - ja)], lanczos_simd_hsum4x512(acc));
+
+		++r;
+		if(r == plan->phases)
+		{
+			r     = 0;
+			base += plan->step;
+		}
+	}
+}
+
+// handles 2 or 3 channels with expanding loads and masked
+// stores which never touch the channels of neighboring
+// samples
+__attribute__((target("avx512f")))
+static void
+lanczos_simd_horizontalMaskAVX512(lanczos_plan1D_t* plan,
+                                  int32_t nch,
+                                  const float* s1, float* s2,
+                                  int32_t ja, int32_t jb)
+{
+	ASSERT(plan);
+
+	int32_t      j;
+	int32_t      k;
+	int32_t      taps  = plan->taps;
+	int32_t      n4    = taps & ~3;
+	int32_t      r     = ja%plan->phases;
+	int32_t      base  = (ja/plan->phases)*plan->step;
+	__mmask16    lane  = (__mmask16) ((1u << nch) - 1);
+	__mmask16    load  = (__mmask16) (lane | (lane << 4) |
+	                                  (lane << 8) | (lane << 12));
+	__mmask16    mask  = (__mmask16) (load &
+	                                  ((1u << (4*(taps - n4))) - 1));
+	__mmask16    cmask = (__mmask16) ((1u << (taps - n4)) - 1);
+	__m512i      idx   = _mm512_setr_epi32(0, 0, 0, 0, 1, 1, 1, 1,
+	                                       2, 2, 2, 2, 3, 3, 3, 3);
+	__m512       acc;
+	__m512       c;
+	const float* coef;
+	const float* src;
+	for(j = ja; j < jb; ++j)
+	{
+		coef = &plan->coef[r*taps];
+		src  = &s1[nch*(base + plan->first[r])];
+		acc  = _mm512_setzero_ps();
+		for(k = 0; k < n4; k += 4)
+		{
+			c   = _mm512_permutexvar_ps(idx,
+			                            _mm512_castps128_ps512(_mm_loadu_ps(&coef[k])));
+			acc = _mm512_fmadd_ps(_mm512_maskz_expandloadu_ps(load, &src[nch*k]),
+			                      c, acc);
+		}
+
+		if(k < taps)
+		{
+			c   = _mm512_permutexvar_ps(idx,
+			                            _mm512_maskz_loadu_ps(cmask, &coef[k]));
+			acc = _mm512_fmadd_ps(_mm512_maskz_expandloadu_ps(mask, &src[nch*k]),
+			                      c, acc);
+		}
+		_mm512_mask_storeu_ps(&s2[nch*(j - ja)], lane,
+		                      _mm512_castps128_ps512(lanczos_simd_hsum4x512(acc)));
+
+		++r;
+		if(r == plan->phases)
+		{
+			r     = 0;
+			base += plan->step;
+		}
+	}
+}
+
+__attribute__((target("avx512f")))
+static void
+lanczos_simd_horizontal2AVX512(lanczos_plan1D_t* plan,
+                               const float* s1, float* s2,
+                               int32_t ja, int32_t jb)
+{
+	lanczos_simd_horizontalMaskAVX512(plan, 2, s1, s2, ja, jb);
+}
+
+__attribute__((target("avx512f")))
+static void
+lanczos_simd_horizontal3AVX512(lanczos_plan1D_t* plan,
+                               const float* s1, float* s2,
+                               int32_t ja, int32_t jb)
+{
+	lanczos_simd_horizontalMaskAVX512(plan, 3, s1, s2, ja, jb);
+}
+
+__attribute__((target("avx512f")))
+static void
+lanczos_simd_verticalAVX512(int32_t n, int32_t taps,
+                            const float* coef,
+                            const float** s1, float* s2)
+{
+	ASSERT(coef);
+	ASSERT(s1);
+	ASSERT(s2);
+
+	int32_t x;
+	int32_t k;
+	__m512  acc;
+	__m512  c;
+	for(x = 0; x + 16 <= n; x += 16)
+	{
+		acc = _mm512_setzero_ps();
+		for(k = 0; k < taps; ++k)
+		{
+			c   = _mm512_set1_ps(coef[k]);
+			acc = _mm512_fmadd_ps(_mm512_loadu_ps(&s1[k][x]),
+			                      c, acc);
+		}
+		_mm512_storeu_ps(&s2[x], acc);
+	}
+
+	if(x < n)
+	{
+		__mmask16 mask = (__mmask16) ((1u << (n - x)) - 1);
+		acc = _mm512_setzero_ps();
+		for(k = 0; k < taps; ++k)
+		{
+			c   = _mm512_set1_ps(coef[k]);
+			acc = _mm512_fmadd_ps(_mm512_maskz_loadu_ps(mask, &s1[k][x]),
+			                      c, acc);
+		}
+		_mm512_mask_storeu_ps(&s2[x], mask, acc);
+	}
+}
+
+#endif
+
+static void lanczos_simd_init(void)
+{
+	lanczos_simd.level           = LANCZOS_SIMD_SCALAR;
+	lanczos_simd.horizontal[0]   = NULL;
+	lanczos_simd.horizontal[1]   = NULL;
+	lanczos_simd.horizontal[2]   = NULL;
+	lanczos_simd.horizontal[3]   = NULL;
+	lanczos_simd.vertical        = lanczos_simd_verticalScalar;
+	lanczos_simd.horizontalU8[0] = NULL;
+	lanczos_simd.horizontalU8[1] = NULL;
+	lanczos_simd.horizontalU8[2] = NULL;
+	lanczos_simd.horizontalU8[3] = NULL;
+	lanczos_simd.verticalU8      = NULL;
+	lanczos_simd.loadF16         = lanczos_simd_loadF16Scalar;
+	lanczos_simd.storeF16        = lanczos_simd_storeF16Scalar;
+	lanczos_simd.loadBF16        = lanczos_simd_loadBF16Scalar;
+	lanczos_simd.storeBF16       = lanczos_simd_storeBF16Scalar;
+
+	#ifdef LANCZOS_SIMD_X86
+	__builtin_cpu_init();
+	if(__builtin_cpu_supports("sse4.1"))
+	{
+		lanczos_simd.horizontalU8[0] = lanczos_simd_horizontalU8x1SSE4;
+		lanczos_simd.horizontalU8[2] = lanczos_simd_horizontalU8x3SSE4;
+		lanczos_simd.horizontalU8[3] = lanczos_simd_horizontalU8x4SSE4;
+	}
+	if(__builtin_cpu_supports("avx") &&
+	   __builtin_cpu_supports("f16c"))
+	{
+		lanczos_simd.loadF16  = lanczos_simd_loadF16C;
+		lanczos_simd.storeF16 = lanczos_simd_storeF16C;
+	}
+	if(__builtin_cpu_supports("avx2") &&
+	   __builtin_cpu_supports("fma"))
+	{
+		lanczos_simd.loadBF16  = lanczos_simd_loadBF16AVX2;
+		lanczos_simd.storeBF16 = lanczos_simd_storeBF16AVX2;
+	}
+
+	// the AVX-512 level includes the AVX2 fixed-point kernel
+	if(__builtin_cpu_supports("avx512f") &&
+	   __builtin_cpu_supports("avx2")    &&
+	   __builtin_cpu_supports("fma"))
+	{
+		lanczos_simd.level         = LANCZOS_SIMD_AVX512;
+		lanczos_simd.horizontal[0] = lanczos_simd_horizontal1AVX512;
+		lanczos_simd.horizontal[1] = lanczos_simd_horizontal2AVX512;
+		lanczos_simd.horizontal[2] = lanczos_simd_horizontal3AVX512;
+		lanczos_simd.horizontal[3] = lanczos_simd_horizontal4AVX512;
+		lanczos_simd.vertical      = lanczos_simd_verticalAVX512;
+		lanczos_simd.verticalU8    = lanczos_simd_verticalU8AVX2;
+	}
+	else if(__builtin_cpu_supports("avx2") &&
+	        __builtin_cpu_supports("fma"))
+	{
+		lanczos_simd.level         = LANCZOS_SIMD_AVX2;
+		lanczos_simd.horizontal[0] = lanczos_simd_horizontal1AVX2;
+		lanczos_simd.horizontal[1] = lanczos_simd_horizontal2AVX2;
+		lanczos_simd.horizontal[2] = lanczos_simd_horizontal3AVX2;
+		lanczos_simd.horizontal[3] = lanczos_simd_horizontal4AVX2;
+		lanczos_simd.vertical      = lanczos_simd_verticalAVX2;
+		lanczos_simd.verticalU8    = lanczos_simd_verticalU8AVX2;
+	}
+	else if(__builtin_cpu_supports("sse4.1"))
+	{
+		lanczos_simd.level         = LANCZOS_SIMD_SSE4;
+		lanczos_simd.horizontal[0] = lanczos_simd_horizontal1SSE4;
+		lanczos_simd.horizontal[3] = lanczos_simd_horizontal4SSE4;
+		lanczos_simd.vertical      = lanczos_simd_verticalSSE4;
+		lanczos_simd.verticalU8    = lanczos_simd_verticalU8SSE4;
+	}
+	#endif
+}
+
+/*
+ * public
+ */
+
+int lanczos_simd_level(void)
+{
+	pthread_once(&lanczos_simd_once, lanczos_simd_init);
+
+	return lanczos_simd.level;
+}
+
+int lanczos_simd_horizontal(lanczos_plan1D_t* plan,
+                            int32_t nch,
+                            const float* s1, float* s2,
+                            int32_t ja, int32_t jb)
+{
+	ASSERT(plan);
+	ASSERT(s1);
+	ASSERT(s2);
+
+	if((plan->flags & LANCZOS_FLAG_SCALAR) ||
+	   (lanczos_simd_level() == LANCZOS_SIMD_SCALAR))
+	{
+		return 0;
+	}
+
+	lanczos_simd_horizontalFn fn = NULL;
+	if((nch >= 1) && (nch <= 4))
+	{
+		fn = lanczos_simd.horizontal[nch - 1];
+	}
+
+	if(fn == NULL)
+	{
+		return 0;
+	}
+
+	fn(plan, s1, s2, ja, jb);
+
+	return 1;
+}
+
+void lanczos_simd_vertical(uint32_t flags, int32_t n,
+                           int32_t taps, const float* coef,
+                           const float** s1, float* s2)
+{
+	ASSERT(coef);
+	ASSERT(s1);
+	ASSERT(s2);
+
+	if(flags & LANCZOS_FLAG_SCALAR)
+	{
+		lanczos_simd_verticalScalar(n, taps, coef, s1, s2);
+		return;
+	}
+
+	lanczos_simd_level();
+	lanczos_simd.vertical(n, taps, coef, s1, s2);
+}
+
+int lanczos_simd_horizontalU8(lanczos_planFixed1D_t* plan,
+                              int32_t nch,
+                              const uint8_t* s1, int16_t* s2,
+                              int32_t ja, int32_t jb)
+{
+	ASSERT(plan);
+	ASSERT(s1);
+	ASSERT(s2);
+
+	if(plan->flags & LANCZOS_FLAG_SCALAR)
+	{
+		return 0;
+	}
+
+	lanczos_simd_level();
+
+	lanczos_simd_horizontalU8Fn fn = NULL;
+	if((nch >= 1) && (nch <= 4))
+	{
+		fn = lanczos_simd.horizontalU8[nch - 1];
+	}
+
+	if(fn == NULL)
+	{
+		return 0;
+	}
+
+	fn(plan, s1, s2, ja, jb);
+
+	return 1;
+}
+
+int lanczos_simd_verticalU8(uint32_t flags, int32_t n,
+                            int32_t taps, const int16_t* coef,
+                            const int16_t** s1, uint8_t* s2)
+{
+	ASSERT(coef);
+	ASSERT(s1);
+	ASSERT(s2);
+
+	if(flags & LANCZOS_FLAG_SCALAR)
+	{
+		return 0;
+	}
+
+	lanczos_simd_level();
+	if(lanczos_simd.verticalU8 == NULL)
+	{
+		return 0;
+	}
+
+	lanczos_simd.verticalU8(n, taps, coef, s1, s2);
+
+	return 1;
+}
+
+void lanczos_simd_loadHalf(uint32_t flags, int32_t format,
+                           int32_t n, const uint16_t* src,
+                           float* dst)
+{
+	ASSERT(src);
+	ASSERT(dst);
+
+	lanczos_simd_level();
+
+	if(format == LANCZOS_FORMAT_FLOAT16)
+	{
+		if(flags & LANCZOS_FLAG_SCALAR)
+		{
+			lanczos_simd_loadF16Scalar(n, src, dst);
+		}
+		else
+		{
+			lanczos_simd.loadF16(n, src, dst);
+		}
+	}
+	else
+	{
+		if(flags & LANCZOS_FLAG_SCALAR)
+		{
+			lanczos_simd_loadBF16Scalar(n, src, dst);
+		}
+		else
+		{
+			lanczos_simd.loadBF16(n, src, dst);
+		}
+	}
+}
+
+void lanczos_simd_storeHalf(uint32_t flags, int32_t format,
+                            int32_t n, const float* src,
+                            uint16_t* dst)
+{
+	ASSERT(src);
+	ASSERT(dst);
+
+	lanczos_simd_level();
+
+	if(format == LANCZOS_FORMAT_FLOAT16)
+	{
+		if(flags & LANCZOS_FLAG_SCALAR)
+		{
+			lanczos_simd_storeF16Scalar(n, src, dst);
+		}
+		else
+		{
+			lanczos_simd.storeF16(n, src, dst);
+		}
+	}
+	else
+	{
+		if(flags & LANCZOS_FLAG_SCALAR)
+		{
+			lanczos_simd_storeBF16Scalar(n, src, dst);
+		}
+		else
+		{
+			lanczos_simd.storeBF16(n, src, dst);
+		}
+	}
+}
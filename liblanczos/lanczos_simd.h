@@ -0,0 +1,94 @@
+/*
+ * Copyright (c) 2025 Jeff Boody
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included
+ * in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+
+#ifndef lanczos_simd_H
+#define lanczos_simd_H
+
+#include <stdint.h>
+
+#include "lanczos_plan1D.h"
+#include "lanczos_planFixed1D.h"
+
+// SIMD levels
+#define LANCZOS_SIMD_SCALAR 0
+#define LANCZOS_SIMD_SSE4   1
+#define LANCZOS_SIMD_AVX2   2
+#define LANCZOS_SIMD_AVX512 3
+
+// The SIMD kernels are selected at runtime from the best
+// instruction set supported by the CPU (cpuid) such that a
+// single library runs on any x86 CPU. The scalar kernels
+// are always available as a reference and may be selected
+// with LANCZOS_FLAG_SCALAR. The AVX-512 level provides the
+// float horizontal (1 to 4 channels) and vertical kernels
+// while the fixed-point and half-precision kernels of the
+// AVX-512 level are those of AVX2.
+int lanczos_simd_level(void);
+
+// horizontal pass
+// resamples the interior outputs [ja, jb) of a plan where
+// s2 points to the output ja
+// returns 0 when no SIMD kernel is available such that the
+// caller must fall back to the scalar kernel
+int lanczos_simd_horizontal(lanczos_plan1D_t* plan,
+                            int32_t nch,
+                            const float* s1, float* s2,
+                            int32_t ja, int32_t jb);
+
+// vertical pass
+// s2[x] = SUM(k = 0, k = taps - 1, coef[k]*s1[k][x])
+// for x = [0, n)
+void lanczos_simd_vertical(uint32_t flags, int32_t n,
+                           int32_t taps, const float* coef,
+                           const float** s1, float* s2);
+
+// fixed-point horizontal pass (UINT8)
+// resamples the outputs [ja, jb) of a fixed-point plan into
+// intermediate samples where s2 points to the output ja
+// returns 0 when no SIMD kernel is available such that the
+// caller must fall back to the scalar kernel
+int lanczos_simd_horizontalU8(lanczos_planFixed1D_t* plan,
+                              int32_t nch,
+                              const uint8_t* s1, int16_t* s2,
+                              int32_t ja, int32_t jb);
+
+// fixed-point vertical pass (UINT8)
+// s2[x] = clamp(SUM(k = 0, k = taps - 1, coef[k]*s1[k][x]))
+// for x = [0, n) where the sum is rounded and clamped to
+// [0, 255]
+// returns 0 when no SIMD kernel is available
+int lanczos_simd_verticalU8(uint32_t flags, int32_t n,
+                            int32_t taps, const int16_t* coef,
+                            const int16_t** s1, uint8_t* s2);
+
+// half-precision conversion (FLOAT16 and BFLOAT16)
+// converts n samples to float (load) or from float (store)
+// with round to nearest even
+void lanczos_simd_loadHalf(uint32_t flags, int32_t format,
+                           int32_t n, const uint16_t* src,
+                           float* dst);
+void lanczos_simd_storeHalf(uint32_t flags, int32_t format,
+                            int32_t n, const float* src,
+                            uint16_t* dst);
+
+#endif
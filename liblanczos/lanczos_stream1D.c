@@ -0,0 +1,298 @@
+/*
+ * Copyright (c) 2025 Jeff Boody
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included
+ * in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+
+#include <stdlib.h>
+#include <string.h>
+
+#define LOG_TAG "lanczos"
+#include "../../libcc/cc_log.h"
+#include "../../libcc/cc_memory.h"
+#include "lanczos_stream1D.h"
+
+/*
+ * private
+ */
+
+static int32_t gcd(int32_t a, int32_t b)
+{
+	int32_t t;
+	while(b)
+	{
+		t = a%b;
+		a = b;
+		b = t;
+	}
+	return a;
+}
+
+static int64_t
+lanczos_stream1D_first(lanczos_stream1D_t* self, int64_t j)
+{
+	ASSERT(self);
+
+	// see lanczos_plan1D_first
+	return (j/self->q)*self->p + self->plan->first[j%self->q];
+}
+
+static int32_t
+lanczos_stream1D_emit(lanczos_stream1D_t* self, float* dst)
+{
+	ASSERT(self);
+	ASSERT(dst);
+
+	// the outputs whose source window is complete and inside
+	// the history are resampled relative to the history
+	lanczos_plan1D_t* plan = self->plan;
+	int64_t           base = (self->start/self->p)*self->q;
+	int64_t           j    = self->next;
+	while((j - base < plan->j1) &&
+	      (lanczos_stream1D_first(self, j) + plan->taps <=
+	       self->total))
+	{
+		++j;
+	}
+
+	int32_t ja = (int32_t) (self->next - base);
+	int32_t jb = (int32_t) (j - base);
+	if(ja < jb)
+	{
+		lanczos_plan1D_executeRange(plan, self->channels,
+		                            self->hist, dst, ja, jb);
+	}
+	self->next = j;
+
+	return jb - ja;
+}
+
+static void lanczos_stream1D_compact(lanczos_stream1D_t* self)
+{
+	ASSERT(self);
+
+	// retain the window of the next output from a multiple
+	// of p such that the phases are unchanged
+	int64_t first = lanczos_stream1D_first(self, self->next);
+	if(first < self->start)
+	{
+		return;
+	}
+
+	int32_t shift = (int32_t) ((first/self->p)*self->p -
+	                           self->start);
+	if(shift == 0)
+	{
+		return;
+	}
+
+	int32_t nch = self->channels;
+	memmove(self->hist, &self->hist[nch*shift],
+	        nch*(self->count - shift)*sizeof(float));
+	self->count -= shift;
+	self->start += shift;
+}
+
+/*
+ * public
+ */
+
+lanczos_stream1D_t*
+lanczos_stream1D_new(uint32_t flags, int32_t a,
+                     int32_t channels, int32_t src_w,
+                     int32_t dst_w)
+{
+	if((a <= 0) || (channels <= 0) || (src_w <= 0) ||
+	   (dst_w <= 0))
+	{
+		LOGE("invalid a=%i, channels=%i, src_w=%i, dst_w=%i",
+		     a, channels, src_w, dst_w);
+		return NULL;
+	}
+
+	int32_t g = gcd(src_w, dst_w);
+	int32_t p = src_w/g;
+	int32_t q = dst_w/g;
+
+	lanczos_stream1D_t* self;
+	self = (lanczos_stream1D_t*)
+	       CALLOC(1, sizeof(lanczos_stream1D_t));
+	if(self == NULL)
+	{
+		LOGE("CALLOC failed");
+		return NULL;
+	}
+
+	self->channels = channels;
+	self->p        = p;
+	self->q        = q;
+
+	// the history holds the window of the next output
+	// (at most taps + p - 1 samples) plus a block of new
+	// samples where the window size is bounded as in
+	// lanczos_planRadial_axis
+	double fs = 1.0;
+	if(p > q)
+	{
+		fs = ((double) p)/((double) q);
+	}
+	int32_t taps = (int32_t) (2.0*fs*a) + 2;
+	self->size   = p*((taps + LANCZOS_STREAM1D_BLOCK)/p + 2);
+
+	int64_t hist_w = ((int64_t) (self->size/p))*q;
+	if(hist_w > INT32_MAX)
+	{
+		LOGE("invalid src_w=%i, dst_w=%i", src_w, dst_w);
+		goto fail_plan;
+	}
+
+	// ratios with more phases than LANCZOS_PLAN1D_MAX_PHASES
+	// (e.g. 1003 to 1500) keep the polyphase layout where the
+	// phases are the q outputs of one period of the
+	// contribution table used by lanczos_resample_regular1D
+	self->plan = lanczos_plan1D_newPolyphase(NULL, flags, a,
+	                                         self->size,
+	                                         (int32_t) hist_w);
+	if(self->plan == NULL)
+	{
+		goto fail_plan;
+	}
+
+	self->hist = (float*)
+	             CALLOC(self->size*channels, sizeof(float));
+	if(self->hist == NULL)
+	{
+		LOGE("CALLOC failed");
+		goto fail_hist;
+	}
+
+	self->coef = (float*) CALLOC(self->plan->taps, sizeof(float));
+	if(self->coef == NULL)
+	{
+		LOGE("CALLOC failed");
+		goto fail_coef;
+	}
+
+	// success
+	return self;
+
+	// failure
+	fail_coef:
+		FREE(self->hist);
+	fail_hist:
+		lanczos_plan1D_delete(&self->plan);
+	fail_plan:
+		FREE(self);
+	return NULL;
+}
+
+void lanczos_stream1D_delete(lanczos_stream1D_t** _self)
+{
+	ASSERT(_self);
+
+	lanczos_stream1D_t* self = *_self;
+	if(self)
+	{
+		FREE(self->coef);
+		FREE(self->hist);
+		lanczos_plan1D_delete(&self->plan);
+		FREE(self);
+		*_self = NULL;
+	}
+}
+
+int32_t lanczos_stream1D_maxOutputs(lanczos_stream1D_t* self,
+                                    int32_t count)
+{
+	ASSERT(self);
+
+	// the outputs of a push are at most ceil(count*q/p) and
+	// the outputs of a flush are within the last window
+	int64_t n = ((int64_t) count) + 2*self->plan->taps;
+	return (int32_t) ((n*self->q)/self->p + 2);
+}
+
+int32_t lanczos_stream1D_push(lanczos_stream1D_t* self,
+                              int32_t count,
+                              const float* src, float* dst)
+{
+	ASSERT(self);
+	ASSERT(src || (count == 0));
+	ASSERT(dst);
+
+	int32_t nch = self->channels;
+	int32_t n;
+	int32_t outputs = 0;
+	while(count > 0)
+	{
+		if(self->count == self->size)
+		{
+			lanczos_stream1D_compact(self);
+		}
+
+		// append the samples which fit in the history
+		n = self->size - self->count;
+		if(n > count)
+		{
+			n = count;
+		}
+		memcpy(&self->hist[nch*self->count], src,
+		       nch*n*sizeof(float));
+		self->count += n;
+		self->total += n;
+		src         += nch*n;
+		count       -= n;
+
+		outputs += lanczos_stream1D_emit(self,
+		                                 &dst[nch*outputs]);
+	}
+
+	return outputs;
+}
+
+int32_t lanczos_stream1D_flush(lanczos_stream1D_t* self,
+                               float* dst)
+{
+	ASSERT(self);
+	ASSERT(dst);
+
+	// the stream of n1 samples has n1*q/p outputs and the
+	// remaining outputs reference the end of the stream
+	int64_t base    = (self->start/self->p)*self->q;
+	int64_t dst_w   = (self->total*self->q)/self->p;
+	int32_t outputs = 0;
+	if(self->next < dst_w)
+	{
+		outputs = (int32_t) (dst_w - self->next);
+		lanczos_plan1D_executeFold(self->plan, self->channels,
+		                           self->hist, dst,
+		                           (int32_t) (self->next - base),
+		                           (int32_t) (dst_w - base),
+		                           self->count, self->coef);
+	}
+
+	// reset the stream
+	self->count = 0;
+	self->start = 0;
+	self->total = 0;
+	self->next  = 0;
+
+	return outputs;
+}
@@ -0,0 +1,88 @@
+/*
+ * Copyright (c) 2025 Jeff Boody
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included
+ * in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+
+#ifndef lanczos_stream1D_H
+#define lanczos_stream1D_H
+
+#include <stdint.h>
+
+#include "lanczos_plan1D.h"
+
+// minimum number of samples appended to the history
+// between compactions
+#define LANCZOS_STREAM1D_BLOCK 1024
+
+// A streaming 1D resampler for signals whose length is
+// unknown (e.g. sensor and audio streams) where src_w/dst_w
+// is the resampling ratio. The samples are pushed in chunks
+// of any size and each push emits the outputs whose source
+// window became complete. The history holds the samples
+// [start, start + count) of the stream where start is a
+// multiple of the phase step p such that the outputs are
+// resampled by the polyphase coefficients of a plan whose
+// geometry is the history (size samples) and the output
+// index is offset by (start/p)*q. The plan holds all q
+// phases even beyond LANCZOS_PLAN1D_MAX_PHASES (see
+// lanczos_plan1D_newPolyphase). The history is compacted
+// once it is full so the memory does not depend on the
+// stream length. The flush emits the remaining outputs with
+// the edge handling folded for the final stream length and
+// resets the stream. The outputs match lanczos_resample_
+// regular1D() when the stream length is a multiple of p.
+typedef struct
+{
+	int32_t channels;
+	int32_t p;
+	int32_t q;
+
+	lanczos_plan1D_t* plan;
+
+	int32_t size;
+	int32_t count;
+	int64_t start;
+	int64_t total;
+	int64_t next;
+	float*  hist; // n=size*channels
+	float*  coef; // n=plan->taps
+} lanczos_stream1D_t;
+
+// push returns the number of outputs written to dst and
+// flush returns the number of remaining outputs where
+// maxOutputs is the maximum number of outputs of a push of
+// count samples or a flush (count=0)
+lanczos_stream1D_t* lanczos_stream1D_new(uint32_t flags,
+                                         int32_t a,
+                                         int32_t channels,
+                                         int32_t src_w,
+                                         int32_t dst_w);
+void                lanczos_stream1D_delete(lanczos_stream1D_t** _self);
+int32_t             lanczos_stream1D_maxOutputs(lanczos_stream1D_t* self,
+                                                int32_t count);
+int32_t             lanczos_stream1D_push(lanczos_stream1D_t* self,
+                                          int32_t count,
+                                          const float* src,
+                                          float* dst);
+int32_t             lanczos_stream1D_flush(lanczos_stream1D_t* self,
+                                           float* dst);
+
+#endif
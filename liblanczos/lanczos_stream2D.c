@@ -0,0 +1,212 @@
+/*
+ * Copyright (c) 2025 Jeff Boody
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included
+ * in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+
+#include <stdlib.h>
+
+#define LOG_TAG "lanczos"
+#include "../../libcc/cc_log.h"
+#include "../../libcc/cc_memory.h"
+#include "lanczos_resample.h"
+#include "lanczos_simd.h"
+#include "lanczos_stream2D.h"
+
+/*
+ * private
+ */
+
+static int32_t
+lanczos_stream2D_emit(lanczos_stream2D_t* self, float* dst)
+{
+	ASSERT(self);
+	ASSERT(dst);
+
+	lanczos_plan2D_t* plan  = self->plan;
+	lanczos_plan1D_t* plany = plan->plany;
+
+	int32_t R      = plany->taps;
+	int32_t n      = plan->dst_w*self->channels;
+	int32_t output = 0;
+
+	// see lanczos_plan2D_executeTile
+	int32_t      k;
+	int32_t      first;
+	int32_t      count;
+	const float* coef;
+	while(self->dst_y < plan->dst_h)
+	{
+		coef = lanczos_plan1D_taps(plany, self->dst_y,
+		                           &first, &count);
+		if(first + count > self->src_y)
+		{
+			break;
+		}
+
+		// Vertical Interpolation
+		for(k = 0; k < count; ++k)
+		{
+			self->rows[k] = &self->ring[((first + k)%R)*n];
+		}
+		lanczos_simd_vertical(plan->flags, n, count, coef,
+		                      self->rows, &dst[output*n]);
+
+		++self->dst_y;
+		++output;
+	}
+
+	return output;
+}
+
+/*
+ * public
+ */
+
+lanczos_stream2D_t*
+lanczos_stream2D_new(lanczos_planCache_t* cache,
+                     uint32_t flags, int32_t a,
+                     int32_t channels,
+                     int32_t src_w, int32_t src_h,
+                     int32_t dst_w, int32_t dst_h)
+{
+	if((channels <= 0) ||
+	   (flags & LANCZOS_FLAG_MULTIDIM_2D_ISOTROPIC))
+	{
+		LOGE("invalid channels=%i, flags=0x%X",
+		     channels, flags);
+		return NULL;
+	}
+
+	lanczos_stream2D_t* self;
+	self = (lanczos_stream2D_t*)
+	       CALLOC(1, sizeof(lanczos_stream2D_t));
+	if(self == NULL)
+	{
+		LOGE("CALLOC failed");
+		return NULL;
+	}
+
+	self->channels = channels;
+
+	self->plan = lanczos_plan2D_new(cache, NULL, flags, a,
+	                                src_w, src_h,
+	                                dst_w, dst_h);
+	if(self->plan == NULL)
+	{
+		goto fail_plan;
+	}
+
+	int32_t R = self->plan->plany->taps;
+
+	self->ring = (float*)
+	             CALLOC(R*dst_w*channels, sizeof(float));
+	if(self->ring == NULL)
+	{
+		LOGE("CALLOC failed");
+		goto fail_ring;
+	}
+
+	self->rows = (const float**)
+	             CALLOC(R, sizeof(const float*));
+	if(self->rows == NULL)
+	{
+		LOGE("CALLOC failed");
+		goto fail_rows;
+	}
+
+	// success
+	return self;
+
+	// failure
+	fail_rows:
+		FREE(self->ring);
+	fail_ring:
+		lanczos_plan2D_delete(&self->plan);
+	fail_plan:
+		FREE(self);
+	return NULL;
+}
+
+void lanczos_stream2D_delete(lanczos_stream2D_t** _self)
+{
+	ASSERT(_self);
+
+	lanczos_stream2D_t* self = *_self;
+	if(self)
+	{
+		FREE(self->rows);
+		FREE(self->ring);
+		lanczos_plan2D_delete(&self->plan);
+		FREE(self);
+		*_self = NULL;
+	}
+}
+
+int32_t lanczos_stream2D_maxRows(lanczos_stream2D_t* self,
+                                 int32_t count)
+{
+	ASSERT(self);
+
+	// see lanczos_stream1D_maxOutputs
+	lanczos_plan2D_t* plan = self->plan;
+	int64_t n    = ((int64_t) count) + 2*plan->plany->taps;
+	int64_t rows = (n*plan->dst_h)/plan->src_h + 2;
+	if(rows > plan->dst_h)
+	{
+		rows = plan->dst_h;
+	}
+	return (int32_t) rows;
+}
+
+int32_t lanczos_stream2D_push(lanczos_stream2D_t* self,
+                              int32_t count,
+                              const float* src, float* dst)
+{
+	ASSERT(self);
+	ASSERT(src || (count == 0));
+	ASSERT(dst);
+	ASSERT(self->src_y + count <= self->plan->src_h);
+
+	lanczos_plan2D_t* plan = self->plan;
+
+	int32_t nch        = self->channels;
+	int32_t R          = plan->plany->taps;
+	int32_t n          = plan->dst_w*nch;
+	int32_t src_stride = plan->src_w*nch;
+	int32_t output     = 0;
+
+	// the row src_y replaces the row src_y - R which is
+	// before the window of the next output row
+	int32_t i;
+	for(i = 0; i < count; ++i)
+	{
+		// Horizontal Interpolation
+		lanczos_plan1D_executeRange(plan->planx, nch,
+		                            &src[i*src_stride],
+		                            &self->ring[(self->src_y%R)*n],
+		                            0, plan->dst_w);
+		++self->src_y;
+
+		output += lanczos_stream2D_emit(self, &dst[output*n]);
+	}
+
+	return output;
+}
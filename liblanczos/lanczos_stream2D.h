@@ -0,0 +1,75 @@
+/*
+ * Copyright (c) 2025 Jeff Boody
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included
+ * in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+
+#ifndef lanczos_stream2D_H
+#define lanczos_stream2D_H
+
+#include <stdint.h>
+
+#include "lanczos_plan2D.h"
+#include "lanczos_planCache.h"
+
+// A scanline 2D resampler for images which arrive as strips
+// of rows (e.g. from a decoder) such that neither the source
+// nor the destination is held in memory. Each source row is
+// horizontally resampled once into a ring buffer which holds
+// the plany->taps rows of the vertical window and the output
+// rows are emitted as soon as their vertical window is
+// complete. The vertical windows include the edge handling
+// such that the last output row is emitted by the push of
+// the last source row. The memory is proportional to
+// dst_w*plany->taps rather than the image size. The plans
+// are those of lanczos_plan2D_t (2D separable only).
+typedef struct
+{
+	int32_t           channels;
+	lanczos_plan2D_t* plan;
+
+	// rows which were pushed and emitted
+	int32_t src_y;
+	int32_t dst_y;
+
+	float*        ring; // n=plany->taps*dst_w*channels
+	const float** rows; // n=plany->taps
+} lanczos_stream2D_t;
+
+// push returns the number of output rows written to dst
+// where maxRows is the maximum number of output rows of a
+// push of count rows
+lanczos_stream2D_t* lanczos_stream2D_new(lanczos_planCache_t* cache,
+                                         uint32_t flags,
+                                         int32_t a,
+                                         int32_t channels,
+                                         int32_t src_w,
+                                         int32_t src_h,
+                                         int32_t dst_w,
+                                         int32_t dst_h);
+void                lanczos_stream2D_delete(lanczos_stream2D_t** _self);
+int32_t             lanczos_stream2D_maxRows(lanczos_stream2D_t* self,
+                                             int32_t count);
+int32_t             lanczos_stream2D_push(lanczos_stream2D_t* self,
+                                          int32_t count,
+                                          const float* src,
+                                          float* dst);
+
+#endif
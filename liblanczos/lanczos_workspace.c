@@ -0,0 +1,139 @@
+/*
+ * Copyright (c) 2025 Jeff Boody
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included
+ * in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+
+#include <string.h>
+
+#define LOG_TAG "lanczos"
+#include "../../libcc/cc_log.h"
+#include "../../libcc/cc_memory.h"
+#include "lanczos_workspace.h"
+
+/*
+ * public
+ */
+
+void lanczos_workspace_init(lanczos_workspace_t* self,
+                            void* base, size_t size)
+{
+	ASSERT(self);
+
+	self->size   = 0;
+	self->offset = 0;
+	self->base   = NULL;
+	if(base == NULL)
+	{
+		return;
+	}
+
+	// align the base such that every allocation is aligned
+	size_t pad = (LANCZOS_WORKSPACE_ALIGN -
+	              ((uintptr_t) base)%LANCZOS_WORKSPACE_ALIGN)%
+	             LANCZOS_WORKSPACE_ALIGN;
+	self->base = ((uint8_t*) base) + pad;
+	if(size > pad)
+	{
+		self->size = size - pad;
+	}
+}
+
+size_t lanczos_workspace_bytes(size_t count, size_t size)
+{
+	size_t bytes = count*size;
+	return (bytes + LANCZOS_WORKSPACE_ALIGN - 1)/
+	       LANCZOS_WORKSPACE_ALIGN*LANCZOS_WORKSPACE_ALIGN;
+}
+
+size_t lanczos_workspace_size(size_t bytes)
+{
+	// the base of the buffer may require up to
+	// LANCZOS_WORKSPACE_ALIGN - 1 bytes of padding
+	if(bytes == 0)
+	{
+		return 0;
+	}
+
+	return bytes + LANCZOS_WORKSPACE_ALIGN - 1;
+}
+
+void* lanczos_workspace_calloc(lanczos_workspace_t* self,
+                               size_t count, size_t size)
+{
+	if(self == NULL)
+	{
+		return CALLOC(count, size);
+	}
+
+	size_t bytes = lanczos_workspace_bytes(count, size);
+	if(self->base == NULL)
+	{
+		// measure the allocation
+		self->offset += bytes;
+		return CALLOC(count, size);
+	}
+
+	if(bytes > self->size - self->offset)
+	{
+		LOGE("invalid bytes=%i, available=%i",
+		     (int) bytes, (int) (self->size - self->offset));
+		return NULL;
+	}
+
+	void* ptr = &self->base[self->offset];
+	self->offset += bytes;
+	memset(ptr, 0, count*size);
+
+	return ptr;
+}
+
+void lanczos_workspace_free(lanczos_workspace_t* self,
+                            void* ptr)
+{
+	// allocations are released by lanczos_workspace_reset
+	if((self == NULL) || (self->base == NULL))
+	{
+		FREE(ptr);
+	}
+}
+
+size_t lanczos_workspace_mark(lanczos_workspace_t* self)
+{
+	if(self == NULL)
+	{
+		return 0;
+	}
+
+	return self->offset;
+}
+
+void lanczos_workspace_reset(lanczos_workspace_t* self,
+                             size_t mark)
+{
+	// the measured size is retained until the next init
+	if((self == NULL) || (self->base == NULL))
+	{
+		return;
+	}
+
+	ASSERT(mark <= self->offset);
+	self->offset = mark;
+}
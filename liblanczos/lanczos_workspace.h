@@ -0,0 +1,63 @@
+/*
+ * Copyright (c) 2025 Jeff Boody
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included
+ * in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+
+#ifndef lanczos_workspace_H
+#define lanczos_workspace_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+// alignment of each allocation
+#define LANCZOS_WORKSPACE_ALIGN 64
+
+// A bump allocator over a caller-owned buffer which replaces
+// the heap allocations of a resampling call. A thread may
+// keep one workspace for its lifetime since each call
+// releases its allocations on return. The allocations are
+// zeroed and free is a no-op. A workspace with a NULL base
+// measures the size required by a call (e.g. the
+// lanczos_resample_*Workspace queries) by allocating from
+// the heap where the buffer must also hold the padding
+// that aligns its base (see lanczos_workspace_size). The
+// workspace functions also accept a NULL workspace which
+// selects the heap.
+typedef struct
+{
+	size_t   size;
+	size_t   offset;
+	uint8_t* base;
+} lanczos_workspace_t;
+
+void   lanczos_workspace_init(lanczos_workspace_t* self,
+                              void* base, size_t size);
+size_t lanczos_workspace_bytes(size_t count, size_t size);
+size_t lanczos_workspace_size(size_t bytes);
+void*  lanczos_workspace_calloc(lanczos_workspace_t* self,
+                                size_t count, size_t size);
+void   lanczos_workspace_free(lanczos_workspace_t* self,
+                              void* ptr);
+size_t lanczos_workspace_mark(lanczos_workspace_t* self);
+void   lanczos_workspace_reset(lanczos_workspace_t* self,
+                               size_t mark);
+
+#endif
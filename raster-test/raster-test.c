@@ -0,0 +1,117 @@
+/*
+ * Copyright (c) 2025 Jeff Boody
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included
+ * in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <sys/resource.h>
+
+#define LOG_TAG "lanczos"
+#include "libcc/cc_log.h"
+#include "libcc/cc_memory.h"
+#include "liblanczos/lanczos_resample.h"
+
+/***********************************************************
+* public                                                   *
+***********************************************************/
+
+int main(int argc, const char** argv)
+{
+	if((argc != 9) && (argc != 10))
+	{
+		LOGI("usage: %s a channels src_w src_h dst_w dst_h "
+		     "src.raw dst.raw [threads]", argv[0]);
+		return EXIT_FAILURE;
+	}
+
+	lanczos_raster2DStats_t stats = { 0 };
+
+	lanczos_paramRaster2D_t param =
+	{
+		.flags     = 0,
+		.a         = (int32_t) strtol(argv[1], NULL, 0),
+		.channels  = (int32_t) strtol(argv[2], NULL, 0),
+		.src_w     = (int32_t) strtol(argv[3], NULL, 0),
+		.src_h     = (int32_t) strtol(argv[4], NULL, 0),
+		.dst_w     = (int32_t) strtol(argv[5], NULL, 0),
+		.dst_h     = (int32_t) strtol(argv[6], NULL, 0),
+		.src_fname = argv[7],
+		.dst_fname = argv[8],
+		.stats     = &stats,
+	};
+
+	int32_t threads = 1;
+	if(argc == 10)
+	{
+		threads = (int32_t) strtol(argv[9], NULL, 0);
+	}
+
+	if(threads > 1)
+	{
+		param.pool = lanczos_pool_new(threads);
+		if(param.pool == NULL)
+		{
+			return EXIT_FAILURE;
+		}
+	}
+
+	struct rusage ru0;
+	struct rusage ru1;
+	getrusage(RUSAGE_SELF, &ru0);
+
+	if(lanczos_resample_raster2D(&param) == 0)
+	{
+		goto fail_resample;
+	}
+
+	getrusage(RUSAGE_SELF, &ru1);
+
+	// report the throughput and I/O volume where the block
+	// counts are in units of 512 bytes
+	double mb       = 1024.0*1024.0;
+	double src_mb   = ((double) param.src_w)*param.src_h*
+	                  param.channels*sizeof(float)/mb;
+	double dst_mb   = ((double) stats.dst_bytes)/mb;
+	double read_mb  = ((double) (ru1.ru_inblock -
+	                             ru0.ru_inblock))*512.0/mb;
+	double write_mb = ((double) (ru1.ru_oublock -
+	                             ru0.ru_oublock))*512.0/mb;
+	LOGI("tiles=%i, seconds=%lf", stats.tiles, stats.seconds);
+	LOGI("throughput: src=%.1lf MB/s, dst=%.1lf Mpixels/s",
+	     src_mb/stats.seconds,
+	     ((double) param.dst_w)*param.dst_h/1e6/stats.seconds);
+	LOGI("footprint: src=%.1lf MB (%.3lfx), dst=%.1lf MB",
+	     ((double) stats.src_bytes)/mb,
+	     ((double) stats.src_bytes)/mb/src_mb, dst_mb);
+	LOGI("I/O: read=%.1lf MB, write=%.1lf MB, major faults=%li",
+	     read_mb, write_mb, ru1.ru_majflt - ru0.ru_majflt);
+
+	lanczos_pool_delete(&param.pool);
+
+	// success
+	return EXIT_SUCCESS;
+
+	// failure
+	fail_resample:
+		lanczos_pool_delete(&param.pool);
+	return EXIT_FAILURE;
+}
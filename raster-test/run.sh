@@ -0,0 +1,5 @@
+#!/bin/bash
+
+# 8192x8192 float raster (256 MB)
+head -c 268435456 /dev/zero > raster-src.raw
+./raster-test 3 1 8192 8192 3000 3000 raster-src.raw raster-dst.raw 4
@@ -51,20 +51,23 @@ int main(int argc, const char** argv)
 		.dst_w    = (int32_t) strtol(argv[3], NULL, 0),
 	};
 
-	param.src = (float*) CALLOC(param.src_w, sizeof(float));
-	if(param.src == NULL)
+	float* src = (float*) CALLOC(param.src_w, sizeof(float));
+	if(src == NULL)
 	{
 		LOGE("CALLOC failed");
 		return EXIT_FAILURE;
 	}
 
-	param.dst = (float*) CALLOC(param.dst_w, sizeof(float));
-	if(param.dst == NULL)
+	float* dst = (float*) CALLOC(param.dst_w, sizeof(float));
+	if(dst == NULL)
 	{
 		LOGE("CALLOC failed");
 		goto fail_dst;
 	}
 
+	param.src = src;
+	param.dst = dst;
+
 	// generate src data
 	float   a;
 	float   b = (float) (param.src_w - 1);
@@ -72,7 +75,7 @@ int main(int argc, const char** argv)
 	for(i = 0; i < param.src_w; ++i)
 	{
 		a = (float) i;
-		param.src[i] = sinf(2.0f*M_PI*a/b);
+		src[i] = sinf(2.0f*M_PI*a/b);
 	}
 
 	char src_dat[256];
@@ -106,7 +109,7 @@ int main(int argc, const char** argv)
 	// export src data
 	for(i = 0; i < param.src_w; ++i)
 	{
-		fprintf(fsrc_dat, "%f %f\n", (float) i, param.src[i]);
+		fprintf(fsrc_dat, "%f %f\n", (float) i, src[i]);
 	}
 
 	// export dst data
@@ -117,13 +120,13 @@ int main(int argc, const char** argv)
 	for(j = 0; j < param.dst_w; ++j)
 	{
 		xj = (j + 0.5f)*step - 0.5f;
-		fprintf(fdst_dat, "%f %f\n", xj, param.dst[j]);
+		fprintf(fdst_dat, "%f %f\n", xj, dst[j]);
 	}
 
 	fclose(fdst_dat);
 	fclose(fsrc_dat);
-	FREE(param.dst);
-	FREE(param.src);
+	FREE(dst);
+	FREE(src);
 
 	// success
 	return EXIT_SUCCESS;
@@ -134,8 +137,8 @@ int main(int argc, const char** argv)
 	fail_fdst_dat:
 		fclose(fsrc_dat);
 	fail_fsrc_dat:
-		FREE(param.dst);
+		FREE(dst);
 	fail_dst:
-		FREE(param.src);
+		FREE(src);
 	return EXIT_FAILURE;
 }